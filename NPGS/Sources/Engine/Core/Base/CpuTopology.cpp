@@ -0,0 +1,419 @@
+#include "stdafx.h"
+#include "CpuTopology.hpp"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+
+#if defined(_WIN64)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Npgs
+{
+    namespace
+    {
+        // 各平台后端只负责收集原始键值，由 FCpuTopology::Detect 统一重新编号
+        struct FRawProcessor
+        {
+            std::uint32_t OsIndex{};
+            std::uint64_t CoreKey{};
+            std::uint64_t CacheKey{};
+            std::uint64_t NodeKey{};
+        };
+
+#if defined(_WIN64)
+        std::vector<FRawProcessor> DetectRawProcessors()
+        {
+            DWORD Length = 0;
+            GetLogicalProcessorInformationEx(RelationAll, nullptr, &Length);
+            std::vector<std::uint8_t> Buffer(Length);
+            if (!GetLogicalProcessorInformationEx(
+                RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(Buffer.data()), &Length))
+            {
+                return {};
+            }
+
+            std::map<std::uint32_t, FRawProcessor> Processors;
+            auto ForEachProcessor = [&Processors](const GROUP_AFFINITY& Affinity, auto&& Func) -> void
+            {
+                for (std::uint32_t BitIndex = 0; BitIndex != 64; ++BitIndex)
+                {
+                    if (Affinity.Mask & (static_cast<KAFFINITY>(1) << BitIndex))
+                    {
+                        std::uint32_t OsIndex = Affinity.Group * 64u + BitIndex;
+                        FRawProcessor& Processor = Processors[OsIndex];
+                        Processor.OsIndex = OsIndex;
+                        Func(Processor);
+                    }
+                }
+            };
+
+            // 同一核心的超线程不一定相邻，因此不能假设兄弟超线程位于 CoreId * 2 + 1
+            std::uint64_t CoreKey  = 0;
+            std::uint64_t CacheKey = 0;
+            for (DWORD Offset = 0; Offset < Length;)
+            {
+                auto* Info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(Buffer.data() + Offset);
+                switch (Info->Relationship)
+                {
+                case RelationProcessorCore:
+                    for (WORD Group = 0; Group != Info->Processor.GroupCount; ++Group)
+                    {
+                        ForEachProcessor(Info->Processor.GroupMask[Group], [CoreKey](FRawProcessor& Processor) -> void
+                        {
+                            Processor.CoreKey = CoreKey;
+                        });
+                    }
+                    ++CoreKey;
+                    break;
+                case RelationCache:
+                    if (Info->Cache.Level == 3)
+                    {
+                        ++CacheKey;
+                        ForEachProcessor(Info->Cache.GroupMask, [CacheKey](FRawProcessor& Processor) -> void
+                        {
+                            Processor.CacheKey = CacheKey;
+                        });
+                    }
+                    break;
+                case RelationNumaNode:
+                    ForEachProcessor(Info->NumaNode.GroupMask, [NodeNumber = Info->NumaNode.NodeNumber](FRawProcessor& Processor) -> void
+                    {
+                        Processor.NodeKey = NodeNumber;
+                    });
+                    break;
+                default:
+                    break;
+                }
+
+                Offset += Info->Size;
+            }
+
+            std::vector<FRawProcessor> Result;
+            for (const auto& [OsIndex, Processor] : Processors)
+            {
+                Result.push_back(Processor);
+            }
+
+            return Result;
+        }
+#elif defined(__linux__)
+        std::string ReadFirstLine(const std::filesystem::path& Filename)
+        {
+            std::ifstream File(Filename);
+            std::string Line;
+            std::getline(File, Line);
+            return Line;
+        }
+
+        std::uint64_t ReadUint(const std::filesystem::path& Filename, std::uint64_t Fallback)
+        {
+            std::string Line = ReadFirstLine(Filename);
+            if (Line.empty() || Line.front() == '-')
+            {
+                return Fallback;
+            }
+
+            try
+            {
+                return std::stoull(Line);
+            }
+            catch (const std::exception&)
+            {
+                return Fallback;
+            }
+        }
+
+        // 解析 "0-3,8,10-11" 格式的 CPU 列表
+        std::vector<std::uint32_t> ParseCpuList(const std::string& List)
+        {
+            std::vector<std::uint32_t> Result;
+            std::size_t Begin = 0;
+            while (Begin < List.size())
+            {
+                std::size_t End = List.find(',', Begin);
+                if (End == std::string::npos)
+                {
+                    End = List.size();
+                }
+
+                std::string Range = List.substr(Begin, End - Begin);
+                std::size_t Dash  = Range.find('-');
+                try
+                {
+                    std::uint32_t First = static_cast<std::uint32_t>(std::stoul(Range.substr(0, Dash)));
+                    std::uint32_t Last  = Dash == std::string::npos ? First : static_cast<std::uint32_t>(std::stoul(Range.substr(Dash + 1)));
+                    for (std::uint32_t Cpu = First; Cpu <= Last; ++Cpu)
+                    {
+                        Result.push_back(Cpu);
+                    }
+                }
+                catch (const std::exception&)
+                {
+                }
+
+                Begin = End + 1;
+            }
+
+            return Result;
+        }
+
+        std::vector<FRawProcessor> DetectRawProcessors()
+        {
+            const std::filesystem::path CpuRoot("/sys/devices/system/cpu");
+
+            // 只使用当前进程被允许运行的处理器（容器或 taskset 可能限制了 cpuset）
+            cpu_set_t AllowedSet;
+            CPU_ZERO(&AllowedSet);
+            bool bHasAllowedSet = sched_getaffinity(0, sizeof(AllowedSet), &AllowedSet) == 0;
+
+            std::vector<FRawProcessor> Result;
+            std::error_code Error;
+            for (std::uint32_t Cpu : ParseCpuList(ReadFirstLine(CpuRoot / "online")))
+            {
+                if (bHasAllowedSet && Cpu < CPU_SETSIZE && !CPU_ISSET(Cpu, &AllowedSet))
+                {
+                    continue;
+                }
+
+                std::filesystem::path CpuDirectory = CpuRoot / ("cpu" + std::to_string(Cpu));
+                std::uint64_t Package = ReadUint(CpuDirectory / "topology" / "physical_package_id", 0);
+                std::uint64_t CoreId  = ReadUint(CpuDirectory / "topology" / "core_id", Cpu);
+
+                FRawProcessor Processor
+                {
+                    .OsIndex = Cpu,
+                    .CoreKey = Package << 32 | CoreId
+                };
+
+                // L3 域以共享该缓存的第一个处理器编号标识
+                for (const auto& Entry : std::filesystem::directory_iterator(CpuDirectory / "cache", Error))
+                {
+                    if (Entry.path().filename().string().starts_with("index") && ReadUint(Entry.path() / "level", 0) == 3)
+                    {
+                        std::vector<std::uint32_t> SharedCpus = ParseCpuList(ReadFirstLine(Entry.path() / "shared_cpu_list"));
+                        Processor.CacheKey = SharedCpus.empty() ? 0 : SharedCpus.front() + 1ull;
+                        break;
+                    }
+                }
+
+                for (const auto& Entry : std::filesystem::directory_iterator(CpuDirectory, Error))
+                {
+                    std::string Name = Entry.path().filename().string();
+                    if (Name.starts_with("node") && Name.size() > 4 && std::isdigit(static_cast<unsigned char>(Name[4])))
+                    {
+                        Processor.NodeKey = std::stoull(Name.substr(4));
+                        break;
+                    }
+                }
+
+                Result.push_back(Processor);
+            }
+
+            return Result;
+        }
+#else
+        std::vector<FRawProcessor> DetectRawProcessors()
+        {
+            return {};
+        }
+#endif
+
+        template <typename KeyType>
+        std::uint32_t GetOrAddIndex(std::map<KeyType, std::uint32_t>& Indices, const KeyType& Key)
+        {
+            return Indices.try_emplace(Key, static_cast<std::uint32_t>(Indices.size())).first->second;
+        }
+    }
+
+    FCpuTopology::FCpuTopology(std::vector<FLogicalProcessor> Processors)
+        : Processors_(std::move(Processors))
+    {
+        BuildOrders();
+    }
+
+    FCpuTopology FCpuTopology::Detect()
+    {
+        std::vector<FRawProcessor> RawProcessors = DetectRawProcessors();
+        if (RawProcessors.empty())
+        {
+            std::uint32_t Count = std::max(std::thread::hardware_concurrency(), 1u);
+            for (std::uint32_t i = 0; i != Count; ++i)
+            {
+                RawProcessors.push_back({ .OsIndex = i, .CoreKey = i });
+            }
+        }
+
+        std::ranges::sort(RawProcessors, {}, &FRawProcessor::OsIndex);
+
+        // 按键值排序重新编号，保证编号连续且与系统编号的顺序一致
+        std::map<std::uint64_t, std::uint32_t> NodeIndices;
+        std::map<std::pair<std::uint64_t, std::uint64_t>, std::uint32_t> CacheIndices;
+        std::map<std::uint64_t, std::uint32_t> CoreIndices;
+        std::map<std::uint32_t, std::uint32_t> CoreSiblingCounts;
+
+        std::vector<FLogicalProcessor> Processors;
+        Processors.reserve(RawProcessors.size());
+        for (const auto& Raw : RawProcessors)
+        {
+            std::uint32_t CoreIndex = GetOrAddIndex(CoreIndices, Raw.CoreKey);
+            Processors.push_back(
+            {
+                .OsIndex    = Raw.OsIndex,
+                .CoreIndex  = CoreIndex,
+                .SmtIndex   = CoreSiblingCounts[CoreIndex]++,
+                .CacheIndex = GetOrAddIndex(CacheIndices, std::make_pair(Raw.NodeKey, Raw.CacheKey)),
+                .NumaNode   = GetOrAddIndex(NodeIndices, Raw.NodeKey)
+            });
+        }
+
+        return FCpuTopology(std::move(Processors));
+    }
+
+    std::vector<std::size_t> FCpuTopology::GetAffinitySet(EThreadAffinityPolicy Policy, std::size_t ThreadIndex, std::uint32_t SmtIndex) const
+    {
+        if (Processors_.empty())
+        {
+            return {};
+        }
+
+        switch (Policy)
+        {
+        case EThreadAffinityPolicy::kCompact:
+            return { CompactOrder_[ThreadIndex % CompactOrder_.size()] };
+        case EThreadAffinityPolicy::kScatter:
+            return { ScatterOrder_[ThreadIndex % ScatterOrder_.size()] };
+        case EThreadAffinityPolicy::kOnePerCore:
+        {
+            const auto& Siblings = CoreProcessors_[CoreOrder_[ThreadIndex % CoreOrder_.size()]];
+            return { Siblings[SmtIndex % Siblings.size()] };
+        }
+        case EThreadAffinityPolicy::kPerNumaNode:
+            return NumaNodeProcessors_[ThreadIndex % NumaNodeProcessors_.size()];
+        default:
+            return {};
+        }
+    }
+
+    bool FCpuTopology::ApplyAffinity(std::jthread& Thread, std::span<const std::size_t> ProcessorIndices) const
+    {
+        if (ProcessorIndices.empty())
+        {
+            return false;
+        }
+
+#if defined(_WIN64)
+        // 线程只能绑定到单个处理器组，组外的处理器被忽略
+        GROUP_AFFINITY Affinity{};
+        Affinity.Group = static_cast<WORD>(Processors_[ProcessorIndices.front()].OsIndex / 64);
+        for (std::size_t Index : ProcessorIndices)
+        {
+            std::uint32_t OsIndex = Processors_[Index].OsIndex;
+            if (OsIndex / 64 == Affinity.Group)
+            {
+                Affinity.Mask |= static_cast<KAFFINITY>(1) << (OsIndex % 64);
+            }
+        }
+
+        return SetThreadGroupAffinity(Thread.native_handle(), &Affinity, nullptr) != 0;
+#elif defined(__linux__)
+        cpu_set_t Set;
+        CPU_ZERO(&Set);
+        for (std::size_t Index : ProcessorIndices)
+        {
+            CPU_SET(Processors_[Index].OsIndex, &Set);
+        }
+
+        return pthread_setaffinity_np(Thread.native_handle(), sizeof(Set), &Set) == 0;
+#else
+        return false;
+#endif
+    }
+
+    void FCpuTopology::BuildOrders()
+    {
+        std::uint32_t CoreCount = 0;
+        std::uint32_t NodeCount = 0;
+        CacheDomainCount_ = 0;
+        for (const auto& Processor : Processors_)
+        {
+            CoreCount         = std::max(CoreCount, Processor.CoreIndex + 1);
+            NodeCount         = std::max(NodeCount, Processor.NumaNode + 1);
+            CacheDomainCount_ = std::max<std::size_t>(CacheDomainCount_, Processor.CacheIndex + 1);
+        }
+
+        CoreProcessors_.assign(CoreCount, {});
+        NumaNodeProcessors_.assign(NodeCount, {});
+        for (std::size_t i = 0; i != Processors_.size(); ++i)
+        {
+            CoreProcessors_[Processors_[i].CoreIndex].push_back(i);
+            NumaNodeProcessors_[Processors_[i].NumaNode].push_back(i);
+        }
+
+        std::erase_if(CoreProcessors_, [](const auto& Siblings) -> bool { return Siblings.empty(); });
+        std::erase_if(NumaNodeProcessors_, [](const auto& Members) -> bool { return Members.empty(); });
+        for (auto& Siblings : CoreProcessors_)
+        {
+            std::ranges::sort(Siblings, {}, [this](std::size_t Index) -> std::uint32_t { return Processors_[Index].SmtIndex; });
+        }
+
+        auto LocalityKey = [this](std::size_t Index)
+        {
+            const auto& Processor = Processors_[Index];
+            return std::make_tuple(Processor.NumaNode, Processor.CacheIndex, Processor.CoreIndex, Processor.SmtIndex);
+        };
+
+        CompactOrder_.resize(Processors_.size());
+        for (std::size_t i = 0; i != CompactOrder_.size(); ++i)
+        {
+            CompactOrder_[i] = i;
+        }
+        std::ranges::sort(CompactOrder_, {}, LocalityKey);
+
+        CoreOrder_.resize(CoreProcessors_.size());
+        for (std::size_t i = 0; i != CoreOrder_.size(); ++i)
+        {
+            CoreOrder_[i] = i;
+        }
+        std::ranges::sort(CoreOrder_, {}, [&](std::size_t Core) { return LocalityKey(CoreProcessors_[Core].front()); });
+
+        // 分散顺序：先按超线程序号分层，层内按核心在 L3 域内的序号、L3 域在节点内的序号、节点编号排序
+        // 这样连续的线程会轮流落在不同的 NUMA 节点和 L3 域上
+        std::vector<std::uint32_t> CoreRankInDomain(Processors_.size());
+        std::vector<std::uint32_t> DomainRankInNode(Processors_.size());
+        std::map<std::uint32_t, std::uint32_t> DomainCoreCounts;
+        std::map<std::uint32_t, std::uint32_t> NodeDomainCounts;
+        std::map<std::uint32_t, std::uint32_t> DomainRanks;
+        for (std::size_t Core : CoreOrder_)
+        {
+            const auto& First = Processors_[CoreProcessors_[Core].front()];
+            std::uint32_t CoreRank = DomainCoreCounts[First.CacheIndex]++;
+            if (!DomainRanks.contains(First.CacheIndex))
+            {
+                DomainRanks[First.CacheIndex] = NodeDomainCounts[First.NumaNode]++;
+            }
+
+            for (std::size_t Index : CoreProcessors_[Core])
+            {
+                CoreRankInDomain[Index] = CoreRank;
+                DomainRankInNode[Index] = DomainRanks[First.CacheIndex];
+            }
+        }
+
+        ScatterOrder_ = CompactOrder_;
+        std::ranges::sort(ScatterOrder_, {}, [&](std::size_t Index)
+        {
+            const auto& Processor = Processors_[Index];
+            return std::make_tuple(Processor.SmtIndex, CoreRankInDomain[Index], DomainRankInNode[Index], Processor.NumaNode);
+        });
+    }
+} // namespace Npgs
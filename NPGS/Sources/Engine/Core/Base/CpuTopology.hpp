@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Npgs
+{
+    struct FLogicalProcessor
+    {
+        std::uint32_t OsIndex{};     // 系统中的逻辑处理器编号，Windows 下为 Group * 64 + 组内编号
+        std::uint32_t CoreIndex{};   // 物理核心编号，拓扑内连续
+        std::uint32_t SmtIndex{};    // 同一物理核心内的超线程序号
+        std::uint32_t CacheIndex{};  // L3 缓存域编号，拓扑内连续
+        std::uint32_t NumaNode{};    // NUMA 节点编号，拓扑内连续
+    };
+
+    enum class EThreadAffinityPolicy
+    {
+        kNone,        // 不绑定，由系统调度
+        kCompact,     // 先占满一个核心的所有超线程，再占用同一 L3 域、同一 NUMA 节点的下一个核心
+        kScatter,     // 尽量分散到不同 NUMA 节点和 L3 域，所有核心的第一个超线程用完后才使用兄弟超线程
+        kOnePerCore,  // 每个线程独占一个物理核心，只使用其中一个超线程
+        kPerNumaNode  // 线程轮流绑定到整个 NUMA 节点，节点内由系统调度
+    };
+
+    // 处理器拓扑。Windows 下使用 GetLogicalProcessorInformationEx，Linux 下读取 /sys/devices/system/cpu 与 /sys/devices/system/node
+    // 无法获取拓扑信息时退化为每个逻辑处理器一个核心、单 L3 域、单 NUMA 节点
+    class FCpuTopology
+    {
+    public:
+        FCpuTopology() = default;
+        explicit FCpuTopology(std::vector<FLogicalProcessor> Processors);
+
+        static FCpuTopology Detect();
+
+        // 第 ThreadIndex 个线程在给定策略下应绑定的逻辑处理器，返回值为 GetLogicalProcessors 中的下标
+        // kOnePerCore 使用每个核心的第 SmtIndex 个超线程（超出兄弟数量时取模）
+        std::vector<std::size_t> GetAffinitySet(EThreadAffinityPolicy Policy, std::size_t ThreadIndex, std::uint32_t SmtIndex = 0) const;
+        bool ApplyAffinity(std::jthread& Thread, std::span<const std::size_t> ProcessorIndices) const;
+
+        const std::vector<FLogicalProcessor>& GetLogicalProcessors() const;
+        std::size_t GetLogicalProcessorCount() const;
+        std::size_t GetPhysicalCoreCount() const;
+        std::size_t GetCacheDomainCount() const;
+        std::size_t GetNumaNodeCount() const;
+
+    private:
+        void BuildOrders();
+
+    private:
+        std::vector<FLogicalProcessor>        Processors_;
+        std::vector<std::vector<std::size_t>> CoreProcessors_;     // 每个核心的逻辑处理器，按 SmtIndex 排序
+        std::vector<std::vector<std::size_t>> NumaNodeProcessors_;
+        std::vector<std::size_t>              CompactOrder_;
+        std::vector<std::size_t>              ScatterOrder_;
+        std::vector<std::size_t>              CoreOrder_;          // kOnePerCore 使用的核心顺序，按 NUMA 节点、L3 域排列
+        std::size_t                           CacheDomainCount_{};
+    };
+} // namespace Npgs
+
+#include "CpuTopology.inl"
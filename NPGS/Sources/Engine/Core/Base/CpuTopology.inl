@@ -0,0 +1,31 @@
+#include "CpuTopology.hpp"
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE const std::vector<FLogicalProcessor>& FCpuTopology::GetLogicalProcessors() const
+    {
+        return Processors_;
+    }
+
+    NPGS_INLINE std::size_t FCpuTopology::GetLogicalProcessorCount() const
+    {
+        return Processors_.size();
+    }
+
+    NPGS_INLINE std::size_t FCpuTopology::GetPhysicalCoreCount() const
+    {
+        return CoreProcessors_.size();
+    }
+
+    NPGS_INLINE std::size_t FCpuTopology::GetCacheDomainCount() const
+    {
+        return CacheDomainCount_;
+    }
+
+    NPGS_INLINE std::size_t FCpuTopology::GetNumaNodeCount() const
+    {
+        return NumaNodeProcessors_.size();
+    }
+} // namespace Npgs
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <random>
 #include <memory>
 #include <type_traits>
@@ -293,4 +294,19 @@ namespace Npgs::Math
     private:
         std::bernoulli_distribution Distribution_;
     };
+
+    // 无状态的整数混洗函数，用于按索引生成可复现的随机数，结果与线程调度顺序无关
+    constexpr std::uint64_t SplitMix64(std::uint64_t Value)
+    {
+        Value += 0x9E3779B97F4A7C15ull;
+        Value  = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value  = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    // 将 64 位哈希值映射到 [0, 1)
+    constexpr double HashToUnitDouble(std::uint64_t Hash)
+    {
+        return static_cast<double>(Hash >> 11) * 0x1.0p-53;
+    }
 } // namespace Npgs::Utils
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#if defined(__SIZEOF_INT128__)
+#define NPGS_NATIVE_UINT128
+#endif // defined(__SIZEOF_INT128__)
+
+namespace Npgs::Math
+{
+    // 定长 128 位无符号整数，用于天体质量这类超出 64 位范围的整数量
+    // GCC/Clang 下运算直接使用 unsigned __int128，MSVC x64 使用 _umul128/_udiv128，其余平台逐位计算
+    // 布局固定为两个 64 位字，可平凡复制，与平台无关
+    class FUint128
+    {
+    public:
+        constexpr FUint128() = default;
+        constexpr FUint128(std::uint64_t High, std::uint64_t Low);
+
+        template <std::integral Ty>
+        constexpr FUint128(Ty Value);
+
+        // 负数与 NaN 截断为 0，超出范围时饱和到最大值
+        template <std::floating_point Ty>
+        explicit FUint128(Ty Value);
+
+        template <typename Ty>
+        requires std::is_arithmetic_v<Ty>
+        explicit operator Ty() const;
+
+        template <typename Ty>
+        requires std::is_arithmetic_v<Ty>
+        Ty ConvertTo() const;
+
+        constexpr std::uint64_t GetHigh() const;
+        constexpr std::uint64_t GetLow() const;
+
+        constexpr FUint128& operator+=(const FUint128& Other);
+        constexpr FUint128& operator-=(const FUint128& Other);
+        FUint128& operator*=(const FUint128& Other);
+        FUint128& operator/=(const FUint128& Other);
+        FUint128& operator%=(const FUint128& Other);
+
+        friend constexpr FUint128 operator+(FUint128 Lhs, const FUint128& Rhs);
+        friend constexpr FUint128 operator-(FUint128 Lhs, const FUint128& Rhs);
+        friend FUint128 operator*(FUint128 Lhs, const FUint128& Rhs);
+        friend FUint128 operator/(FUint128 Lhs, const FUint128& Rhs);
+        friend FUint128 operator%(FUint128 Lhs, const FUint128& Rhs);
+
+        friend constexpr bool operator==(const FUint128&, const FUint128&)                  = default;
+        friend constexpr std::strong_ordering operator<=>(const FUint128&, const FUint128&) = default;
+
+    private:
+        static std::uint64_t DivideWord(std::uint64_t High, std::uint64_t Low, std::uint64_t Divisor, std::uint64_t& Remainder);
+        static void DivideModulo(const FUint128& Dividend, const FUint128& Divisor, FUint128& Quotient, FUint128& Remainder);
+
+    private:
+        // 高位在前，使默认的三路比较按数值大小排序
+        std::uint64_t High_{};
+        std::uint64_t Low_{};
+    };
+} // namespace Npgs::Math
+
+#include "Uint128.inl"
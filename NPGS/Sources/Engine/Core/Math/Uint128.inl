@@ -0,0 +1,289 @@
+#include "Uint128.hpp"
+
+#include <cmath>
+#include <bit>
+#include <limits>
+
+#if !defined(NPGS_NATIVE_UINT128) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif // !defined(NPGS_NATIVE_UINT128) && defined(_MSC_VER) && defined(_M_X64)
+
+#include "Engine/Core/Base/Assert.hpp"
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs::Math
+{
+    constexpr FUint128::FUint128(std::uint64_t High, std::uint64_t Low)
+        : High_(High), Low_(Low)
+    {
+    }
+
+    template <std::integral Ty>
+    constexpr FUint128::FUint128(Ty Value)
+        : High_(Value < 0 ? std::numeric_limits<std::uint64_t>::max() : 0)
+        , Low_(static_cast<std::uint64_t>(Value))
+    {
+    }
+
+    template <std::floating_point Ty>
+    NPGS_INLINE FUint128::FUint128(Ty Value)
+    {
+        double Digital = static_cast<double>(Value);
+        if (!(Digital > 0.0))
+        {
+            return;
+        }
+
+        if (Digital >= 0x1p128)
+        {
+            High_ = std::numeric_limits<std::uint64_t>::max();
+            Low_  = std::numeric_limits<std::uint64_t>::max();
+            return;
+        }
+
+        // 大于 2^64 的 double 最低位权重不小于 2^12，减去高位部分的结果是精确的
+        double High = std::floor(Digital * 0x1p-64);
+        High_ = static_cast<std::uint64_t>(High);
+        Low_  = static_cast<std::uint64_t>(Digital - High * 0x1p64);
+    }
+
+    template <typename Ty>
+    requires std::is_arithmetic_v<Ty>
+    NPGS_INLINE FUint128::operator Ty() const
+    {
+        return ConvertTo<Ty>();
+    }
+
+    template <typename Ty>
+    requires std::is_arithmetic_v<Ty>
+    NPGS_INLINE Ty FUint128::ConvertTo() const
+    {
+        if constexpr (std::is_floating_point_v<Ty>)
+        {
+            // float 在高位接近 2^64 时直接相乘会溢出，统一在 double 中计算
+            using FComputeType = std::conditional_t<(sizeof(Ty) > sizeof(double)), Ty, double>;
+            return static_cast<Ty>(static_cast<FComputeType>(High_) * static_cast<FComputeType>(0x1p64) + static_cast<FComputeType>(Low_));
+        }
+        else if constexpr (std::is_same_v<Ty, bool>)
+        {
+            return (High_ | Low_) != 0;
+        }
+        else
+        {
+            return static_cast<Ty>(Low_);
+        }
+    }
+
+    constexpr std::uint64_t FUint128::GetHigh() const
+    {
+        return High_;
+    }
+
+    constexpr std::uint64_t FUint128::GetLow() const
+    {
+        return Low_;
+    }
+
+    constexpr FUint128& FUint128::operator+=(const FUint128& Other)
+    {
+        std::uint64_t Low = Low_ + Other.Low_;
+        High_ += Other.High_ + (Low < Low_ ? 1 : 0);
+        Low_   = Low;
+        return *this;
+    }
+
+    constexpr FUint128& FUint128::operator-=(const FUint128& Other)
+    {
+        std::uint64_t Low = Low_ - Other.Low_;
+        High_ -= Other.High_ + (Low > Low_ ? 1 : 0);
+        Low_   = Low;
+        return *this;
+    }
+
+    NPGS_INLINE FUint128& FUint128::operator*=(const FUint128& Other)
+    {
+#if defined(NPGS_NATIVE_UINT128)
+        unsigned __int128 Result = ((static_cast<unsigned __int128>(High_) << 64) | Low_) *
+                                   ((static_cast<unsigned __int128>(Other.High_) << 64) | Other.Low_);
+
+        High_ = static_cast<std::uint64_t>(Result >> 64);
+        Low_  = static_cast<std::uint64_t>(Result);
+#else
+        // 低位相乘的 128 位完整结果加上两组交叉项的低 64 位，更高的部分溢出丢弃
+        std::uint64_t High = High_ * Other.Low_ + Low_ * Other.High_;
+#if defined(_MSC_VER) && defined(_M_X64)
+        std::uint64_t LowHigh = 0;
+        std::uint64_t Low     = _umul128(Low_, Other.Low_, &LowHigh);
+#else
+        std::uint64_t A0 = Low_ & 0xFFFFFFFF;
+        std::uint64_t A1 = Low_ >> 32;
+        std::uint64_t B0 = Other.Low_ & 0xFFFFFFFF;
+        std::uint64_t B1 = Other.Low_ >> 32;
+
+        std::uint64_t P00 = A0 * B0;
+        std::uint64_t P01 = A0 * B1;
+        std::uint64_t P10 = A1 * B0;
+        std::uint64_t P11 = A1 * B1;
+
+        std::uint64_t Middle  = (P00 >> 32) + (P01 & 0xFFFFFFFF) + (P10 & 0xFFFFFFFF);
+        std::uint64_t Low     = (Middle << 32) | (P00 & 0xFFFFFFFF);
+        std::uint64_t LowHigh = P11 + (P01 >> 32) + (P10 >> 32) + (Middle >> 32);
+#endif // defined(_MSC_VER) && defined(_M_X64)
+        High_ = High + LowHigh;
+        Low_  = Low;
+#endif // defined(NPGS_NATIVE_UINT128)
+        return *this;
+    }
+
+    NPGS_INLINE FUint128& FUint128::operator/=(const FUint128& Other)
+    {
+        FUint128 Remainder;
+        DivideModulo(*this, Other, *this, Remainder);
+        return *this;
+    }
+
+    NPGS_INLINE FUint128& FUint128::operator%=(const FUint128& Other)
+    {
+        FUint128 Quotient;
+        DivideModulo(*this, Other, Quotient, *this);
+        return *this;
+    }
+
+    constexpr FUint128 operator+(FUint128 Lhs, const FUint128& Rhs)
+    {
+        return Lhs += Rhs;
+    }
+
+    constexpr FUint128 operator-(FUint128 Lhs, const FUint128& Rhs)
+    {
+        return Lhs -= Rhs;
+    }
+
+    NPGS_INLINE FUint128 operator*(FUint128 Lhs, const FUint128& Rhs)
+    {
+        return Lhs *= Rhs;
+    }
+
+    NPGS_INLINE FUint128 operator/(FUint128 Lhs, const FUint128& Rhs)
+    {
+        return Lhs /= Rhs;
+    }
+
+    NPGS_INLINE FUint128 operator%(FUint128 Lhs, const FUint128& Rhs)
+    {
+        return Lhs %= Rhs;
+    }
+
+    NPGS_INLINE std::uint64_t FUint128::DivideWord(std::uint64_t High, std::uint64_t Low, std::uint64_t Divisor, std::uint64_t& Remainder)
+    {
+        // 要求 High < Divisor，商不超过 64 位
+#if defined(_MSC_VER) && defined(_M_X64)
+        return _udiv128(High, Low, Divisor, &Remainder);
+#else
+        // Hacker's Delight divlu：除数规格化后以 32 位为一位做两轮试商
+        constexpr std::uint64_t kBase = 1ull << 32;
+
+        int Shift = std::countl_zero(Divisor);
+        Divisor <<= Shift;
+        High = Shift == 0 ? High : (High << Shift) | (Low >> (64 - Shift));
+        Low <<= Shift;
+
+        std::uint64_t DivisorHigh = Divisor >> 32;
+        std::uint64_t DivisorLow  = Divisor & 0xFFFFFFFF;
+        std::uint64_t LowHigh     = Low >> 32;
+        std::uint64_t LowLow      = Low & 0xFFFFFFFF;
+
+        auto EstimateDigit = [&](std::uint64_t Numerator, std::uint64_t NextDigit) -> std::uint64_t
+        {
+            std::uint64_t Digit = Numerator / DivisorHigh;
+            std::uint64_t Rest  = Numerator - Digit * DivisorHigh;
+            while (Digit >= kBase || Digit * DivisorLow > kBase * Rest + NextDigit)
+            {
+                --Digit;
+                Rest += DivisorHigh;
+                if (Rest >= kBase)
+                {
+                    break;
+                }
+            }
+
+            return Digit;
+        };
+
+        std::uint64_t Digit1 = EstimateDigit(High, LowHigh);
+        std::uint64_t Middle = High * kBase + LowHigh - Digit1 * Divisor;
+        std::uint64_t Digit0 = EstimateDigit(Middle, LowLow);
+
+        Remainder = (Middle * kBase + LowLow - Digit0 * Divisor) >> Shift;
+        return Digit1 * kBase + Digit0;
+#endif // defined(_MSC_VER) && defined(_M_X64)
+    }
+
+    NPGS_INLINE void FUint128::DivideModulo(const FUint128& Dividend, const FUint128& Divisor, FUint128& Quotient, FUint128& Remainder)
+    {
+        NpgsAssert(Divisor != FUint128(0), "Division by zero.");
+
+#if defined(NPGS_NATIVE_UINT128)
+        unsigned __int128 Lhs = (static_cast<unsigned __int128>(Dividend.High_) << 64) | Dividend.Low_;
+        unsigned __int128 Rhs = (static_cast<unsigned __int128>(Divisor.High_)  << 64) | Divisor.Low_;
+        unsigned __int128 Div = Lhs / Rhs;
+        unsigned __int128 Mod = Lhs % Rhs;
+
+        Quotient  = FUint128(static_cast<std::uint64_t>(Div >> 64), static_cast<std::uint64_t>(Div));
+        Remainder = FUint128(static_cast<std::uint64_t>(Mod >> 64), static_cast<std::uint64_t>(Mod));
+#else
+        if (Divisor > Dividend)
+        {
+            Remainder = Dividend;
+            Quotient  = FUint128();
+            return;
+        }
+
+        // 质量按比例拆分时除数几乎都在 64 位以内，逐字相除即可
+        if (Divisor.High_ == 0)
+        {
+            std::uint64_t Modulo = 0;
+            std::uint64_t High   = DivideWord(0, Dividend.High_, Divisor.Low_, Modulo);
+            std::uint64_t Low    = DivideWord(Modulo, Dividend.Low_, Divisor.Low_, Modulo);
+
+            Quotient  = FUint128(High, Low);
+            Remainder = FUint128(Modulo);
+            return;
+        }
+
+        // 移位相减，只需要处理被除数与除数最高位之差的位数
+        auto CountLeadingZeros = [](const FUint128& Value) -> int
+        {
+            return Value.High_ != 0 ? std::countl_zero(Value.High_) : 64 + std::countl_zero(Value.Low_);
+        };
+
+        int Shift = CountLeadingZeros(Divisor) - CountLeadingZeros(Dividend);
+
+        FUint128 ShiftedDivisor = Divisor;
+        for (int i = 0; i != Shift; ++i)
+        {
+            ShiftedDivisor.High_ = (ShiftedDivisor.High_ << 1) | (ShiftedDivisor.Low_ >> 63);
+            ShiftedDivisor.Low_ <<= 1;
+        }
+
+        FUint128 Result;
+        FUint128 Rest = Dividend;
+        for (int i = 0; i <= Shift; ++i)
+        {
+            Result.High_ = (Result.High_ << 1) | (Result.Low_ >> 63);
+            Result.Low_ <<= 1;
+            if (Rest >= ShiftedDivisor)
+            {
+                Rest -= ShiftedDivisor;
+                Result.Low_ |= 1;
+            }
+
+            ShiftedDivisor.Low_  = (ShiftedDivisor.Low_ >> 1) | (ShiftedDivisor.High_ << 63);
+            ShiftedDivisor.High_ >>= 1;
+        }
+
+        Quotient  = Result;
+        Remainder = Rest;
+#endif // defined(NPGS_NATIVE_UINT128)
+    }
+} // namespace Npgs::Math
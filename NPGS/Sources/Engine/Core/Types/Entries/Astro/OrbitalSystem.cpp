@@ -1,6 +1,9 @@
 #include "stdafx.h"
 #include "OrbitalSystem.hpp"
 
+#include <stdexcept>
+#include <utility>
+
 namespace Npgs::Astro
 {
     FBaryCenter::FBaryCenter(glm::vec3 Position, glm::vec2 Normal, std::size_t DistanceRank, const std::string& Name)
@@ -12,157 +15,106 @@ namespace Npgs::Astro
     }
 
     FOrbit::FOrbitalObject::FOrbitalObject()
-        : Object_{}
+        : Index_(0)
         , Type_(EObjectType::kBaryCenter)
     {
     }
 
-    FOrbit::FOrbitalObject::FOrbitalObject(INpgsObject* Object, EObjectType Type)
-        : Type_(Type)
+    FOrbit::FOrbitalObject::FOrbitalObject(EObjectType Type, std::uint32_t Index)
+        : Index_(Index)
+        , Type_(Type)
     {
-        switch (Type)
-        {
-        case EObjectType::kBaryCenter:
-            Object_ = static_cast<FBaryCenter*>(Object);
-            break;
-        case EObjectType::kStar:
-            Object_ = static_cast<AStar*>(Object);
-            break;
-        case EObjectType::kPlanet:
-            Object_ = static_cast<APlanet*>(Object);
-            break;
-        case EObjectType::kAsteroidCluster:
-            Object_ = static_cast<AAsteroidCluster*>(Object);
-            break;
-        case EObjectType::kArtifactCluster:
-            Object_ = static_cast<Intelli::AArtifact*>(Object);
-            break;
-        }
     }
 
     FOrbit::FOrbitalDetails::FOrbitalDetails()
         : Object_{}
-        , HostOrbit_(nullptr)
+        , HostOrbit_(kInvalidIndex)
+        , FirstDirectOrbit_(kInvalidIndex)
+        , NextObject_(kInvalidIndex)
         , InitialTrueAnomaly_(0.0f)
     {
     }
 
-    FOrbit::FOrbitalDetails::FOrbitalDetails(INpgsObject* Object, EObjectType Type, FOrbit* HostOrbit, float InitialTrueAnomaly)
-        : Object_(FOrbitalObject(Object, Type))
+    FOrbit::FOrbitalDetails::FOrbitalDetails(EObjectType Type, std::uint32_t Index, std::uint32_t HostOrbit, float InitialTrueAnomaly)
+        : Object_(Type, Index)
         , HostOrbit_(HostOrbit)
+        , FirstDirectOrbit_(kInvalidIndex)
+        , NextObject_(kInvalidIndex)
         , InitialTrueAnomaly_(InitialTrueAnomaly)
     {
     }
 
-    FOrbit::FOrbitalDetails& FOrbit::FOrbitalDetails::SetOrbitalObject(INpgsObject* Object, EObjectType Type)
+    FOrbitalSystem::FOrbitalSystem(const FBaryCenter& SystemBary)
+        : SystemBary_(SystemBary)
     {
-        switch (Type)
-        {
-        case EObjectType::kBaryCenter:
-            Object_.SetObject(static_cast<FBaryCenter*>(Object));
-            break;
-        case EObjectType::kStar:
-            Object_.SetObject(static_cast<AStar*>(Object));
-            break;
-        case EObjectType::kPlanet:
-            Object_.SetObject(static_cast<APlanet*>(Object));
-            break;
-        case EObjectType::kAsteroidCluster:
-            Object_.SetObject(static_cast<AAsteroidCluster*>(Object));
-            break;
-        case EObjectType::kArtifactCluster:
-            Object_.SetObject(static_cast<Intelli::AArtifact*>(Object));
-            break;
-        default:
-            break;
-        }
+    }
 
-        return *this;
+    std::uint32_t FOrbitalSystem::AddStar(AStar&& Star)
+    {
+        std::uint32_t Index = ToIndex(Stars_.size());
+        Stars_.push_back(std::move(Star));
+        return Index;
     }
 
-    FOrbit& FOrbit::SetParent(INpgsObject* Object, EObjectType Type)
+    std::uint32_t FOrbitalSystem::AddPlanet(APlanet&& Planet)
     {
-        switch (Type)
-        {
-        case EObjectType::kBaryCenter:
-            Parent_.SetObject(static_cast<FBaryCenter*>(Object));
-            break;
-        case EObjectType::kStar:
-            Parent_.SetObject(static_cast<AStar*>(Object));
-            break;
-        case EObjectType::kPlanet:
-            Parent_.SetObject(static_cast<APlanet*>(Object));
-            break;
-        case EObjectType::kAsteroidCluster:
-            Parent_.SetObject(static_cast<AAsteroidCluster*>(Object));
-            break;
-        case EObjectType::kArtifactCluster:
-            Parent_.SetObject(static_cast<Intelli::AArtifact*>(Object));
-            break;
-        default:
-            break;
-        }
+        std::uint32_t Index = ToIndex(Planets_.size());
+        Planets_.push_back(std::move(Planet));
+        return Index;
+    }
 
-        return *this;
+    std::uint32_t FOrbitalSystem::AddAsteroidCluster(AAsteroidCluster&& AsteroidCluster)
+    {
+        std::uint32_t Index = ToIndex(AsteroidClusters_.size());
+        AsteroidClusters_.push_back(std::move(AsteroidCluster));
+        return Index;
     }
 
-    FOrbitalSystem::FOrbitalSystem(const FBaryCenter& SystemBary)
-        : SystemBary_(SystemBary)
+    std::uint32_t FOrbitalSystem::AddOrbit(const FOrbit& Orbit)
     {
+        std::uint32_t Index = ToIndex(Orbits_.size());
+        Orbits_.push_back(Orbit);
+        // 链接只能通过本系统的 Add 函数建立，从别处复制来的轨道不带旧的链接
+        Orbits_.back().FirstObject_ = FOrbit::kInvalidIndex;
+        Orbits_.back().NextSibling_ = FOrbit::kInvalidIndex;
+        return Index;
     }
 
-    FOrbitalSystem::FOrbitalSystem(const FOrbitalSystem& Other)
-        : SystemBary_(Other.SystemBary_)
+    std::uint32_t FOrbitalSystem::AddOrbitalObject(std::uint32_t OrbitIndex, FOrbit::EObjectType Type,
+                                                   std::uint32_t ObjectIndex, float InitialTrueAnomaly)
     {
-        for (const auto& Star : Other.Stars_)
-        {
-            Stars_.push_back(std::make_unique<AStar>(*Star));
-        }
-        for (const auto& Planet : Other.Planets_)
-        {
-            Planets_.push_back(std::make_unique<APlanet>(*Planet));
-        }
-        for (const auto& AsteroidCluster : Other.AsteroidClusters_)
+        std::uint32_t DetailsIndex = ToIndex(OrbitalDetails_.size());
+        OrbitalDetails_.emplace_back(Type, ObjectIndex, OrbitIndex, InitialTrueAnomaly);
+
+        // 接到链表末尾，保持天体放上轨道的顺序
+        std::uint32_t* Next = &Orbits_[OrbitIndex].FirstObject_;
+        while (*Next != FOrbit::kInvalidIndex)
         {
-            AsteroidClusters_.push_back(std::make_unique<AAsteroidCluster>(*AsteroidCluster));
+            Next = &OrbitalDetails_[*Next].NextObject_;
         }
-        for (const auto& Orbit : Other.Orbits_)
+
+        *Next = DetailsIndex;
+        return DetailsIndex;
+    }
+
+    void FOrbitalSystem::AddDirectOrbit(std::uint32_t DetailsIndex, std::uint32_t OrbitIndex)
+    {
+        std::uint32_t* Next = &OrbitalDetails_[DetailsIndex].FirstDirectOrbit_;
+        while (*Next != FOrbit::kInvalidIndex)
         {
-            Orbits_.push_back(std::make_unique<FOrbit>(*Orbit));
+            Next = &Orbits_[*Next].NextSibling_;
         }
+
+        *Next = OrbitIndex;
     }
 
-    FOrbitalSystem& FOrbitalSystem::operator=(const FOrbitalSystem& Other)
+    std::uint32_t FOrbitalSystem::ToIndex(std::size_t Size)
     {
-        if (this != &Other)
+        if (Size >= FOrbit::kInvalidIndex)
         {
-            SystemBary_ = Other.SystemBary_;
-
-            Stars_.clear();
-            for (const auto& Star : Other.Stars_)
-            {
-                Stars_.push_back(std::make_unique<AStar>(*Star));
-            }
-
-            Planets_.clear();
-            for (const auto& Planet : Other.Planets_)
-            {
-                Planets_.push_back(std::make_unique<APlanet>(*Planet));
-            }
-
-            AsteroidClusters_.clear();
-            for (const auto& AsteroidCluster : Other.AsteroidClusters_)
-            {
-                AsteroidClusters_.push_back(std::make_unique<AAsteroidCluster>(*AsteroidCluster));
-            }
-
-            Orbits_.clear();
-            for (const auto& Orbit : Other.Orbits_)
-            {
-                Orbits_.push_back(std::make_unique<FOrbit>(*Orbit));
-            }
+            throw std::runtime_error("Orbital system element count exceeds 32-bit index range.");
         }
 
-        return *this;
+        return static_cast<std::uint32_t>(Size);
     }
 } // namespace Npgs::Astro
@@ -2,10 +2,9 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <memory>
+#include <limits>
 #include <string>
 #include <type_traits>
-#include <variant>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -32,8 +31,6 @@ namespace Npgs::Astro
     class FOrbit
     {
     public:
-        using FObjectPointer = std::variant<FBaryCenter*, AStar*, APlanet*, AAsteroidCluster*, Intelli::AArtifact*>;
-
         enum class EObjectType : std::uint8_t
         {
             kBaryCenter,
@@ -43,6 +40,9 @@ namespace Npgs::Astro
             kArtifactCluster
         };
 
+        // 轨道和天体之间互相用所属系统内数组的 32 位序号引用，系统整体复制或移动时无需修正
+        static constexpr std::uint32_t kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
         struct FKeplerElements
         {
             float SemiMajorAxis{};            // 半长轴，单位 AU
@@ -57,43 +57,40 @@ namespace Npgs::Astro
         {
         public:
             FOrbitalObject();
-            FOrbitalObject(INpgsObject* Object, EObjectType Type);
-
-            template <typename ObjectType>
-            requires std::is_class_v<ObjectType>
-            ObjectType* GetObject() const;
-
-            template <typename ObjectType>
-            requires std::is_class_v<ObjectType>
-            FOrbitalObject& SetObject(ObjectType* Object);
+            FOrbitalObject(EObjectType Type, std::uint32_t Index);
 
             EObjectType GetObjectType() const;
+            std::uint32_t GetIndex() const;
 
         private:
-            FObjectPointer Object_; // 指向天体数组中该天体的指针
-            EObjectType    Type_;   // 天体类型，用于区分 union
+            std::uint32_t Index_; // 天体在系统对应数组中的序号，质心为 0
+            EObjectType   Type_;  // 天体类型，决定序号对应的数组
         };
 
         class FOrbitalDetails // 轨道信息
         {
         public:
             FOrbitalDetails();
-            FOrbitalDetails(INpgsObject* Object, EObjectType Type, FOrbit* HostOrbit, float InitialTrueAnomaly = 0.0f);
+            FOrbitalDetails(EObjectType Type, std::uint32_t Index, std::uint32_t HostOrbit, float InitialTrueAnomaly = 0.0f);
 
-            FOrbit* GetHostOrbit();
-            FOrbitalDetails& SetHostOrbit(FOrbit* HostOrbit);
-            FOrbitalObject& GetOrbitalObject();
-            FOrbitalDetails& SetOrbitalObject(INpgsObject* Object, EObjectType Type);
+            std::uint32_t GetHostOrbit() const;
+            FOrbitalDetails& SetHostOrbit(std::uint32_t HostOrbit);
+            const FOrbitalObject& GetOrbitalObject() const;
+            FOrbitalDetails& SetOrbitalObject(EObjectType Type, std::uint32_t Index);
             float GetInitialTrueAnomaly() const;
             FOrbitalDetails& SetInitialTrueAnomaly(float InitialTrueAnomaly);
 
-            std::vector<FOrbit*>& DirectOrbitsData();
+            std::uint32_t GetFirstDirectOrbit() const;
+            std::uint32_t GetNextObject() const;
 
         private:
-            std::vector<FOrbit*> DirectOrbits_;       // 直接下级轨道
-            FOrbitalObject       Object_;             // 天体信息
-            FOrbit*              HostOrbit_;          // 所在轨道
-            float                InitialTrueAnomaly_; // 初始真近点角，单位 rad
+            friend class FOrbitalSystem;
+
+            FOrbitalObject Object_;             // 天体信息
+            std::uint32_t  HostOrbit_;          // 所在轨道
+            std::uint32_t  FirstDirectOrbit_;   // 第一条直接下级轨道，其余沿 FOrbit::NextSibling_ 串联
+            std::uint32_t  NextObject_;         // 同一轨道上的下一个天体
+            float          InitialTrueAnomaly_; // 初始真近点角，单位 rad
         };
 
     public:
@@ -110,22 +107,31 @@ namespace Npgs::Astro
         float GetTrueAnomaly() const;
         FOrbit& SetTrueAnomaly(float TrueAnomaly);
         const FOrbitalObject& GetParent() const;
-        FOrbit& SetParent(INpgsObject* Object, EObjectType Type);
+        FOrbit& SetParent(EObjectType Type, std::uint32_t Index);
         glm::vec2 GetNormal() const;
         FOrbit& SetNormal(glm::vec2 Normal);
         float GetPeriod() const;
         FOrbit& SetPeriod(float Period);
 
-        std::vector<FOrbitalDetails>& ObjectsData();
+        std::uint32_t GetFirstObject() const;
+        std::uint32_t GetNextSibling() const;
 
     private:
-        std::vector<FOrbitalDetails> Objects_;  // 每条轨道信息，上有存储的天体
-        FKeplerElements              OrbitElements_;
-        FOrbitalObject               Parent_;   // 上级天体
-        glm::vec2                    Normal_{}; // 轨道法向量 (theta, phi)
-        float                        Period_{}; // 轨道周期，单位 s
+        friend class FOrbitalSystem;
+
+        FKeplerElements OrbitElements_;
+        FOrbitalObject  Parent_;                       // 上级天体
+        glm::vec2       Normal_{};                     // 轨道法向量 (theta, phi)
+        float           Period_{};                     // 轨道周期，单位 s
+        std::uint32_t   FirstObject_{ kInvalidIndex }; // 轨道上第一个天体的轨道信息序号
+        std::uint32_t   NextSibling_{ kInvalidIndex }; // 同一天体的下一条直接下级轨道
     };
 
+    // 轨道层级只由序号组成，轨道与轨道信息数组的复制和扩容退化为整块内存拷贝
+    static_assert(std::is_trivially_copyable_v<FOrbit>);
+    static_assert(std::is_trivially_copyable_v<FOrbit::FOrbitalDetails>);
+
+    // 轨道系统，每种天体各占一段连续数组，轨道信息也集中存放在一个数组里，层级关系全部用序号表示
     class FOrbitalSystem : public INpgsObject
     {
     public:
@@ -134,11 +140,11 @@ namespace Npgs::Astro
 
         FOrbitalSystem()                          = default;
         FOrbitalSystem(const FBaryCenter& SystemBary);
-        FOrbitalSystem(const FOrbitalSystem& Other);
+        FOrbitalSystem(const FOrbitalSystem&)     = default;
         FOrbitalSystem(FOrbitalSystem&&) noexcept = default;
         ~FOrbitalSystem()                         = default;
 
-        FOrbitalSystem& operator=(const FOrbitalSystem& Other);
+        FOrbitalSystem& operator=(const FOrbitalSystem&)     = default;
         FOrbitalSystem& operator=(FOrbitalSystem&&) noexcept = default;
 
         FOrbitalSystem& SetBaryPosition(glm::vec3 Poisition);
@@ -151,18 +157,53 @@ namespace Npgs::Astro
         std::size_t GetBaryDistanceRank() const;
         const std::string& GetBaryName() const;
 
+        // 以下添加函数均返回新元素的序号
+        std::uint32_t AddStar(AStar&& Star);
+        std::uint32_t AddPlanet(APlanet&& Planet);
+        std::uint32_t AddAsteroidCluster(AAsteroidCluster&& AsteroidCluster);
+        std::uint32_t AddOrbit(const FOrbit& Orbit);
+        // 把天体放到轨道上，接在该轨道已有天体之后，返回轨道信息序号
+        std::uint32_t AddOrbitalObject(std::uint32_t OrbitIndex, FOrbit::EObjectType Type,
+                                       std::uint32_t ObjectIndex, float InitialTrueAnomaly = 0.0f);
+        // 把轨道接到某条轨道信息所代表的天体下，作为其直接下级轨道
+        void AddDirectOrbit(std::uint32_t DetailsIndex, std::uint32_t OrbitIndex);
+
+        template <typename ObjectType>
+        requires std::is_class_v<ObjectType>
+        ObjectType* GetObject(const FOrbit::FOrbitalObject& Object);
+
+        template <typename ObjectType>
+        requires std::is_class_v<ObjectType>
+        const ObjectType* GetObject(const FOrbit::FOrbitalObject& Object) const;
+
+        template <typename Func>
+        void ForEachOrbitalObject(std::uint32_t OrbitIndex, Func&& Function) const;
+
+        template <typename Func>
+        void ForEachDirectOrbit(std::uint32_t DetailsIndex, Func&& Function) const;
+
         FBaryCenter* GetBaryCenter();
-        std::vector<std::unique_ptr<Astro::AStar>>& StarsData();
-        std::vector<std::unique_ptr<Astro::APlanet>>& PlanetsData();
-        std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClustersData();
-        std::vector<std::unique_ptr<FOrbit>>& OrbitsData();
+        std::vector<AStar>& StarsData();
+        const std::vector<AStar>& StarsData() const;
+        std::vector<APlanet>& PlanetsData();
+        const std::vector<APlanet>& PlanetsData() const;
+        std::vector<AAsteroidCluster>& AsteroidClustersData();
+        const std::vector<AAsteroidCluster>& AsteroidClustersData() const;
+        std::vector<FOrbit>& OrbitsData();
+        const std::vector<FOrbit>& OrbitsData() const;
+        std::vector<FOrbit::FOrbitalDetails>& OrbitalDetailsData();
+        const std::vector<FOrbit::FOrbitalDetails>& OrbitalDetailsData() const;
+
+    private:
+        static std::uint32_t ToIndex(std::size_t Size);
 
     private:
-        FBaryCenter                                           SystemBary_;
-        std::vector<std::unique_ptr<Astro::AStar>>            Stars_;
-        std::vector<std::unique_ptr<Astro::APlanet>>          Planets_;
-        std::vector<std::unique_ptr<Astro::AAsteroidCluster>> AsteroidClusters_;
-        std::vector<std::unique_ptr<FOrbit>>                  Orbits_;
+        FBaryCenter                          SystemBary_;
+        std::vector<AStar>                   Stars_;
+        std::vector<APlanet>                 Planets_;
+        std::vector<AAsteroidCluster>        AsteroidClusters_;
+        std::vector<FOrbit>                  Orbits_;
+        std::vector<FOrbit::FOrbitalDetails> OrbitalDetails_;
     };
 } // namespace Npgs::Astro
 
@@ -1,72 +1,43 @@
 #include "OrbitalSystem.hpp"
 
 #include <utility>
+#include "Engine/Core/Base/Assert.hpp"
 #include "Engine/Core/Base/Base.hpp"
 
 namespace Npgs::Astro
 {
-    template <typename ObjectType>
-    requires std::is_class_v<ObjectType>
-    ObjectType* FOrbit::FOrbitalObject::GetObject() const
-    {
-        static_assert(std::is_same_v<ObjectType, FBaryCenter>      ||
-                      std::is_same_v<ObjectType, AStar>            ||
-                      std::is_same_v<ObjectType, APlanet>          ||
-                      std::is_same_v<ObjectType, AAsteroidCluster> ||
-                      std::is_same_v<ObjectType, Intelli::AArtifact>,
-                      "Invalid object type for SetObject");
-
-        return std::get<ObjectType*>(Object_);
-    }
-
-    template <typename ObjectType>
-    requires std::is_class_v<ObjectType>
-    FOrbit::FOrbitalObject& FOrbit::FOrbitalObject::SetObject(ObjectType* Object)
+    NPGS_INLINE FOrbit::EObjectType FOrbit::FOrbitalObject::GetObjectType() const
     {
-        static_assert(std::is_same_v<ObjectType, FBaryCenter>      ||
-                      std::is_same_v<ObjectType, AStar>            ||
-                      std::is_same_v<ObjectType, APlanet>          ||
-                      std::is_same_v<ObjectType, AAsteroidCluster> ||
-                      std::is_same_v<ObjectType, Intelli::AArtifact>,
-                      "Invalid object type for SetObject");
-
-        Object_ = Object;
-
-        if constexpr (std::is_same_v<ObjectType, FBaryCenter>)
-            Type_ = EObjectType::kBaryCenter;
-        else if constexpr (std::is_same_v<ObjectType, AStar>)
-            Type_ = EObjectType::kStar;
-        else if constexpr (std::is_same_v<ObjectType, APlanet>)
-            Type_ = EObjectType::kPlanet;
-        else if constexpr (std::is_same_v<ObjectType, AAsteroidCluster>)
-            Type_ = EObjectType::kAsteroidCluster;
-        else if constexpr (std::is_same_v<ObjectType, Intelli::AArtifact>)
-            Type_ = EObjectType::kArtifactCluster;
-
-        return *this;
+        return Type_;
     }
 
-    NPGS_INLINE FOrbit::EObjectType FOrbit::FOrbitalObject::GetObjectType() const
+    NPGS_INLINE std::uint32_t FOrbit::FOrbitalObject::GetIndex() const
     {
-        return Type_;
+        return Index_;
     }
 
-    NPGS_INLINE FOrbit* FOrbit::FOrbitalDetails::GetHostOrbit()
+    NPGS_INLINE std::uint32_t FOrbit::FOrbitalDetails::GetHostOrbit() const
     {
         return HostOrbit_;
     }
 
-    NPGS_INLINE FOrbit::FOrbitalDetails& FOrbit::FOrbitalDetails::SetHostOrbit(FOrbit* HostFOrbit)
+    NPGS_INLINE FOrbit::FOrbitalDetails& FOrbit::FOrbitalDetails::SetHostOrbit(std::uint32_t HostOrbit)
     {
-        HostOrbit_ = HostFOrbit;
+        HostOrbit_ = HostOrbit;
         return *this;
     }
 
-    NPGS_INLINE FOrbit::FOrbitalObject& FOrbit::FOrbitalDetails::GetOrbitalObject()
+    NPGS_INLINE const FOrbit::FOrbitalObject& FOrbit::FOrbitalDetails::GetOrbitalObject() const
     {
         return Object_;
     }
 
+    NPGS_INLINE FOrbit::FOrbitalDetails& FOrbit::FOrbitalDetails::SetOrbitalObject(EObjectType Type, std::uint32_t Index)
+    {
+        Object_ = FOrbitalObject(Type, Index);
+        return *this;
+    }
+
     NPGS_INLINE float FOrbit::FOrbitalDetails::GetInitialTrueAnomaly() const
     {
         return InitialTrueAnomaly_;
@@ -78,9 +49,14 @@ namespace Npgs::Astro
         return *this;
     }
 
-    NPGS_INLINE std::vector<FOrbit*>& FOrbit::FOrbitalDetails::DirectOrbitsData()
+    NPGS_INLINE std::uint32_t FOrbit::FOrbitalDetails::GetFirstDirectOrbit() const
+    {
+        return FirstDirectOrbit_;
+    }
+
+    NPGS_INLINE std::uint32_t FOrbit::FOrbitalDetails::GetNextObject() const
     {
-        return DirectOrbits_;
+        return NextObject_;
     }
 
     NPGS_INLINE float FOrbit::GetSemiMajorAxis() const
@@ -154,6 +130,12 @@ namespace Npgs::Astro
         return Parent_;
     }
 
+    NPGS_INLINE FOrbit& FOrbit::SetParent(EObjectType Type, std::uint32_t Index)
+    {
+        Parent_ = FOrbitalObject(Type, Index);
+        return *this;
+    }
+
     NPGS_INLINE glm::vec2 FOrbit::GetNormal() const
     {
         return Normal_;
@@ -176,9 +158,14 @@ namespace Npgs::Astro
         return *this;
     }
 
-    NPGS_INLINE std::vector<FOrbit::FOrbitalDetails>& FOrbit::ObjectsData()
+    NPGS_INLINE std::uint32_t FOrbit::GetFirstObject() const
     {
-        return Objects_;
+        return FirstObject_;
+    }
+
+    NPGS_INLINE std::uint32_t FOrbit::GetNextSibling() const
+    {
+        return NextSibling_;
     }
 
     NPGS_INLINE FOrbitalSystem& FOrbitalSystem::SetBaryPosition(glm::vec3 Position)
@@ -225,28 +212,117 @@ namespace Npgs::Astro
         return SystemBary_.Name;
     }
 
+    template <typename ObjectType>
+    requires std::is_class_v<ObjectType>
+    ObjectType* FOrbitalSystem::GetObject(const FOrbit::FOrbitalObject& Object)
+    {
+        return const_cast<ObjectType*>(std::as_const(*this).GetObject<ObjectType>(Object));
+    }
+
+    template <typename ObjectType>
+    requires std::is_class_v<ObjectType>
+    const ObjectType* FOrbitalSystem::GetObject(const FOrbit::FOrbitalObject& Object) const
+    {
+        static_assert(std::is_same_v<ObjectType, FBaryCenter> ||
+                      std::is_same_v<ObjectType, AStar>       ||
+                      std::is_same_v<ObjectType, APlanet>     ||
+                      std::is_same_v<ObjectType, AAsteroidCluster>,
+                      "Invalid object type for GetObject");
+
+        if constexpr (std::is_same_v<ObjectType, FBaryCenter>)
+        {
+            NpgsAssert(Object.GetObjectType() == FOrbit::EObjectType::kBaryCenter, "Object type mismatch.");
+            return &SystemBary_;
+        }
+        else if constexpr (std::is_same_v<ObjectType, AStar>)
+        {
+            NpgsAssert(Object.GetObjectType() == FOrbit::EObjectType::kStar, "Object type mismatch.");
+            return &Stars_[Object.GetIndex()];
+        }
+        else if constexpr (std::is_same_v<ObjectType, APlanet>)
+        {
+            NpgsAssert(Object.GetObjectType() == FOrbit::EObjectType::kPlanet, "Object type mismatch.");
+            return &Planets_[Object.GetIndex()];
+        }
+        else
+        {
+            NpgsAssert(Object.GetObjectType() == FOrbit::EObjectType::kAsteroidCluster, "Object type mismatch.");
+            return &AsteroidClusters_[Object.GetIndex()];
+        }
+    }
+
+    template <typename Func>
+    void FOrbitalSystem::ForEachOrbitalObject(std::uint32_t OrbitIndex, Func&& Function) const
+    {
+        for (std::uint32_t DetailsIndex = Orbits_[OrbitIndex].FirstObject_;
+             DetailsIndex != FOrbit::kInvalidIndex; DetailsIndex = OrbitalDetails_[DetailsIndex].NextObject_)
+        {
+            Function(DetailsIndex);
+        }
+    }
+
+    template <typename Func>
+    void FOrbitalSystem::ForEachDirectOrbit(std::uint32_t DetailsIndex, Func&& Function) const
+    {
+        for (std::uint32_t OrbitIndex = OrbitalDetails_[DetailsIndex].FirstDirectOrbit_;
+             OrbitIndex != FOrbit::kInvalidIndex; OrbitIndex = Orbits_[OrbitIndex].NextSibling_)
+        {
+            Function(OrbitIndex);
+        }
+    }
+
     NPGS_INLINE FBaryCenter* FOrbitalSystem::GetBaryCenter()
     {
         return &SystemBary_;
     }
 
-    NPGS_INLINE std::vector<std::unique_ptr<Astro::AStar>>& FOrbitalSystem::StarsData()
+    NPGS_INLINE std::vector<AStar>& FOrbitalSystem::StarsData()
+    {
+        return Stars_;
+    }
+
+    NPGS_INLINE const std::vector<AStar>& FOrbitalSystem::StarsData() const
     {
         return Stars_;
     }
 
-    NPGS_INLINE std::vector<std::unique_ptr<Astro::APlanet>>& FOrbitalSystem::PlanetsData()
+    NPGS_INLINE std::vector<APlanet>& FOrbitalSystem::PlanetsData()
     {
         return Planets_;
     }
 
-    NPGS_INLINE std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& FOrbitalSystem::AsteroidClustersData()
+    NPGS_INLINE const std::vector<APlanet>& FOrbitalSystem::PlanetsData() const
+    {
+        return Planets_;
+    }
+
+    NPGS_INLINE std::vector<AAsteroidCluster>& FOrbitalSystem::AsteroidClustersData()
     {
         return AsteroidClusters_;
     }
 
-    NPGS_INLINE std::vector<std::unique_ptr<FOrbit>>& FOrbitalSystem::OrbitsData()
+    NPGS_INLINE const std::vector<AAsteroidCluster>& FOrbitalSystem::AsteroidClustersData() const
+    {
+        return AsteroidClusters_;
+    }
+
+    NPGS_INLINE std::vector<FOrbit>& FOrbitalSystem::OrbitsData()
+    {
+        return Orbits_;
+    }
+
+    NPGS_INLINE const std::vector<FOrbit>& FOrbitalSystem::OrbitsData() const
     {
         return Orbits_;
     }
+
+    NPGS_INLINE std::vector<FOrbit::FOrbitalDetails>& FOrbitalSystem::OrbitalDetailsData()
+    {
+        return OrbitalDetails_;
+    }
+
+    NPGS_INLINE const std::vector<FOrbit::FOrbitalDetails>& FOrbitalSystem::OrbitalDetailsData() const
+    {
+        return OrbitalDetails_;
+    }
 } // namespace Npgs::Astro
@@ -3,7 +3,7 @@
 #include <cstdint>
 #include <memory>
 
-#include <boost/multiprecision/cpp_int.hpp>
+#include "Engine/Core/Math/Uint128.hpp"
 #include "Engine/Core/Types/Entries/Astro/CelestialObject.hpp"
 #include "Engine/Core/Types/Properties/Intelli/Civilization.hpp"
 
@@ -11,9 +11,9 @@ namespace Npgs::Astro
 {
     struct FComplexMass
     {
-        boost::multiprecision::uint128_t Z;
-        boost::multiprecision::uint128_t Volatiles;
-        boost::multiprecision::uint128_t EnergeticNuclide;
+        Math::FUint128 Z;
+        Math::FUint128 Volatiles;
+        Math::FUint128 EnergeticNuclide;
     };
 
     class APlanet : public FCelestialBody
@@ -42,7 +42,7 @@ namespace Npgs::Astro
             FComplexMass                        AtmosphereMass;              // 大气层质量，单位 kg
             FComplexMass                        CoreMass;                    // 核心质量，单位 kg
             FComplexMass                        OceanMass;                   // 海洋质量，单位 kg
-            boost::multiprecision::uint128_t    CrustMineralMass;            // 地壳矿脉质量，单位 kg
+            Math::FUint128                      CrustMineralMass;            // 地壳矿脉质量，单位 kg
             std::unique_ptr<Intelli::FStandard> CivilizationData;            // 文明数据
             float                               BalanceTemperature{};        // 平衡温度，单位 K
             EPlanetType                         Type{ EPlanetType::kRocky }; // 行星类型
@@ -72,7 +72,7 @@ namespace Npgs::Astro
         APlanet& SetCoreMass(FComplexMass CoreMass);
         APlanet& SetOceanMass(FComplexMass OceanMass);
         APlanet& SetCrustMineralMass(float CrustMineralMass);
-        APlanet& SetCrustMineralMass(boost::multiprecision::uint128_t CrustMineralMass);
+        APlanet& SetCrustMineralMass(Math::FUint128 CrustMineralMass);
         APlanet& SetCivilizationData(std::unique_ptr<Intelli::FStandard>&& CivilizationData);
         APlanet& SetBalanceTemperature(float BalanceTemperature);
         APlanet& SetMigration(bool bIsMigrated);
@@ -81,47 +81,47 @@ namespace Npgs::Astro
         // Setters for every mass property
         // -------------------------------
         APlanet& SetAtmosphereMassZ(float AtmosphereMassZ);
-        APlanet& SetAtmosphereMassZ(boost::multiprecision::uint128_t AtmosphereMassZ);
+        APlanet& SetAtmosphereMassZ(Math::FUint128 AtmosphereMassZ);
         APlanet& SetAtmosphereMassVolatiles(float AtmosphereMassVolatiles);
-        APlanet& SetAtmosphereMassVolatiles(boost::multiprecision::uint128_t AtmosphereMassVolatiles);
+        APlanet& SetAtmosphereMassVolatiles(Math::FUint128 AtmosphereMassVolatiles);
         APlanet& SetAtmosphereMassEnergeticNuclide(float AtmosphereMassEnergeticNuclide);
-        APlanet& SetAtmosphereMassEnergeticNuclide(boost::multiprecision::uint128_t AtmosphereMassEnergeticNuclide);
+        APlanet& SetAtmosphereMassEnergeticNuclide(Math::FUint128 AtmosphereMassEnergeticNuclide);
         APlanet& SetCoreMassZ(float CoreMassZ);
-        APlanet& SetCoreMassZ(boost::multiprecision::uint128_t CoreMassZ);
+        APlanet& SetCoreMassZ(Math::FUint128 CoreMassZ);
         APlanet& SetCoreMassVolatiles(float CoreMassVolatiles);
-        APlanet& SetCoreMassVolatiles(boost::multiprecision::uint128_t CoreMassVolatiles);
+        APlanet& SetCoreMassVolatiles(Math::FUint128 CoreMassVolatiles);
         APlanet& SetCoreMassEnergeticNuclide(float CoreMassEnergeticNuclide);
-        APlanet& SetCoreMassEnergeticNuclide(boost::multiprecision::uint128_t CoreMassEnergeticNuclide);
+        APlanet& SetCoreMassEnergeticNuclide(Math::FUint128 CoreMassEnergeticNuclide);
         APlanet& SetOceanMassZ(float OceanMassZ);
-        APlanet& SetOceanMassZ(boost::multiprecision::uint128_t OceanMassZ);
+        APlanet& SetOceanMassZ(Math::FUint128 OceanMassZ);
         APlanet& SetOceanMassVolatiles(float OceanMassVolatiles);
-        APlanet& SetOceanMassVolatiles(boost::multiprecision::uint128_t OceanMassVolatiles);
+        APlanet& SetOceanMassVolatiles(Math::FUint128 OceanMassVolatiles);
         APlanet& SetOceanMassEnergeticNuclide(float OceanMassEnergeticNuclide);
-        APlanet& SetOceanMassEnergeticNuclide(boost::multiprecision::uint128_t OceanMassEnergeticNuclide);
+        APlanet& SetOceanMassEnergeticNuclide(Math::FUint128 OceanMassEnergeticNuclide);
 
         // Getters
         // Getters for ExtendedProperties
         // ------------------------------
-        const FComplexMass&                     GetAtmosphereMassStruct() const;
-        const boost::multiprecision::uint128_t  GetAtmosphereMass() const;
-        const boost::multiprecision::uint128_t& GetAtmosphereMassZ() const;
-        const boost::multiprecision::uint128_t& GetAtmosphereMassVolatiles() const;
-        const boost::multiprecision::uint128_t& GetAtmosphereMassEnergeticNuclide() const;
-        const FComplexMass&                     GetCoreMassStruct() const;
-        const boost::multiprecision::uint128_t  GetCoreMass() const;
-        const boost::multiprecision::uint128_t& GetCoreMassZ() const;
-        const boost::multiprecision::uint128_t& GetCoreMassVolatiles() const;
-        const boost::multiprecision::uint128_t& GetCoreMassEnergeticNuclide() const;
-        const FComplexMass&                     GetOceanMassStruct() const;
-        const boost::multiprecision::uint128_t  GetOceanMass() const;
-        const boost::multiprecision::uint128_t& GetOceanMassZ() const;
-        const boost::multiprecision::uint128_t& GetOceanMassVolatiles() const;
-        const boost::multiprecision::uint128_t& GetOceanMassEnergeticNuclide() const;
-        const boost::multiprecision::uint128_t  GetMass() const;
-        const boost::multiprecision::uint128_t& GetCrustMineralMass() const;
-        float                                   GetBalanceTemperature() const;
-        bool                                    IsMigrated() const;
-        EPlanetType                             GetPlanetType() const;
+        const FComplexMass&   GetAtmosphereMassStruct() const;
+        const Math::FUint128  GetAtmosphereMass() const;
+        const Math::FUint128& GetAtmosphereMassZ() const;
+        const Math::FUint128& GetAtmosphereMassVolatiles() const;
+        const Math::FUint128& GetAtmosphereMassEnergeticNuclide() const;
+        const FComplexMass&   GetCoreMassStruct() const;
+        const Math::FUint128  GetCoreMass() const;
+        const Math::FUint128& GetCoreMassZ() const;
+        const Math::FUint128& GetCoreMassVolatiles() const;
+        const Math::FUint128& GetCoreMassEnergeticNuclide() const;
+        const FComplexMass&   GetOceanMassStruct() const;
+        const Math::FUint128  GetOceanMass() const;
+        const Math::FUint128& GetOceanMassZ() const;
+        const Math::FUint128& GetOceanMassVolatiles() const;
+        const Math::FUint128& GetOceanMassEnergeticNuclide() const;
+        const Math::FUint128  GetMass() const;
+        const Math::FUint128& GetCrustMineralMass() const;
+        float                 GetBalanceTemperature() const;
+        bool                  IsMigrated() const;
+        EPlanetType           GetPlanetType() const;
 
         template <typename DigitalType>
         DigitalType GetAtmosphereMassDigital() const;
@@ -200,21 +200,21 @@ namespace Npgs::Astro
         // Setters for every mass property
         // -------------------------------
         AAsteroidCluster& SetMassZ(float MassZ);
-        AAsteroidCluster& SetMassZ(boost::multiprecision::uint128_t MassZ);
+        AAsteroidCluster& SetMassZ(Math::FUint128 MassZ);
         AAsteroidCluster& SetMassVolatiles(float MassVolatiles);
-        AAsteroidCluster& SetMassVolatiles(boost::multiprecision::uint128_t MassVolatiles);
+        AAsteroidCluster& SetMassVolatiles(Math::FUint128 MassVolatiles);
         AAsteroidCluster& SetMassEnergeticNuclide(float MassEnergeticNuclide);
-        AAsteroidCluster& SetMassEnergeticNuclide(boost::multiprecision::uint128_t MassEnergeticNuclide);
+        AAsteroidCluster& SetMassEnergeticNuclide(Math::FUint128 MassEnergeticNuclide);
         AAsteroidCluster& SetAsteroidType(EAsteroidType Type);
 
         // Getters
         // Getters for BasicProperties
         // ---------------------------
-        const boost::multiprecision::uint128_t  GetMass() const;
-        const boost::multiprecision::uint128_t& GetMassZ() const;
-        const boost::multiprecision::uint128_t& GetMassVolatiles() const;
-        const boost::multiprecision::uint128_t& GetMassEnergeticNuclide() const;
-        EAsteroidType                           GetAsteroidType() const;
+        const Math::FUint128  GetMass() const;
+        const Math::FUint128& GetMassZ() const;
+        const Math::FUint128& GetMassVolatiles() const;
+        const Math::FUint128& GetMassEnergeticNuclide() const;
+        EAsteroidType         GetAsteroidType() const;
 
         template <typename DigitalType>
         DigitalType GetMassDigital() const;
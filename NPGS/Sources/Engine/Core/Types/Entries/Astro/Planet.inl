@@ -36,11 +36,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetCrustMineralMass(float CrustMineralMass)
     {
-        ExtraProperties_.CrustMineralMass = boost::multiprecision::uint128_t(CrustMineralMass);
+        ExtraProperties_.CrustMineralMass = Math::FUint128(CrustMineralMass);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetCrustMineralMass(boost::multiprecision::uint128_t CrustMineralMass)
+    NPGS_INLINE APlanet& APlanet::SetCrustMineralMass(Math::FUint128 CrustMineralMass)
     {
         ExtraProperties_.CrustMineralMass = std::move(CrustMineralMass);
         return *this;
@@ -72,11 +72,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetAtmosphereMassZ(float AtmosphereMassZ)
     {
-        ExtraProperties_.AtmosphereMass.Z = boost::multiprecision::uint128_t(AtmosphereMassZ);
+        ExtraProperties_.AtmosphereMass.Z = Math::FUint128(AtmosphereMassZ);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassZ(boost::multiprecision::uint128_t AtmosphereMassZ)
+    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassZ(Math::FUint128 AtmosphereMassZ)
     {
         ExtraProperties_.AtmosphereMass.Z = std::move(AtmosphereMassZ);
         return *this;
@@ -84,11 +84,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetAtmosphereMassVolatiles(float AtmosphereMassVolatiles)
     {
-        ExtraProperties_.AtmosphereMass.Volatiles = boost::multiprecision::uint128_t(AtmosphereMassVolatiles);
+        ExtraProperties_.AtmosphereMass.Volatiles = Math::FUint128(AtmosphereMassVolatiles);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassVolatiles(boost::multiprecision::uint128_t AtmosphereMassVolatiles)
+    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassVolatiles(Math::FUint128 AtmosphereMassVolatiles)
     {
         ExtraProperties_.AtmosphereMass.Volatiles = std::move(AtmosphereMassVolatiles);
         return *this;
@@ -96,11 +96,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetAtmosphereMassEnergeticNuclide(float AtmosphereMassEnergeticNuclide)
     {
-        ExtraProperties_.AtmosphereMass.EnergeticNuclide = boost::multiprecision::uint128_t(AtmosphereMassEnergeticNuclide);
+        ExtraProperties_.AtmosphereMass.EnergeticNuclide = Math::FUint128(AtmosphereMassEnergeticNuclide);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassEnergeticNuclide(boost::multiprecision::uint128_t AtmosphereMassEnergeticNuclide)
+    NPGS_INLINE APlanet& APlanet::SetAtmosphereMassEnergeticNuclide(Math::FUint128 AtmosphereMassEnergeticNuclide)
     {
         ExtraProperties_.AtmosphereMass.EnergeticNuclide = std::move(AtmosphereMassEnergeticNuclide);
         return *this;
@@ -108,11 +108,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetCoreMassZ(float CoreMassZ)
     {
-        ExtraProperties_.CoreMass.Z = boost::multiprecision::uint128_t(CoreMassZ);
+        ExtraProperties_.CoreMass.Z = Math::FUint128(CoreMassZ);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetCoreMassZ(boost::multiprecision::uint128_t CoreMassZ)
+    NPGS_INLINE APlanet& APlanet::SetCoreMassZ(Math::FUint128 CoreMassZ)
     {
         ExtraProperties_.CoreMass.Z = std::move(CoreMassZ);
         return *this;
@@ -120,11 +120,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetCoreMassVolatiles(float CoreMassVolatiles)
     {
-        ExtraProperties_.CoreMass.Volatiles = boost::multiprecision::uint128_t(CoreMassVolatiles);
+        ExtraProperties_.CoreMass.Volatiles = Math::FUint128(CoreMassVolatiles);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetCoreMassVolatiles(boost::multiprecision::uint128_t CoreMassVolatiles)
+    NPGS_INLINE APlanet& APlanet::SetCoreMassVolatiles(Math::FUint128 CoreMassVolatiles)
     {
         ExtraProperties_.CoreMass.Volatiles = std::move(CoreMassVolatiles);
         return *this;
@@ -132,11 +132,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetCoreMassEnergeticNuclide(float CoreMassEnergeticNuclide)
     {
-        ExtraProperties_.CoreMass.EnergeticNuclide = boost::multiprecision::uint128_t(CoreMassEnergeticNuclide);
+        ExtraProperties_.CoreMass.EnergeticNuclide = Math::FUint128(CoreMassEnergeticNuclide);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetCoreMassEnergeticNuclide(boost::multiprecision::uint128_t CoreMassEnergeticNuclide)
+    NPGS_INLINE APlanet& APlanet::SetCoreMassEnergeticNuclide(Math::FUint128 CoreMassEnergeticNuclide)
     {
         ExtraProperties_.CoreMass.EnergeticNuclide = std::move(CoreMassEnergeticNuclide);
         return *this;
@@ -144,11 +144,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetOceanMassZ(float OceanMassZ)
     {
-        ExtraProperties_.OceanMass.Z = boost::multiprecision::uint128_t(OceanMassZ);
+        ExtraProperties_.OceanMass.Z = Math::FUint128(OceanMassZ);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetOceanMassZ(boost::multiprecision::uint128_t OceanMassZ)
+    NPGS_INLINE APlanet& APlanet::SetOceanMassZ(Math::FUint128 OceanMassZ)
     {
         ExtraProperties_.OceanMass.Z = std::move(OceanMassZ);
         return *this;
@@ -156,11 +156,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetOceanMassVolatiles(float OceanMassVolatiles)
     {
-        ExtraProperties_.OceanMass.Volatiles = boost::multiprecision::uint128_t(OceanMassVolatiles);
+        ExtraProperties_.OceanMass.Volatiles = Math::FUint128(OceanMassVolatiles);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetOceanMassVolatiles(boost::multiprecision::uint128_t OceanMassVolatiles)
+    NPGS_INLINE APlanet& APlanet::SetOceanMassVolatiles(Math::FUint128 OceanMassVolatiles)
     {
         ExtraProperties_.OceanMass.Volatiles = std::move(OceanMassVolatiles);
         return *this;
@@ -168,11 +168,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE APlanet& APlanet::SetOceanMassEnergeticNuclide(float OceanMassEnergeticNuclide)
     {
-        ExtraProperties_.OceanMass.EnergeticNuclide = boost::multiprecision::uint128_t(OceanMassEnergeticNuclide);
+        ExtraProperties_.OceanMass.EnergeticNuclide = Math::FUint128(OceanMassEnergeticNuclide);
         return *this;
     }
 
-    NPGS_INLINE APlanet& APlanet::SetOceanMassEnergeticNuclide(boost::multiprecision::uint128_t OceanMassEnergeticNuclide)
+    NPGS_INLINE APlanet& APlanet::SetOceanMassEnergeticNuclide(Math::FUint128 OceanMassEnergeticNuclide)
     {
         ExtraProperties_.OceanMass.EnergeticNuclide = std::move(OceanMassEnergeticNuclide);
         return *this;
@@ -183,22 +183,22 @@ namespace Npgs::Astro
         return ExtraProperties_.AtmosphereMass;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t APlanet::GetAtmosphereMass() const
+    NPGS_INLINE const Math::FUint128 APlanet::GetAtmosphereMass() const
     {
         return GetAtmosphereMassZ() + GetAtmosphereMassVolatiles() + GetAtmosphereMassEnergeticNuclide();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetAtmosphereMassZ() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetAtmosphereMassZ() const
     {
         return ExtraProperties_.AtmosphereMass.Z;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetAtmosphereMassVolatiles() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetAtmosphereMassVolatiles() const
     {
         return ExtraProperties_.AtmosphereMass.Volatiles;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetAtmosphereMassEnergeticNuclide() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetAtmosphereMassEnergeticNuclide() const
     {
         return ExtraProperties_.AtmosphereMass.EnergeticNuclide;
     }
@@ -208,22 +208,22 @@ namespace Npgs::Astro
         return ExtraProperties_.CoreMass;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t APlanet::GetCoreMass() const
+    NPGS_INLINE const Math::FUint128 APlanet::GetCoreMass() const
     {
         return GetCoreMassZ() + GetCoreMassVolatiles() + GetCoreMassEnergeticNuclide();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetCoreMassZ() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetCoreMassZ() const
     {
         return ExtraProperties_.CoreMass.Z;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetCoreMassVolatiles() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetCoreMassVolatiles() const
     {
         return ExtraProperties_.CoreMass.Volatiles;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetCoreMassEnergeticNuclide() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetCoreMassEnergeticNuclide() const
     {
         return ExtraProperties_.CoreMass.EnergeticNuclide;
     }
@@ -233,32 +233,32 @@ namespace Npgs::Astro
         return ExtraProperties_.OceanMass;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t APlanet::GetOceanMass() const
+    NPGS_INLINE const Math::FUint128 APlanet::GetOceanMass() const
     {
         return GetOceanMassZ() + GetOceanMassVolatiles() + GetOceanMassEnergeticNuclide();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetOceanMassZ() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetOceanMassZ() const
     {
         return ExtraProperties_.OceanMass.Z;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetOceanMassVolatiles() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetOceanMassVolatiles() const
     {
         return ExtraProperties_.OceanMass.Volatiles;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetOceanMassEnergeticNuclide() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetOceanMassEnergeticNuclide() const
     {
         return ExtraProperties_.OceanMass.EnergeticNuclide;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t APlanet::GetMass() const
+    NPGS_INLINE const Math::FUint128 APlanet::GetMass() const
     {
         return GetAtmosphereMass() + GetOceanMass() + GetCoreMass() + GetCrustMineralMass();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& APlanet::GetCrustMineralMass() const
+    NPGS_INLINE const Math::FUint128& APlanet::GetCrustMineralMass() const
     {
         return ExtraProperties_.CrustMineralMass;
     }
@@ -281,85 +281,85 @@ namespace Npgs::Astro
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetAtmosphereMassDigital() const
     {
-        return GetAtmosphereMass().convert_to<DigitalType>();
+        return GetAtmosphereMass().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetAtmosphereMassZDigital() const
     {
-        return GetAtmosphereMassZ().convert_to<DigitalType>();
+        return GetAtmosphereMassZ().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetAtmosphereMassVolatilesDigital() const
     {
-        return GetAtmosphereMassVolatiles().convert_to<DigitalType>();
+        return GetAtmosphereMassVolatiles().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetAtmosphereMassEnergeticNuclideDigital() const
     {
-        return GetAtmosphereMassEnergeticNuclide().convert_to<DigitalType>();
+        return GetAtmosphereMassEnergeticNuclide().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetCoreMassDigital() const
     {
-        return GetCoreMass().convert_to<DigitalType>();
+        return GetCoreMass().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetCoreMassZDigital() const
     {
-        return GetCoreMassZ().convert_to<DigitalType>();
+        return GetCoreMassZ().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetCoreMassVolatilesDigital() const
     {
-        return GetCoreMassVolatiles().convert_to<DigitalType>();
+        return GetCoreMassVolatiles().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetCoreMassEnergeticNuclideDigital() const
     {
-        return GetCoreMassEnergeticNuclide().convert_to<DigitalType>();
+        return GetCoreMassEnergeticNuclide().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetOceanMassDigital() const
     {
-        return GetOceanMass().convert_to<DigitalType>();
+        return GetOceanMass().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetOceanMassZDigital() const
     {
-        return GetOceanMassZ().convert_to<DigitalType>();
+        return GetOceanMassZ().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetOceanMassVolatilesDigital() const
     {
-        return GetOceanMassVolatiles().convert_to<DigitalType>();
+        return GetOceanMassVolatiles().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetOceanMassEnergeticNuclideDigital() const
     {
-        return GetOceanMassEnergeticNuclide().convert_to<DigitalType>();
+        return GetOceanMassEnergeticNuclide().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetMassDigital() const
     {
-        return GetMass().convert_to<DigitalType>();
+        return GetMass().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType APlanet::GetCrustMineralMassDigital() const
     {
-        return GetCrustMineralMass().convert_to<DigitalType>();
+        return GetCrustMineralMass().ConvertTo<DigitalType>();
     }
 
     NPGS_INLINE Intelli::FStandard& APlanet::CivilizationData()
@@ -375,11 +375,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassZ(float MassZ)
     {
-        Properties_.Mass.Z = boost::multiprecision::uint128_t(MassZ);
+        Properties_.Mass.Z = Math::FUint128(MassZ);
         return *this;
     }
 
-    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassZ(boost::multiprecision::uint128_t MassZ)
+    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassZ(Math::FUint128 MassZ)
     {
         Properties_.Mass.Z = std::move(MassZ);
         return *this;
@@ -387,11 +387,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassVolatiles(float MassVolatiles)
     {
-        Properties_.Mass.Volatiles = boost::multiprecision::uint128_t(MassVolatiles);
+        Properties_.Mass.Volatiles = Math::FUint128(MassVolatiles);
         return *this;
     }
 
-    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassVolatiles(boost::multiprecision::uint128_t MassVolatiles)
+    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassVolatiles(Math::FUint128 MassVolatiles)
     {
         Properties_.Mass.Volatiles = std::move(MassVolatiles);
         return *this;
@@ -399,11 +399,11 @@ namespace Npgs::Astro
 
     NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassEnergeticNuclide(float MassEnergeticNuclide)
     {
-        Properties_.Mass.EnergeticNuclide = boost::multiprecision::uint128_t(MassEnergeticNuclide);
+        Properties_.Mass.EnergeticNuclide = Math::FUint128(MassEnergeticNuclide);
         return *this;
     }
 
-    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassEnergeticNuclide(boost::multiprecision::uint128_t MassEnergeticNuclide)
+    NPGS_INLINE AAsteroidCluster& AAsteroidCluster::SetMassEnergeticNuclide(Math::FUint128 MassEnergeticNuclide)
     {
         Properties_.Mass.EnergeticNuclide = std::move(MassEnergeticNuclide);
         return *this;
@@ -415,22 +415,22 @@ namespace Npgs::Astro
         return *this;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t AAsteroidCluster::GetMass() const
+    NPGS_INLINE const Math::FUint128 AAsteroidCluster::GetMass() const
     {
         return GetMassZ() + GetMassVolatiles() + GetMassEnergeticNuclide();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& AAsteroidCluster::GetMassZ() const
+    NPGS_INLINE const Math::FUint128& AAsteroidCluster::GetMassZ() const
     {
         return Properties_.Mass.Z;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& AAsteroidCluster::GetMassVolatiles() const
+    NPGS_INLINE const Math::FUint128& AAsteroidCluster::GetMassVolatiles() const
     {
         return Properties_.Mass.Volatiles;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& AAsteroidCluster::GetMassEnergeticNuclide() const
+    NPGS_INLINE const Math::FUint128& AAsteroidCluster::GetMassEnergeticNuclide() const
     {
         return Properties_.Mass.EnergeticNuclide;
     }
@@ -443,24 +443,24 @@ namespace Npgs::Astro
     template <typename DigitalType>
     NPGS_INLINE DigitalType AAsteroidCluster::GetMassDigital() const
     {
-        return GetMass().convert_to<DigitalType>();
+        return GetMass().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType AAsteroidCluster::GetMassZDigital() const
     {
-        return GetMassZ().convert_to<DigitalType>();
+        return GetMassZ().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType AAsteroidCluster::GetMassVolatilesDigital() const
     {
-        return GetMassVolatiles().convert_to<DigitalType>();
+        return GetMassVolatiles().ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType AAsteroidCluster::GetMassEnergeticNuclideDigital() const
     {
-        return GetMassEnergeticNuclide().convert_to<DigitalType>();
+        return GetMassEnergeticNuclide().ConvertTo<DigitalType>();
     }
 } // namespace Npgs::Astro
@@ -56,6 +56,13 @@ namespace Npgs::Astro
         {
             Astro::FStellarClass Class;
 
+            // 单字节字段紧跟在光谱型之后，填满 double 之前的对齐空隙
+            EEvolutionPhase Phase{ EEvolutionPhase::kPrevMainSequence }; // 演化阶段
+            EStarFrom       From{ EStarFrom::kNormalFrom };              // 恒星形成方式
+
+            bool bIsSingleStar{ true };
+            bool bHasPlanets{ true };
+
             double Mass{};                    // 质量，单位 kg
             double Luminosity{};              // 辐射光度，单位 W
             double Lifetime{};                // 寿命，单位 yr
@@ -73,12 +80,6 @@ namespace Npgs::Astro
             float  StellarWindMassLossRate{}; // 恒星风质量损失率，单位 kg/s
             float  MinCoilMass{};             // 最小举星器赤道偏转线圈质量，单位 kg
             float  CriticalSpin{};            // 临界自转周期，单位 s
-
-            EEvolutionPhase Phase{ EEvolutionPhase::kPrevMainSequence }; // 演化阶段
-            EStarFrom       From{ EStarFrom::kNormalFrom };              // 恒星形成方式
-
-            bool bIsSingleStar{ true };
-            bool bHasPlanets{ true };
         };
 
         using FSubclassMap = std::vector<std::pair<int, float>>;
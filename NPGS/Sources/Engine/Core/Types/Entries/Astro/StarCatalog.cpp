@@ -0,0 +1,94 @@
+#include "stdafx.h"
+#include "StarCatalog.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+namespace Npgs::Astro
+{
+    void FStarCatalog::Clear()
+    {
+        Positions_.clear();
+        Masses_.clear();
+        Luminosities_.clear();
+        Teffs_.clear();
+        Radii_.clear();
+        ClassCodes_.clear();
+        NameOffsets_.clear();
+        SystemIndices_.clear();
+        SystemFirstRows_.clear();
+        NamePool_.clear();
+    }
+
+    void FStarCatalog::Reserve(std::size_t StarCount, std::size_t SystemCount)
+    {
+        Positions_.reserve(StarCount);
+        Masses_.reserve(StarCount);
+        Luminosities_.reserve(StarCount);
+        Teffs_.reserve(StarCount);
+        Radii_.reserve(StarCount);
+        ClassCodes_.reserve(StarCount);
+        NameOffsets_.reserve(StarCount);
+        SystemIndices_.reserve(StarCount);
+        SystemFirstRows_.reserve(SystemCount + 1);
+        // 名称形如 "STAR-00000000 A"，按每个 16 字节预留
+        NamePool_.reserve(StarCount * 16);
+    }
+
+    std::uint32_t FStarCatalog::AddSystem(glm::vec3 Position, const std::vector<AStar>& Stars)
+    {
+        if (Positions_.size() + Stars.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error("Star catalog row count exceeds 32-bit index range.");
+        }
+
+        if (SystemFirstRows_.empty())
+        {
+            SystemFirstRows_.push_back(0);
+        }
+
+        auto SystemIndex = static_cast<std::uint32_t>(SystemFirstRows_.size() - 1);
+        for (const auto& Star : Stars)
+        {
+            Positions_.push_back(Position);
+            Masses_.push_back(Star.GetMass());
+            Luminosities_.push_back(Star.GetLuminosity());
+            Teffs_.push_back(Star.GetTeff());
+            Radii_.push_back(Star.GetRadius());
+            ClassCodes_.push_back(PackClass(Star.GetStellarClass()));
+            NameOffsets_.push_back(StoreName(Star.GetName()));
+            SystemIndices_.push_back(SystemIndex);
+        }
+
+        SystemFirstRows_.push_back(static_cast<std::uint32_t>(Positions_.size()));
+        return SystemIndex;
+    }
+
+    void FStarCatalog::UpdateStar(std::size_t Row, const AStar& Star)
+    {
+        Masses_[Row]       = Star.GetMass();
+        Luminosities_[Row] = Star.GetLuminosity();
+        Teffs_[Row]        = Star.GetTeff();
+        Radii_[Row]        = Star.GetRadius();
+        ClassCodes_[Row]   = PackClass(Star.GetStellarClass());
+
+        // 名称相同时沿用原来的位置，否则追加到池末尾，旧名称留在池中直到 Clear
+        if (GetName(Row) != Star.GetName())
+        {
+            NameOffsets_[Row] = StoreName(Star.GetName());
+        }
+    }
+
+    std::uint32_t FStarCatalog::StoreName(std::string_view Name)
+    {
+        if (NamePool_.size() + Name.size() + 1 > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error("Star catalog name pool exceeds 32-bit offset range.");
+        }
+
+        auto Offset = static_cast<std::uint32_t>(NamePool_.size());
+        NamePool_.append(Name);
+        NamePool_.push_back('\0');
+        return Offset;
+    }
+} // namespace Npgs::Astro
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Engine/Core/Types/Entries/Astro/Star.hpp"
+#include "Engine/Core/Types/Properties/StellarClass.hpp"
+
+namespace Npgs::Astro
+{
+    // 恒星目录，按列存储遍历与统计时频繁访问的热数据（位置、质量、光度、有效温度、半径、光谱型编码），
+    // 其余物理细节仍保存在 AStar 中，通过行的 (系统序号, 系统内恒星序号) 回到所属系统查找，目录不持有恒星的地址
+    // 名称存放在一块连续的字符池中，每行只保存偏移。行按所属系统连续排列，同一系统的恒星行号相邻
+    class FStarCatalog
+    {
+    public:
+        using FClassCode = std::uint64_t;
+
+    public:
+        FStarCatalog() = default;
+        ~FStarCatalog() = default;
+
+        void Clear();
+        void Reserve(std::size_t StarCount, std::size_t SystemCount);
+
+        // 追加一个系统的所有恒星，返回系统序号
+        std::uint32_t AddSystem(glm::vec3 Position, const std::vector<AStar>& Stars);
+        // 用新的恒星数据刷新某一行
+        void UpdateStar(std::size_t Row, const AStar& Star);
+
+        std::size_t GetStarCount() const;
+        std::size_t GetSystemCount() const;
+        std::size_t GetSystemFirstRow(std::size_t SystemIndex) const;
+        std::size_t GetSystemStarCount(std::size_t SystemIndex) const;
+
+        glm::vec3        GetPosition(std::size_t Row) const;
+        double           GetMass(std::size_t Row) const;
+        double           GetLuminosity(std::size_t Row) const;
+        float            GetTeff(std::size_t Row) const;
+        float            GetRadius(std::size_t Row) const;
+        FClassCode       GetClassCode(std::size_t Row) const;
+        std::string_view GetName(std::size_t Row) const;
+        std::uint32_t    GetSystemIndex(std::size_t Row) const;
+        std::uint32_t    GetStarIndex(std::size_t Row) const; // 恒星在所属系统 StarsData() 中的序号
+
+        const std::vector<glm::vec3>&  GetPositions() const;
+        const std::vector<double>&     GetMasses() const;
+        const std::vector<double>&     GetLuminosities() const;
+        const std::vector<float>&      GetTeffs() const;
+        const std::vector<float>&      GetRadii() const;
+        const std::vector<FClassCode>& GetClassCodes() const;
+
+        // 光谱型编码：低 32 位为次型的浮点位模式，32-35 位恒星类型，36-40 位光谱型，41-44 位光度级，48-63 位特殊标记
+        static FClassCode    PackClass(const FStellarClass& Class);
+        static FStellarClass UnpackClass(FClassCode Code);
+        static EStellarType  GetStellarType(FClassCode Code);
+
+    private:
+        std::uint32_t StoreName(std::string_view Name);
+
+    private:
+        std::vector<glm::vec3>     Positions_;
+        std::vector<double>        Masses_;
+        std::vector<double>        Luminosities_;
+        std::vector<float>         Teffs_;
+        std::vector<float>         Radii_;
+        std::vector<FClassCode>    ClassCodes_;
+        std::vector<std::uint32_t> NameOffsets_;
+        std::vector<std::uint32_t> SystemIndices_;
+        std::vector<std::uint32_t> SystemFirstRows_; // 比系统数多一个元素，末尾为总行数
+        std::string                NamePool_;       // 以 '\0' 分隔的名称
+    };
+} // namespace Npgs::Astro
+
+#include "StarCatalog.inl"
@@ -0,0 +1,133 @@
+#include "StarCatalog.hpp"
+
+#include <bit>
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs::Astro
+{
+    NPGS_INLINE std::size_t FStarCatalog::GetStarCount() const
+    {
+        return Positions_.size();
+    }
+
+    NPGS_INLINE std::size_t FStarCatalog::GetSystemCount() const
+    {
+        return SystemFirstRows_.empty() ? 0 : SystemFirstRows_.size() - 1;
+    }
+
+    NPGS_INLINE std::size_t FStarCatalog::GetSystemFirstRow(std::size_t SystemIndex) const
+    {
+        return SystemFirstRows_[SystemIndex];
+    }
+
+    NPGS_INLINE std::size_t FStarCatalog::GetSystemStarCount(std::size_t SystemIndex) const
+    {
+        return SystemFirstRows_[SystemIndex + 1] - SystemFirstRows_[SystemIndex];
+    }
+
+    NPGS_INLINE glm::vec3 FStarCatalog::GetPosition(std::size_t Row) const
+    {
+        return Positions_[Row];
+    }
+
+    NPGS_INLINE double FStarCatalog::GetMass(std::size_t Row) const
+    {
+        return Masses_[Row];
+    }
+
+    NPGS_INLINE double FStarCatalog::GetLuminosity(std::size_t Row) const
+    {
+        return Luminosities_[Row];
+    }
+
+    NPGS_INLINE float FStarCatalog::GetTeff(std::size_t Row) const
+    {
+        return Teffs_[Row];
+    }
+
+    NPGS_INLINE float FStarCatalog::GetRadius(std::size_t Row) const
+    {
+        return Radii_[Row];
+    }
+
+    NPGS_INLINE FStarCatalog::FClassCode FStarCatalog::GetClassCode(std::size_t Row) const
+    {
+        return ClassCodes_[Row];
+    }
+
+    NPGS_INLINE std::string_view FStarCatalog::GetName(std::size_t Row) const
+    {
+        return NamePool_.c_str() + NameOffsets_[Row];
+    }
+
+    NPGS_INLINE std::uint32_t FStarCatalog::GetSystemIndex(std::size_t Row) const
+    {
+        return SystemIndices_[Row];
+    }
+
+    NPGS_INLINE std::uint32_t FStarCatalog::GetStarIndex(std::size_t Row) const
+    {
+        return static_cast<std::uint32_t>(Row - SystemFirstRows_[SystemIndices_[Row]]);
+    }
+
+    NPGS_INLINE const std::vector<glm::vec3>& FStarCatalog::GetPositions() const
+    {
+        return Positions_;
+    }
+
+    NPGS_INLINE const std::vector<double>& FStarCatalog::GetMasses() const
+    {
+        return Masses_;
+    }
+
+    NPGS_INLINE const std::vector<double>& FStarCatalog::GetLuminosities() const
+    {
+        return Luminosities_;
+    }
+
+    NPGS_INLINE const std::vector<float>& FStarCatalog::GetTeffs() const
+    {
+        return Teffs_;
+    }
+
+    NPGS_INLINE const std::vector<float>& FStarCatalog::GetRadii() const
+    {
+        return Radii_;
+    }
+
+    NPGS_INLINE const std::vector<FStarCatalog::FClassCode>& FStarCatalog::GetClassCodes() const
+    {
+        return ClassCodes_;
+    }
+
+    NPGS_INLINE FStarCatalog::FClassCode FStarCatalog::PackClass(const FStellarClass& Class)
+    {
+        FSpectralType SpectralType = Class.GetSpectralType();
+
+        FClassCode Code = std::bit_cast<std::uint32_t>(SpectralType.Subclass);
+        Code |= static_cast<FClassCode>(Class.GetStellarType())       << 32;
+        Code |= static_cast<FClassCode>(SpectralType.SpectralClass)   << 36;
+        Code |= static_cast<FClassCode>(SpectralType.LuminosityClass) << 41;
+        Code |= static_cast<FClassCode>(SpectralType.SpecialMark)     << 48;
+
+        return Code;
+    }
+
+    NPGS_INLINE FStellarClass FStarCatalog::UnpackClass(FClassCode Code)
+    {
+        FSpectralType SpectralType
+        {
+            .SpectralClass   = static_cast<ESpectralClass>((Code >> 36) & 0x1F),
+            .LuminosityClass = static_cast<ELuminosityClass>((Code >> 41) & 0xF),
+            .SpecialMark     = static_cast<FSpecialMarkDigital>(Code >> 48),
+            .Subclass        = std::bit_cast<float>(static_cast<std::uint32_t>(Code))
+        };
+
+        return FStellarClass(GetStellarType(Code), SpectralType);
+    }
+
+    NPGS_INLINE EStellarType FStarCatalog::GetStellarType(FClassCode Code)
+    {
+        return static_cast<EStellarType>((Code >> 32) & 0xF);
+    }
+} // namespace Npgs::Astro
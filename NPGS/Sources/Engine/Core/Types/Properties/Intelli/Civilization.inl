@@ -7,11 +7,11 @@ namespace Npgs::Intelli
 {
     NPGS_INLINE FStandard& FStandard::SetOrganismBiomass(float OrganismBiomass)
     {
-        LifeProperties_.OrganismBiomass = boost::multiprecision::uint128_t(OrganismBiomass);
+        LifeProperties_.OrganismBiomass = Math::FUint128(OrganismBiomass);
         return *this;
     }
 
-    NPGS_INLINE FStandard& FStandard::SetOrganismBiomass(const boost::multiprecision::uint128_t& OrganismBiomass)
+    NPGS_INLINE FStandard& FStandard::SetOrganismBiomass(const Math::FUint128& OrganismBiomass)
     {
         LifeProperties_.OrganismBiomass = OrganismBiomass;
         return *this;
@@ -31,11 +31,11 @@ namespace Npgs::Intelli
 
     NPGS_INLINE FStandard& FStandard::SetAtrificalStructureMass(float AtrificalStructureMass)
     {
-        CivilizationProperties_.AtrificalStructureMass = boost::multiprecision::uint128_t(AtrificalStructureMass);
+        CivilizationProperties_.AtrificalStructureMass = Math::FUint128(AtrificalStructureMass);
         return *this;
     }
 
-    NPGS_INLINE FStandard& FStandard::SetAtrificalStructureMass(boost::multiprecision::uint128_t AtrificalStructureMass)
+    NPGS_INLINE FStandard& FStandard::SetAtrificalStructureMass(Math::FUint128 AtrificalStructureMass)
     {
         CivilizationProperties_.AtrificalStructureMass = std::move(AtrificalStructureMass);
         return *this;
@@ -43,11 +43,11 @@ namespace Npgs::Intelli
 
     NPGS_INLINE FStandard& FStandard::SetCitizenBiomass(float CitizenBiomass)
     {
-        CivilizationProperties_.CitizenBiomass = boost::multiprecision::uint128_t(CitizenBiomass);
+        CivilizationProperties_.CitizenBiomass = Math::FUint128(CitizenBiomass);
         return *this;
     }
 
-    NPGS_INLINE FStandard& FStandard::SetCitizenBiomass(boost::multiprecision::uint128_t CitizenBiomass)
+    NPGS_INLINE FStandard& FStandard::SetCitizenBiomass(Math::FUint128 CitizenBiomass)
     {
         CivilizationProperties_.CitizenBiomass = std::move(CitizenBiomass);
         return *this;
@@ -55,11 +55,11 @@ namespace Npgs::Intelli
 
     NPGS_INLINE FStandard& FStandard::SetUseableEnergeticNuclide(float UseableEnergeticNuclide)
     {
-        CivilizationProperties_.UseableEnergeticNuclide = boost::multiprecision::uint128_t(UseableEnergeticNuclide);
+        CivilizationProperties_.UseableEnergeticNuclide = Math::FUint128(UseableEnergeticNuclide);
         return *this;
     }
 
-    NPGS_INLINE FStandard& FStandard::SetUseableEnergeticNuclide(boost::multiprecision::uint128_t UseableEnergeticNuclide)
+    NPGS_INLINE FStandard& FStandard::SetUseableEnergeticNuclide(Math::FUint128 UseableEnergeticNuclide)
     {
         CivilizationProperties_.UseableEnergeticNuclide = std::move(UseableEnergeticNuclide);
         return *this;
@@ -67,11 +67,11 @@ namespace Npgs::Intelli
 
     NPGS_INLINE FStandard& FStandard::SetOrbitAssetsMass(float OrbitAssetsMass)
     {
-        CivilizationProperties_.OrbitAssetsMass = boost::multiprecision::uint128_t(OrbitAssetsMass);
+        CivilizationProperties_.OrbitAssetsMass = Math::FUint128(OrbitAssetsMass);
         return *this;
     }
 
-    NPGS_INLINE FStandard& FStandard::SetOrbitAssetsMass(boost::multiprecision::uint128_t OrbitAssetsMass)
+    NPGS_INLINE FStandard& FStandard::SetOrbitAssetsMass(Math::FUint128 OrbitAssetsMass)
     {
         CivilizationProperties_.OrbitAssetsMass = std::move(OrbitAssetsMass);
         return *this;
@@ -131,7 +131,7 @@ namespace Npgs::Intelli
         return *this;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& FStandard::GetOrganismBiomass() const
+    NPGS_INLINE const Math::FUint128& FStandard::GetOrganismBiomass() const
     {
         return LifeProperties_.OrganismBiomass;
     }
@@ -149,25 +149,25 @@ namespace Npgs::Intelli
     template <typename DigitalType>
     NPGS_INLINE DigitalType FStandard::GetOrganismBiomassDigital() const
     {
-        return LifeProperties_.OrganismBiomass.convert_to<DigitalType>();
+        return LifeProperties_.OrganismBiomass.ConvertTo<DigitalType>();
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& FStandard::GetAtrificalStructureMass() const
+    NPGS_INLINE const Math::FUint128& FStandard::GetAtrificalStructureMass() const
     {
         return CivilizationProperties_.AtrificalStructureMass;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& FStandard::GetCitizenBiomass() const
+    NPGS_INLINE const Math::FUint128& FStandard::GetCitizenBiomass() const
     {
         return CivilizationProperties_.CitizenBiomass;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& FStandard::GetUseableEnergeticNuclide() const
+    NPGS_INLINE const Math::FUint128& FStandard::GetUseableEnergeticNuclide() const
     {
         return CivilizationProperties_.UseableEnergeticNuclide;
     }
 
-    NPGS_INLINE const boost::multiprecision::uint128_t& FStandard::GetOrbitAssetsMass() const
+    NPGS_INLINE const Math::FUint128& FStandard::GetOrbitAssetsMass() const
     {
         return CivilizationProperties_.OrbitAssetsMass;
     }
@@ -220,24 +220,24 @@ namespace Npgs::Intelli
     template <typename DigitalType>
     NPGS_INLINE DigitalType FStandard::GetAtrificalStructureMassDigital() const
     {
-        return CivilizationProperties_.AtrificalStructureMass.convert_to<DigitalType>();
+        return CivilizationProperties_.AtrificalStructureMass.ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType FStandard::GetCitizenBiomassDigital() const
     {
-        return CivilizationProperties_.CitizenBiomass.convert_to<DigitalType>();
+        return CivilizationProperties_.CitizenBiomass.ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType FStandard::GetUseableEnergeticNuclideDigital() const
     {
-        return CivilizationProperties_.UseableEnergeticNuclide.convert_to<DigitalType>();
+        return CivilizationProperties_.UseableEnergeticNuclide.ConvertTo<DigitalType>();
     }
 
     template <typename DigitalType>
     NPGS_INLINE DigitalType FStandard::GetOrbitAssetsMassDigital() const
     {
-        return CivilizationProperties_.OrbitAssetsMass.convert_to<DigitalType>();
+        return CivilizationProperties_.OrbitAssetsMass.ConvertTo<DigitalType>();
     }
 } // namespace Npgs::Intelli
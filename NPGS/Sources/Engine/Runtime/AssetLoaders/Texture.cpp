@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <format>
+#include <memory_resource>
 #include <ranges>
 #include <stdexcept>
 #include <utility>
@@ -24,6 +25,7 @@
 
 #include "Engine/Core/Logger.hpp"
 #include "Engine/Runtime/Managers/AssetManager.hpp"
+#include "Engine/Runtime/Pools/LinearArena.hpp"
 #include "Engine/System/Services/EngineServices.hpp"
 
 namespace Npgs
@@ -59,11 +61,12 @@ namespace Npgs
                                 static_cast<std::int32_t>(MipmapSize(Extent.depth,  MipLevel)));
         }
 
-        std::vector<vk::BufferImageCopy2> MakeCopyRegions(vk::Extent3D Extent, std::uint32_t MipLevels,
-                                                          const std::vector<std::size_t>& LevelOffsets,
-                                                          std::uint32_t ArrayLayers)
+        std::pmr::vector<vk::BufferImageCopy2> MakeCopyRegions(vk::Extent3D Extent, std::uint32_t MipLevels,
+                                                               const std::vector<std::size_t>& LevelOffsets,
+                                                               std::uint32_t ArrayLayers, std::pmr::memory_resource* MemoryResource)
         {
-            std::vector<vk::BufferImageCopy2> Regions;
+            std::pmr::vector<vk::BufferImageCopy2> Regions(MemoryResource);
+            Regions.reserve(MipLevels);
             for (std::uint32_t MipLevel = 0; MipLevel != MipLevels; ++MipLevel)
             {
                 vk::ImageSubresourceLayers Subresource(vk::ImageAspectFlagBits::eColor, MipLevel, 0, ArrayLayers);
@@ -90,9 +93,11 @@ namespace Npgs
             return BlitRegion;
         }
 
-        std::vector<vk::ImageBlit2> MakeBlitRegions(vk::Extent3D Extent, std::uint32_t MipLevels, std::uint32_t ArrayLayers)
+        std::pmr::vector<vk::ImageBlit2> MakeBlitRegions(vk::Extent3D Extent, std::uint32_t MipLevels, std::uint32_t ArrayLayers,
+                                                         std::pmr::memory_resource* MemoryResource)
         {
-            std::vector<vk::ImageBlit2> Regions;
+            std::pmr::vector<vk::ImageBlit2> Regions(MemoryResource);
+            Regions.reserve(MipLevels);
             for (std::uint32_t MipLevel = 0; MipLevel != MipLevels; ++MipLevel)
             {
                 vk::ImageSubresourceLayers Subresource(vk::ImageAspectFlagBits::eColor, MipLevel, 0, ArrayLayers);
@@ -817,15 +822,17 @@ namespace Npgs
         CommandPool.AllocateBuffer(vk::CommandBufferLevel::ePrimary, "CopyBlitApplyTexture_CommandBuffer", CommandBuffer);
         CommandBuffer.Begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 
+        // 区域数组只在录制期间使用，从线程 arena 分配
+        FLinearArenaScope ArenaScope;
         if (bNeedCopy)
         {
-            auto CopyRegions = MakeCopyRegions(Extent, MipLevels, LevelOffsets, ArrayLayers);
+            auto CopyRegions = MakeCopyRegions(Extent, MipLevels, LevelOffsets, ArrayLayers, ArenaScope.GetArena());
             CopyBufferToImage(CommandBuffer, SrcBuffer, DstImageSrcBlit, kPostTransferStates[bNeedBlit], CopyRegions);
         }
 
         if (bNeedBlit)
         {
-            auto BlitRegions = MakeBlitRegions(Extent, MipLevels, ArrayLayers);
+            auto BlitRegions = MakeBlitRegions(Extent, MipLevels, ArrayLayers, ArenaScope.GetArena());
             BlitImage(CommandBuffer, DstImageSrcBlit, {}, DstImageDstBlit, kPostTransferStates[0], BlitRegions, Filter);
         }
 
@@ -936,7 +943,8 @@ namespace Npgs
 
         if (SrcPostTransferState.kbEnable || DstPostTransferState.kbEnable)
         {
-            std::vector<vk::ImageMemoryBarrier2> PostTransferBarriers;
+            FLinearArenaScope ArenaScope;
+            std::pmr::vector<vk::ImageMemoryBarrier2> PostTransferBarriers(ArenaScope.GetArena());
 
             if (SrcPostTransferState.kbEnable)
             {
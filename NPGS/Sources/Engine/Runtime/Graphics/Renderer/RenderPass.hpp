@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory_resource>
 #include <vector>
 #include <vulkan/vulkan.hpp>
 
@@ -21,9 +22,11 @@ namespace Npgs
         IRenderPass& operator=(IRenderPass&&)      = delete;
 
         void Setup();
-        
-        virtual std::vector<FVulkanCommandBuffer>
-        RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor) = 0;
+
+        // 返回的数组分配在 MemoryResource 上，通常是当前帧的线程 arena，只在本帧内有效
+        virtual std::pmr::vector<FVulkanCommandBuffer>
+        RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor,
+                       std::pmr::memory_resource* MemoryResource) = 0;
 
     protected:
         virtual void BindDescriptors()    = 0;
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <atomic>
 #include <concepts>
+#include <format>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -122,6 +124,14 @@ namespace Npgs
         template <CAssetCompatible AssetType>
         TAssetHandle<AssetType> AcquireAsset(std::string_view Name);
 
+        // 获取资产在指定 NUMA 节点上的副本，副本不存在时在调用线程上复制主资产（首次写入落在调用线程所在节点）
+        // 副本作为名为 "<Name>#numa<Node>" 的普通资产管理。未开启复制、节点未知或资产不可复制时返回主资产
+        template <CAssetCompatible AssetType>
+        TAssetHandle<AssetType> AcquireNodeReplica(std::string_view Name, std::uint32_t NumaNode);
+
+        void SetNumaReplicationEnabled(bool bEnabled);
+        bool IsNumaReplicationEnabled() const;
+
         void PinAsset(std::string_view Name);
         void UnpinAsset(std::string_view Name);
         void RequestRemoveAsset(std::string_view Name);
@@ -142,7 +152,9 @@ namespace Npgs
         FAssetMap             Assets_;
         std::shared_mutex     SharedMutex_;
         std::mutex            Mutex_;
+        std::mutex            ReplicaMutex_;
         std::shared_ptr<bool> LivenessToken_;
+        std::atomic<bool>     bNumaReplication_{ false };
     };
 } // namespace Npgs
 
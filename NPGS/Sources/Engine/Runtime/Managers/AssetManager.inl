@@ -239,6 +239,52 @@ namespace Npgs
         return TAssetHandle<AssetType>(this, AssetEntry);
     }
 
+    template <CAssetCompatible AssetType>
+    TAssetHandle<AssetType> FAssetManager::AcquireNodeReplica(std::string_view Name, std::uint32_t NumaNode)
+    {
+        if constexpr (std::copy_constructible<AssetType>)
+        {
+            if (bNumaReplication_.load(std::memory_order::relaxed) && NumaNode != std::numeric_limits<std::uint32_t>::max())
+            {
+                std::string ReplicaName = std::format("{}#numa{}", Name, NumaNode);
+                auto Replica = AcquireAsset<AssetType>(ReplicaName);
+                if (Replica)
+                {
+                    return Replica;
+                }
+
+                // 复制在锁内进行并再次检查，同时未命中的线程不会各自深拷贝一份
+                std::lock_guard Lock(ReplicaMutex_);
+                Replica = AcquireAsset<AssetType>(ReplicaName);
+                if (Replica)
+                {
+                    return Replica;
+                }
+
+                auto Primary = AcquireAsset<AssetType>(Name);
+                if (!Primary)
+                {
+                    return Primary;
+                }
+
+                AddAsset<AssetType>(ReplicaName, AssetType(*Primary));
+                return AcquireAsset<AssetType>(ReplicaName);
+            }
+        }
+
+        return AcquireAsset<AssetType>(Name);
+    }
+
+    NPGS_INLINE void FAssetManager::SetNumaReplicationEnabled(bool bEnabled)
+    {
+        bNumaReplication_.store(bEnabled, std::memory_order::relaxed);
+    }
+
+    NPGS_INLINE bool FAssetManager::IsNumaReplicationEnabled() const
+    {
+        return bNumaReplication_.load(std::memory_order::relaxed);
+    }
+
     NPGS_INLINE void FAssetManager::RemoveAssetUnchecked(std::string_view Name)
     {
         std::unique_lock Lock(Mutex_);
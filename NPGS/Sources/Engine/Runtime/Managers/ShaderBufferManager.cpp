@@ -3,7 +3,6 @@
 
 #include <exception>
 #include <format>
-#include <iterator>
 #include <stdexcept>
 #include <Volk/volk.h>
 
@@ -12,77 +11,6 @@
 
 namespace Npgs
 {
-    void FShaderBufferManager::FHeapAllocator::Initialize(vk::DeviceSize TotalSize)
-    {
-        TotalSize_ = TotalSize;
-        FreeBlocks_.clear();
-        FreeBlocks_[0] = TotalSize;
-    }
-
-    vk::DeviceSize FShaderBufferManager::FHeapAllocator::Allocate(vk::DeviceSize Size, vk::DeviceSize Alignment)
-    {
-        for (auto it = FreeBlocks_.begin(); it != FreeBlocks_.end(); ++it)
-        {
-            vk::DeviceSize BlockOffset = it->first;
-            vk::DeviceSize BlockSize   = it->second;
-
-            vk::DeviceSize AlignedOffset = (BlockOffset + Alignment - 1) & ~(Alignment - 1);
-            vk::DeviceSize Padding       = AlignedOffset - BlockOffset;
-            vk::DeviceSize RequiredSize  = Size + Padding;
-
-            if (BlockSize >= RequiredSize)
-            {
-                FreeBlocks_.erase(it);
-                if (Padding > 0)
-                {
-                    FreeBlocks_[BlockOffset] = Padding;
-                }
-
-                vk::DeviceSize RemainingSize = BlockSize - RequiredSize;
-                if (RemainingSize > 0)
-                {
-                    FreeBlocks_[AlignedOffset + Size] = RemainingSize;
-                }
-
-                return AlignedOffset;
-            }
-        }
-
-        throw std::runtime_error("Heap allocation failed: insufficient memory.");
-    }
-
-    void FShaderBufferManager::FHeapAllocator::Free(vk::DeviceSize Offset, vk::DeviceSize Size)
-    {
-        FreeBlocks_[Offset] = Size;
-
-        auto it     = FreeBlocks_.find(Offset);
-        auto NextIt = std::next(it);
-        if (NextIt != FreeBlocks_.end())
-        {
-            if (it->first + it->second == NextIt->first)
-            {
-                it->second += NextIt->second;
-                FreeBlocks_.erase(NextIt);
-            }
-        }
-
-        if (it != FreeBlocks_.begin())
-        {
-            auto PrevIt = std::prev(it);
-            if (PrevIt->first + PrevIt->second == it->first)
-            {
-                PrevIt->second += it->second;
-                FreeBlocks_.erase(it);
-            }
-        }
-    }
-
-    void FShaderBufferManager::FHeapAllocator::Reset()
-    {
-        FreeBlocks_.clear();
-        FreeBlocks_[0] = TotalSize_;
-    }
-
     FShaderBufferManager::FShaderBufferManager(FVulkanContext* VulkanContext)
         : VulkanContext_(VulkanContext)
     {
@@ -129,11 +57,11 @@ namespace Npgs
         if (BufferInfo.Type == vk::DescriptorType::eUniformBuffer ||
             BufferInfo.Type == vk::DescriptorType::eUniformBufferDynamic)
         {
-            UniformHeapAllocator_.Free(BufferInfo.Offset, BufferInfo.Size);
+            UniformHeapAllocator_.Free(BufferInfo.Offset);
         }
         else
         {
-            StorageHeapAllocator_.Free(BufferInfo.Offset, BufferInfo.Size);
+            StorageHeapAllocator_.Free(BufferInfo.Offset);
         }
 
         DataBuffers_.erase(Name);
@@ -224,11 +152,11 @@ namespace Npgs
         {
             if (SetAllocation.HeapType == EHeapType::kResource)
             {
-                ResourceHeapAllocator_.Free(SetAllocation.Offset, SetAllocation.Size);
+                ResourceHeapAllocator_.Free(SetAllocation.Offset);
             }
             else
             {
-                SamplerHeapAllocator_.Free(SetAllocation.Offset, SetAllocation.Size);
+                SamplerHeapAllocator_.Free(SetAllocation.Offset);
             }
         }
 
@@ -2,7 +2,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <map>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -17,6 +16,7 @@
 #include "Engine/Runtime/AssetLoaders/Shader.hpp"
 #include "Engine/Runtime/Graphics/Resources/DeviceLocalBuffer.hpp"
 #include "Engine/Runtime/Graphics/Vulkan/Context.hpp"
+#include "Engine/Runtime/Pools/TlsfAllocator.hpp"
 
 namespace Npgs
 {
@@ -158,20 +158,6 @@ namespace Npgs
             std::size_t operator()(const std::pair<std::uint32_t, std::uint32_t>& SetBinding) const noexcept;
         };
 
-        class FHeapAllocator
-        {
-        public:
-            void Initialize(vk::DeviceSize TotalSize);
-            vk::DeviceSize Allocate(vk::DeviceSize Size, vk::DeviceSize Alignment);
-            void Free(vk::DeviceSize Offset, vk::DeviceSize Size);
-            void Reset();
-
-        private:
-            vk::DeviceSize TotalSize_{};
-            // [BlockOffset, BlockSize]
-            std::map<vk::DeviceSize, vk::DeviceSize> FreeBlocks_;
-        };
-
     private:
         void InitializeHeaps();
         const FDataBufferInfo& GetDataBufferInfo(std::string_view BufferName) const;
@@ -199,10 +185,10 @@ namespace Npgs
         std::vector<FDeviceLocalBuffer> StorageDataHeaps_;
         
         VmaAllocator   Allocator_;
-        FHeapAllocator ResourceHeapAllocator_;
-        FHeapAllocator SamplerHeapAllocator_;
-        FHeapAllocator UniformHeapAllocator_;
-        FHeapAllocator StorageHeapAllocator_;
+        FTlsfAllocator ResourceHeapAllocator_;
+        FTlsfAllocator SamplerHeapAllocator_;
+        FTlsfAllocator UniformHeapAllocator_;
+        FTlsfAllocator StorageHeapAllocator_;
     };
 } // namespace Npgs
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace Npgs
+{
+    class FOperationCanceledError : public std::runtime_error
+    {
+    public:
+        FOperationCanceledError();
+    };
+
+    // 协作式取消：长时间运行的任务定期检查令牌并自行退出，令牌可以任意复制并跨线程传递
+    // 默认构造的令牌永远不会被取消
+    class FCancellationToken
+    {
+    public:
+        FCancellationToken() = default;
+
+        bool IsCancellationRequested() const;
+        void ThrowIfCancellationRequested() const;
+        bool CanBeCanceled() const;
+
+    private:
+        friend class FCancellationSource;
+
+        explicit FCancellationToken(std::shared_ptr<const std::atomic<bool>> State);
+
+    private:
+        std::shared_ptr<const std::atomic<bool>> State_;
+    };
+
+    class FCancellationSource
+    {
+    public:
+        FCancellationSource();
+
+        void RequestCancellation();
+        bool IsCancellationRequested() const;
+        FCancellationToken GetToken() const;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> State_;
+    };
+} // namespace Npgs
+
+#include "CancellationToken.inl"
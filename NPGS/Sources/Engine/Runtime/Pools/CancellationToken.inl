@@ -0,0 +1,54 @@
+#include <utility>
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE FOperationCanceledError::FOperationCanceledError()
+        : std::runtime_error("Operation canceled.")
+    {
+    }
+
+    NPGS_INLINE FCancellationToken::FCancellationToken(std::shared_ptr<const std::atomic<bool>> State)
+        : State_(std::move(State))
+    {
+    }
+
+    NPGS_INLINE bool FCancellationToken::IsCancellationRequested() const
+    {
+        return State_ != nullptr && State_->load(std::memory_order::relaxed);
+    }
+
+    NPGS_INLINE void FCancellationToken::ThrowIfCancellationRequested() const
+    {
+        if (IsCancellationRequested())
+        {
+            throw FOperationCanceledError();
+        }
+    }
+
+    NPGS_INLINE bool FCancellationToken::CanBeCanceled() const
+    {
+        return State_ != nullptr;
+    }
+
+    NPGS_INLINE FCancellationSource::FCancellationSource()
+        : State_(std::make_shared<std::atomic<bool>>(false))
+    {
+    }
+
+    NPGS_INLINE void FCancellationSource::RequestCancellation()
+    {
+        State_->store(true, std::memory_order::relaxed);
+    }
+
+    NPGS_INLINE bool FCancellationSource::IsCancellationRequested() const
+    {
+        return State_->load(std::memory_order::relaxed);
+    }
+
+    NPGS_INLINE FCancellationToken FCancellationSource::GetToken() const
+    {
+        return FCancellationToken(State_);
+    }
+} // namespace Npgs
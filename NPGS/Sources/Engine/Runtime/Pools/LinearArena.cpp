@@ -0,0 +1,73 @@
+#include "stdafx.h"
+#include "LinearArena.hpp"
+
+namespace Npgs
+{
+    FLinearArena::FLinearArena(std::size_t BlockSize, std::pmr::memory_resource* Upstream)
+        : Upstream_(Upstream)
+        , BlockSize_(BlockSize)
+    {
+    }
+
+    FLinearArena::~FLinearArena()
+    {
+        ReleaseBlocks();
+    }
+
+    void FLinearArena::Reset()
+    {
+        if (Blocks_.size() > 1)
+        {
+            std::size_t MergedSize = ReservedSize_;
+            ReleaseBlocks();
+
+            auto* Data = static_cast<std::byte*>(Upstream_->allocate(MergedSize, alignof(std::max_align_t)));
+            Blocks_.emplace_back(Data, MergedSize);
+            ReservedSize_ = MergedSize;
+        }
+
+        BlockIndex_ = 0;
+        Offset_     = 0;
+        UsedSize_   = 0;
+    }
+
+    FLinearArena& FLinearArena::GetThreadArena()
+    {
+        thread_local FLinearArena Arena;
+        return Arena;
+    }
+
+    void* FLinearArena::AllocateFromNextBlock(std::size_t Size, std::size_t Alignment)
+    {
+        // 当前块剩余的空间不再使用，回退到之前的标记后才会重新利用
+        for (std::size_t i = BlockIndex_ + 1; i < Blocks_.size(); ++i)
+        {
+            if (Blocks_[i].Size >= Size + Alignment)
+            {
+                BlockIndex_ = i;
+                Offset_     = 0;
+                return AllocateFromBlock(Size, Alignment);
+            }
+        }
+
+        std::size_t NewBlockSize = std::max(BlockSize_, Size + Alignment);
+        auto* Data = static_cast<std::byte*>(Upstream_->allocate(NewBlockSize, alignof(std::max_align_t)));
+        Blocks_.emplace_back(Data, NewBlockSize);
+        ReservedSize_ += NewBlockSize;
+
+        BlockIndex_ = Blocks_.size() - 1;
+        Offset_     = 0;
+        return AllocateFromBlock(Size, Alignment);
+    }
+
+    void FLinearArena::ReleaseBlocks()
+    {
+        for (const auto& Block : Blocks_)
+        {
+            Upstream_->deallocate(Block.Data, Block.Size, alignof(std::max_align_t));
+        }
+
+        Blocks_.clear();
+        ReservedSize_ = 0;
+    }
+} // namespace Npgs
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace Npgs
+{
+    // 线性（bump）分配器：分配只移动偏移，单个释放为空操作，内存在作用域结束或 Reset 时整体回收
+    // 作为 std::pmr::memory_resource 供 std::pmr 容器使用。实例不加锁，通常通过 GetThreadArena 每个线程使用一个
+    class FLinearArena : public std::pmr::memory_resource
+    {
+    public:
+        struct FMarker
+        {
+            std::size_t BlockIndex{};
+            std::size_t Offset{};
+            std::size_t UsedSize{};
+        };
+
+        struct FStatistics
+        {
+            std::size_t UsedSize{};      // 当前已分配的字节数，含对齐填充
+            std::size_t PeakUsedSize{};  // 创建或上次 ResetPeak 以来的峰值
+            std::size_t ReservedSize{};  // 从上游申请的内存块总大小
+            std::size_t BlockCount{};
+        };
+
+    public:
+        explicit FLinearArena(std::size_t BlockSize = kDefaultBlockSize,
+                              std::pmr::memory_resource* Upstream = std::pmr::new_delete_resource());
+        FLinearArena(const FLinearArena&) = delete;
+        FLinearArena(FLinearArena&&)      = delete;
+        ~FLinearArena() override;
+
+        FLinearArena& operator=(const FLinearArena&) = delete;
+        FLinearArena& operator=(FLinearArena&&)      = delete;
+
+        FMarker GetMarker() const;
+        // 回退到 Marker 处，之后分配的内存全部失效
+        void Rewind(const FMarker& Marker);
+        // 回收全部内存，调用时不能有未结束的 FLinearArenaScope。上一轮用到多个内存块时合并为一个足够大的块，
+        // 稳定后 Reset 只重置偏移
+        void Reset();
+        void ResetPeak();
+
+        FStatistics GetStatistics() const;
+
+        // 当前线程的实例，线程退出时释放
+        static FLinearArena& GetThreadArena();
+
+    private:
+        struct FBlock
+        {
+            std::byte*  Data;
+            std::size_t Size;
+        };
+
+        void* do_allocate(std::size_t Size, std::size_t Alignment) override;
+        void  do_deallocate(void* Pointer, std::size_t Size, std::size_t Alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& Other) const noexcept override;
+
+        void* AllocateFromBlock(std::size_t Size, std::size_t Alignment);
+        void* AllocateFromNextBlock(std::size_t Size, std::size_t Alignment);
+        void  ReleaseBlocks();
+
+    private:
+        static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+        std::vector<FBlock>        Blocks_;
+        std::pmr::memory_resource* Upstream_;
+        std::size_t                BlockSize_;
+        std::size_t                BlockIndex_{};
+        std::size_t                Offset_{};
+        std::size_t                UsedSize_{};
+        std::size_t                PeakUsedSize_{};
+        std::size_t                ReservedSize_{};
+    };
+
+    // 作用域结束时把 arena 回退到进入时的位置，可以嵌套。作用域内分配的对象必须在作用域结束前销毁，
+    // 使用线程 arena 的作用域不能跨越 co_await 等可能换线程的挂起点
+    class FLinearArenaScope
+    {
+    public:
+        explicit FLinearArenaScope(FLinearArena& Arena = FLinearArena::GetThreadArena());
+        FLinearArenaScope(const FLinearArenaScope&) = delete;
+        FLinearArenaScope(FLinearArenaScope&&)      = delete;
+        ~FLinearArenaScope();
+
+        FLinearArenaScope& operator=(const FLinearArenaScope&) = delete;
+        FLinearArenaScope& operator=(FLinearArenaScope&&)      = delete;
+
+        FLinearArena* GetArena() const;
+
+    private:
+        FLinearArena*         Arena_;
+        FLinearArena::FMarker Marker_;
+    };
+} // namespace Npgs
+
+#include "LinearArena.inl"
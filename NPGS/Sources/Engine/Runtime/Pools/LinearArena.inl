@@ -0,0 +1,91 @@
+#include "LinearArena.hpp"
+#include <algorithm>
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE FLinearArena::FMarker FLinearArena::GetMarker() const
+    {
+        return { .BlockIndex = BlockIndex_, .Offset = Offset_, .UsedSize = UsedSize_ };
+    }
+
+    NPGS_INLINE void FLinearArena::Rewind(const FMarker& Marker)
+    {
+        BlockIndex_ = Marker.BlockIndex;
+        Offset_     = Marker.Offset;
+        UsedSize_   = Marker.UsedSize;
+    }
+
+    NPGS_INLINE void FLinearArena::ResetPeak()
+    {
+        PeakUsedSize_ = UsedSize_;
+    }
+
+    NPGS_INLINE FLinearArena::FStatistics FLinearArena::GetStatistics() const
+    {
+        return
+        {
+            .UsedSize     = UsedSize_,
+            .PeakUsedSize = PeakUsedSize_,
+            .ReservedSize = ReservedSize_,
+            .BlockCount   = Blocks_.size()
+        };
+    }
+
+    NPGS_INLINE void* FLinearArena::do_allocate(std::size_t Size, std::size_t Alignment)
+    {
+        if (void* Pointer = AllocateFromBlock(Size, Alignment); Pointer != nullptr)
+        {
+            return Pointer;
+        }
+
+        return AllocateFromNextBlock(Size, Alignment);
+    }
+
+    NPGS_INLINE void FLinearArena::do_deallocate(void*, std::size_t, std::size_t)
+    {
+    }
+
+    NPGS_INLINE bool FLinearArena::do_is_equal(const std::pmr::memory_resource& Other) const noexcept
+    {
+        return this == &Other;
+    }
+
+    NPGS_INLINE void* FLinearArena::AllocateFromBlock(std::size_t Size, std::size_t Alignment)
+    {
+        if (BlockIndex_ >= Blocks_.size())
+        {
+            return nullptr;
+        }
+
+        const FBlock& Block = Blocks_[BlockIndex_];
+        auto Current = reinterpret_cast<std::uintptr_t>(Block.Data) + Offset_;
+        auto Aligned = (Current + Alignment - 1) & ~(static_cast<std::uintptr_t>(Alignment) - 1);
+        if (Aligned + Size > reinterpret_cast<std::uintptr_t>(Block.Data) + Block.Size)
+        {
+            return nullptr;
+        }
+
+        UsedSize_     += Aligned + Size - Current;
+        Offset_        = Aligned + Size - reinterpret_cast<std::uintptr_t>(Block.Data);
+        PeakUsedSize_  = std::max(PeakUsedSize_, UsedSize_);
+        return reinterpret_cast<void*>(Aligned);
+    }
+
+    NPGS_INLINE FLinearArenaScope::FLinearArenaScope(FLinearArena& Arena)
+        : Arena_(&Arena)
+        , Marker_(Arena.GetMarker())
+    {
+    }
+
+    NPGS_INLINE FLinearArenaScope::~FLinearArenaScope()
+    {
+        Arena_->Rewind(Marker_);
+    }
+
+    NPGS_INLINE FLinearArena* FLinearArenaScope::GetArena() const
+    {
+        return Arena_;
+    }
+} // namespace Npgs
@@ -1,9 +1,15 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -11,6 +17,14 @@
 
 #include <concurrentqueue/moodycamel/concurrentqueue.h>
 
+#include "Engine/Core/Base/Assert.hpp"
+
+// Memory pool poison
+// ------------------
+#ifdef _DEBUG
+#define NPGS_ENABLE_MEMORY_POOL_POISON
+#endif // _DEBUG
+
 namespace Npgs
 {
     template <typename Ty1>
@@ -28,13 +42,100 @@ namespace Npgs
     // template <typename Ty>
     // concept CHasPublicDestructor = requires(Ty* Ptr) { Ptr->~Ty(); };
 
-    template <typename MemoryType>
+    // 线程槽位分配器，槽位用于索引各个内存池中的线程本地空闲缓存，同一时刻每个槽位只属于一个线程
+    // 线程退出时先把所有内存池中该槽位缓存的句柄归还到共享空闲队列，再回收槽位供之后的线程复用
+    class FMemoryPoolThreadSlots
+    {
+    public:
+        using FFlushCallback = void(*)(void* Pool, std::size_t Slot);
+
+        static FMemoryPoolThreadSlots& GetInstance()
+        {
+            static FMemoryPoolThreadSlots Instance;
+            return Instance;
+        }
+
+        std::size_t Acquire()
+        {
+            std::lock_guard Lock(Mutex_);
+            if (FreeSlots_.empty())
+            {
+                return NextSlot_++;
+            }
+
+            // 优先复用最小的槽位，让槽位序号保持紧凑
+            std::ranges::pop_heap(FreeSlots_, std::greater<>{});
+            std::size_t Slot = FreeSlots_.back();
+            FreeSlots_.pop_back();
+            return Slot;
+        }
+
+        void Release(std::size_t Slot)
+        {
+            std::lock_guard Lock(Mutex_);
+            for (const auto& [Pool, Flush] : Pools_)
+            {
+                Flush(Pool, Slot);
+            }
+
+            FreeSlots_.push_back(Slot);
+            std::ranges::push_heap(FreeSlots_, std::greater<>{});
+        }
+
+        void RegisterPool(void* Pool, FFlushCallback Flush)
+        {
+            std::lock_guard Lock(Mutex_);
+            Pools_.emplace_back(Pool, Flush);
+        }
+
+        void UnregisterPool(void* Pool)
+        {
+            std::lock_guard Lock(Mutex_);
+            std::erase_if(Pools_, [Pool](const auto& Entry) -> bool { return Entry.first == Pool; });
+        }
+
+    private:
+        std::vector<std::pair<void*, FFlushCallback>> Pools_;
+        std::vector<std::size_t>                      FreeSlots_;
+        std::mutex                                    Mutex_;
+        std::size_t                                   NextSlot_{};
+    };
+
+    // 线程首次访问时领取槽位，线程退出时随 thread_local 对象析构归还
+    inline std::size_t GetMemoryPoolThreadSlot()
+    {
+        struct FSlotToken
+        {
+            FSlotToken()  : Slot(FMemoryPoolThreadSlots::GetInstance().Acquire()) {}
+            ~FSlotToken() { FMemoryPoolThreadSlots::GetInstance().Release(Slot); }
+
+            std::size_t Slot;
+        };
+
+        thread_local FSlotToken Token;
+        return Token.Slot;
+    }
+
+    template <typename MemoryType, std::size_t SlabSizeExponent = 14>
     // requires CHasPublicDestructor<MemoryType>
     class TMemoryPool
     {
     public:
         using FMemoryHandle = std::size_t;
 
+        static constexpr FMemoryHandle kInvalidHandle = std::numeric_limits<FMemoryHandle>::max();
+
+        // 统计数据由各 slab 的计数器汇总而来，并发分配期间只是近似值
+        struct FStatistics
+        {
+            std::size_t Capacity{};       // 已分配 slab 中的块总数
+            std::size_t LiveCount{};      // 存活对象数
+            std::size_t SlabCount{};      // 已分配的 slab 数
+            std::size_t EmptySlabCount{}; // 没有存活对象、可由 ShrinkToFit 回收的 slab 数
+            float       Occupancy{};      // 存活对象占总容量的比例
+            float       Fragmentation{};  // 非空 slab 中空闲块所占的比例，这部分内存无法通过 ShrinkToFit 归还
+        };
+
         class FMemoryGuard
         {
         public:
@@ -47,7 +148,7 @@ namespace Npgs
             FMemoryGuard(const FMemoryGuard&) = delete;
             FMemoryGuard(FMemoryGuard&& Other) noexcept
                 : Pool_(std::exchange(Other.Pool_, nullptr))
-                , Handle_(std::exchange(Other.Handle_, 0))
+                , Handle_(std::exchange(Other.Handle_, kInvalidHandle))
             {
             }
 
@@ -64,8 +165,9 @@ namespace Npgs
             {
                 if (this != &Other)
                 {
+                    Reset();
                     Pool_   = std::exchange(Other.Pool_, nullptr);
-                    Handle_ = std::exchange(Other.Handle_, 0);
+                    Handle_ = std::exchange(Other.Handle_, kInvalidHandle);
                 }
 
                 return *this;
@@ -96,9 +198,10 @@ namespace Npgs
                 return *Pool_->GetMemory(Handle_);
             }
 
+            // 默认构造、被移动、Reset 或 Release 之后的 guard 都不再持有池，统一视为空
             bool operator==(std::nullptr_t) const
             {
-                return Pool_ == nullptr && Handle_ == std::numeric_limits<FMemoryHandle>::max();
+                return Pool_ == nullptr;
             }
 
             bool operator!=(std::nullptr_t) const
@@ -116,6 +219,24 @@ namespace Npgs
                 return !(*this == Other);
             }
 
+            void Reset()
+            {
+                if (Pool_ != nullptr)
+                {
+                    Pool_->Deallocate(Handle_);
+                }
+
+                Pool_   = nullptr;
+                Handle_ = kInvalidHandle;
+            }
+
+            // 放弃所有权但不释放内存，之后需要通过 TMemoryPool::Adopt 重新接管
+            FMemoryHandle Release()
+            {
+                Pool_ = nullptr;
+                return std::exchange(Handle_, kInvalidHandle);
+            }
+
             MemoryType* Get()
             {
                 return Pool_ != nullptr ? Pool_->GetMemory(Handle_) : nullptr;
@@ -128,7 +249,7 @@ namespace Npgs
 
         private:
             TMemoryPool*  Pool_{ nullptr };
-            FMemoryHandle Handle_{ std::numeric_limits<FMemoryHandle>::max() };
+            FMemoryHandle Handle_{ kInvalidHandle };
         };
 
         struct alignas(MemoryType) FMemoryBlock
@@ -136,119 +257,408 @@ namespace Npgs
             std::array<std::byte, sizeof(MemoryType)> Memory;
         };
 
+        static constexpr std::size_t kSlabSizeExponent = SlabSizeExponent;
+        static constexpr std::size_t kSlabSize         = 1ull << kSlabSizeExponent;
+        static constexpr std::size_t kMaxSlabCount     = 1ull << 14;
+        static constexpr std::size_t kSlabSegmentBits  = 7;
+        static constexpr std::size_t kSlabSegmentSize  = 1ull << kSlabSegmentBits;
+        static constexpr std::size_t kLocalCacheSize   = 256;
+        static constexpr std::size_t kMaxLocalCaches   = 128;
+        static constexpr int         kPoisonByte       = 0xDD;
+
+    private:
+        // 固定大小的内存块，分配后地址不再变化，扩容只追加新的 slab，不会移动已有对象
+        // 存活计数放在 slab 自己的缓存行上，不同线程从不同 slab 分配时互不争用
+        struct FMemorySlab
+        {
+            std::array<FMemoryBlock, kSlabSize> Blocks;
+            alignas(64) std::atomic<std::size_t> LiveCount{};
+        };
+
+        // slab 目录分为两级，第二级的段在 slab 数量增长到对应范围时才分配，空池只占一级目录
+        // 段一经分配直到池析构才释放，读取 slab 指针时不需要加锁
+        using FSlabSegment = std::array<std::atomic<FMemorySlab*>, kSlabSegmentSize>;
+
+        // 每个线程独占一个缓存，只有所属线程会访问，因此无需加锁。线程退出时由槽位分配器清空
+        struct alignas(64) FLocalCache
+        {
+            std::array<FMemoryHandle, kLocalCacheSize> Handles{};
+            std::size_t                                Count{};
+        };
+
     public:
         explicit TMemoryPool(std::size_t InitialCapacity, bool bDynamicExpand = true)
-            : MemoryBlocks_(InitialCapacity, {})
+            : LocalCaches_(std::make_unique<std::atomic<FLocalCache*>[]>(kMaxLocalCaches))
             , bDynamicExpand_(bDynamicExpand)
         {
             static_assert(THasPublicDestructor<MemoryType>::kbValue, "MemoryType destructor must be public");
-            for (std::size_t i = 0; i != MemoryBlocks_.size(); ++i)
-            {
-                FreeList_.enqueue(i);
-            }
+            Reserve(InitialCapacity);
+            FMemoryPoolThreadSlots::GetInstance().RegisterPool(this, &TMemoryPool::FlushLocalCache);
         }
 
         TMemoryPool(const TMemoryPool&) = delete;
         TMemoryPool(TMemoryPool&&)      = delete;
-        ~TMemoryPool()                  = default;
+
+        ~TMemoryPool()
+        {
+            FMemoryPoolThreadSlots::GetInstance().UnregisterPool(this);
+            for (std::size_t i = 0; i != kMaxLocalCaches; ++i)
+            {
+                delete LocalCaches_[i].load(std::memory_order::relaxed);
+            }
+
+            for (std::size_t i = 0; i != SlabCount_.load(std::memory_order::acquire); ++i)
+            {
+                delete GetSlabEntry(i).load(std::memory_order::relaxed);
+            }
+
+            for (auto& Segment : SlabSegments_)
+            {
+                delete Segment.load(std::memory_order::relaxed);
+            }
+        }
 
         TMemoryPool& operator=(const TMemoryPool&) = delete;
         TMemoryPool& operator=(TMemoryPool&&)      = delete;
 
         template <typename... Types>
-        FMemoryGuard Allocate(Types... Args)
+        FMemoryGuard Allocate(Types&&... Args)
         {
-            FMemoryHandle MemoryHandle = 0;
-            if (FreeList_.try_dequeue(MemoryHandle))
+            FMemoryHandle MemoryHandle = AcquireHandle();
+#ifdef NPGS_ENABLE_MEMORY_POOL_POISON
+            NpgsAssert(IsPoisoned(MemoryHandle), "Memory pool block was written after being freed.");
+#endif // NPGS_ENABLE_MEMORY_POOL_POISON
+
+            try
             {
-                FMemoryBlock* MemoryBlock = &MemoryBlocks_[MemoryHandle];
-                new (MemoryBlock->Memory.data()) MemoryType(std::forward<Types>(Args)...);
-                return FMemoryGuard(this, MemoryHandle);
+                new (GetMemory(MemoryHandle)) MemoryType(std::forward<Types>(Args)...);
             }
-
-            if (!bDynamicExpand_)
+            catch (...)
             {
-                throw std::runtime_error("Failed to allocate memory: no available memory");
+                RecycleHandle(MemoryHandle);
+                throw;
             }
 
-            std::size_t NewCapacity = Capacity() + Capacity() / 2;
-            MemoryBlocks_.resize(NewCapacity);
-            return Allocate(std::forward<Types>(Args)...);
+            GetSlab(MemoryHandle)->LiveCount.fetch_add(1, std::memory_order::relaxed);
+            return FMemoryGuard(this, MemoryHandle);
+        }
+
+        // 接管由 FMemoryGuard::Release 放弃的句柄
+        FMemoryGuard Adopt(FMemoryHandle Handle)
+        {
+            return FMemoryGuard(this, Handle);
+        }
+
+        // 无所有权访问，句柄必须来自 FMemoryGuard::Release 且尚未被接管
+        MemoryType* GetMemoryUnsafe(FMemoryHandle Handle)
+        {
+            return GetMemory(Handle);
         }
 
         void Reserve(std::size_t NewCapacity)
         {
-            if (NewCapacity < Capacity())
+            std::lock_guard Lock(ExpandMutex_);
+            while (Capacity() < NewCapacity)
             {
-                return;
+                AddSlab();
             }
+        }
 
-            std::size_t OldSize = MemoryBlocks_.size();
-            MemoryBlocks_.resize(NewCapacity);
+        // 回收完全空闲的 slab，并按地址顺序重建空闲链表，使后续分配优先填满低地址的 slab
+        // 存活对象不会被移动（外部持有其原始指针），因此调用期间不能有其他线程分配或释放
+        void ShrinkToFit()
+        {
+            std::lock_guard Lock(ExpandMutex_);
 
-            for (std::size_t i = OldSize; i != NewCapacity; ++i)
+            std::vector<FMemoryHandle> FreeHandles;
+            FreeHandles.reserve(AvailableApprox());
+            for (std::size_t i = 0; i != kMaxLocalCaches; ++i)
             {
-                FreeList_.enqueue(i);
+                FLocalCache* Cache = LocalCaches_[i].load(std::memory_order::acquire);
+                if (Cache != nullptr)
+                {
+                    FreeHandles.insert(FreeHandles.end(), Cache->Handles.begin(), Cache->Handles.begin() + Cache->Count);
+                    Cache->Count = 0;
+                }
             }
-        }
 
-        void ShrinkToFit() // TODO
-        {
-            std::size_t TargetCapacity = std::max(FreeList_.size_approx(), SizeApprox());
-            if (MemoryBlocks_.size() <= TargetCapacity)
+            std::array<FMemoryHandle, kLocalCacheSize> Buffer{};
+            while (std::size_t Count = FreeList_.try_dequeue_bulk(Buffer.data(), Buffer.size()))
             {
-                return;
+                FreeHandles.insert(FreeHandles.end(), Buffer.begin(), Buffer.begin() + Count);
             }
 
-            std::vector<FMemoryBlock> NewMemoryBlocks(TargetCapacity);
-            moodycamel::ConcurrentQueue<FMemoryHandle> NewFreeList;
-            std::size_t CurrentIndex = 0;
+            std::size_t SlabCount = SlabCount_.load(std::memory_order::relaxed);
+            for (std::size_t i = 0; i != SlabCount; ++i)
+            {
+                FMemorySlab* Slab = GetSlabEntry(i).load(std::memory_order::relaxed);
+                if (Slab != nullptr && Slab->LiveCount.load(std::memory_order::relaxed) == 0)
+                {
+                    delete GetSlabEntry(i).exchange(nullptr, std::memory_order::acq_rel);
+                    AllocatedSlabCount_.fetch_sub(1, std::memory_order::relaxed);
+                }
+            }
 
-            std::vector<FMemoryHandle> FreeHandles;
-            FMemoryHandle Handle = 0;
-            while (FreeList_.try_dequeue(Handle))
+            while (SlabCount != 0 && GetSlabEntry(SlabCount - 1).load(std::memory_order::relaxed) == nullptr)
             {
-                FreeHandles.push_back(Handle);
+                --SlabCount;
             }
+            SlabCount_.store(SlabCount, std::memory_order::release);
+
+            std::erase_if(FreeHandles, [this](FMemoryHandle Handle) -> bool
+            {
+                return GetSlabEntry(Handle >> kSlabSizeExponent).load(std::memory_order::relaxed) == nullptr;
+            });
+            std::ranges::sort(FreeHandles);
 
-            std::vector<bool> InUsed(MemoryBlocks_.size(), true);
-            for (FMemoryHandle FreeHandle : FreeHandles)
+            if (!FreeHandles.empty())
             {
-                InUsed[FreeHandle] = false;
+                FreeList_.enqueue_bulk(FreeHandles.data(), FreeHandles.size());
             }
         }
 
         std::size_t AvailableApprox() const
         {
-            return FreeList_.size_approx();
+            return Capacity() - SizeApprox();
         }
 
         std::size_t SizeApprox() const
         {
-            return MemoryBlocks_.size() - FreeList_.size_approx();
+            std::size_t LiveCount = 0;
+            ForEachSlab([&](const FMemorySlab& Slab) -> void
+            {
+                LiveCount += Slab.LiveCount.load(std::memory_order::relaxed);
+            });
+
+            return LiveCount;
         }
 
         std::size_t Capacity() const
         {
-            return MemoryBlocks_.capacity();
+            return AllocatedSlabCount_.load(std::memory_order::relaxed) * kSlabSize;
+        }
+
+        FStatistics GetStatistics() const
+        {
+            FStatistics Statistics;
+            std::size_t UsedSlabCount = 0;
+            ForEachSlab([&](const FMemorySlab& Slab) -> void
+            {
+                std::size_t LiveCount = Slab.LiveCount.load(std::memory_order::relaxed);
+                Statistics.LiveCount += LiveCount;
+                ++Statistics.SlabCount;
+                LiveCount == 0 ? ++Statistics.EmptySlabCount : ++UsedSlabCount;
+            });
+
+            Statistics.Capacity = Statistics.SlabCount * kSlabSize;
+            if (Statistics.Capacity != 0)
+            {
+                Statistics.Occupancy = static_cast<float>(Statistics.LiveCount) / static_cast<float>(Statistics.Capacity);
+            }
+
+            if (UsedSlabCount != 0)
+            {
+                std::size_t UsedCapacity = UsedSlabCount * kSlabSize;
+                Statistics.Fragmentation =
+                    static_cast<float>(UsedCapacity - Statistics.LiveCount) / static_cast<float>(UsedCapacity);
+            }
+
+            return Statistics;
         }
 
     private:
+        FMemoryHandle AcquireHandle()
+        {
+            FMemoryHandle MemoryHandle = 0;
+
+            FLocalCache* Cache = GetLocalCache();
+            if (Cache != nullptr)
+            {
+                if (Cache->Count == 0)
+                {
+                    Cache->Count = FreeList_.try_dequeue_bulk(Cache->Handles.data(), kLocalCacheSize / 2);
+                }
+
+                if (Cache->Count != 0)
+                {
+                    return Cache->Handles[--Cache->Count];
+                }
+            }
+
+            while (!FreeList_.try_dequeue(MemoryHandle))
+            {
+                if (!bDynamicExpand_)
+                {
+                    throw std::runtime_error("Failed to allocate memory: no available memory");
+                }
+
+                std::lock_guard Lock(ExpandMutex_);
+                if (FreeList_.size_approx() == 0)
+                {
+                    AddSlab();
+                }
+            }
+
+            return MemoryHandle;
+        }
+
         void Deallocate(FMemoryHandle Handle)
         {
+#ifdef NPGS_ENABLE_MEMORY_POOL_POISON
+            NpgsAssert(!IsPoisoned(Handle), "Memory pool block freed twice.");
+#endif // NPGS_ENABLE_MEMORY_POOL_POISON
+
             GetMemory(Handle)->~MemoryType();
-            FreeList_.enqueue(Handle);
+            GetSlab(Handle)->LiveCount.fetch_sub(1, std::memory_order::relaxed);
+            RecycleHandle(Handle);
+        }
+
+        void RecycleHandle(FMemoryHandle Handle)
+        {
+#ifdef NPGS_ENABLE_MEMORY_POOL_POISON
+            std::memset(GetMemory(Handle), kPoisonByte, sizeof(MemoryType));
+#endif // NPGS_ENABLE_MEMORY_POOL_POISON
+
+            FLocalCache* Cache = GetLocalCache();
+            if (Cache == nullptr)
+            {
+                FreeList_.enqueue(Handle);
+                return;
+            }
+
+            if (Cache->Count == kLocalCacheSize)
+            {
+                FreeList_.enqueue_bulk(Cache->Handles.data() + kLocalCacheSize / 2, kLocalCacheSize / 2);
+                Cache->Count = kLocalCacheSize / 2;
+            }
+
+            Cache->Handles[Cache->Count++] = Handle;
+        }
+
+        // 调用方需持有 ExpandMutex_
+        void AddSlab()
+        {
+            std::size_t SlabCount = SlabCount_.load(std::memory_order::relaxed);
+            std::size_t SlabIndex = 0;
+            while (SlabIndex != SlabCount && GetSlabEntry(SlabIndex).load(std::memory_order::relaxed) != nullptr)
+            {
+                ++SlabIndex;
+            }
+
+            if (SlabIndex == kMaxSlabCount)
+            {
+                throw std::runtime_error("Failed to allocate memory: slab count limit exceeded");
+            }
+
+            auto& Segment = SlabSegments_[SlabIndex >> kSlabSegmentBits];
+            if (Segment.load(std::memory_order::relaxed) == nullptr)
+            {
+                Segment.store(new FSlabSegment{}, std::memory_order::release);
+            }
+
+            auto* Slab = new FMemorySlab;
+#ifdef NPGS_ENABLE_MEMORY_POOL_POISON
+            std::memset(Slab->Blocks.data(), kPoisonByte, sizeof(Slab->Blocks));
+#endif // NPGS_ENABLE_MEMORY_POOL_POISON
+
+            GetSlabEntry(SlabIndex).store(Slab, std::memory_order::release);
+            AllocatedSlabCount_.fetch_add(1, std::memory_order::relaxed);
+            if (SlabIndex == SlabCount)
+            {
+                SlabCount_.store(SlabCount + 1, std::memory_order::release);
+            }
+
+            std::vector<FMemoryHandle> NewHandles(kSlabSize);
+            std::iota(NewHandles.begin(), NewHandles.end(), SlabIndex << kSlabSizeExponent);
+            FreeList_.enqueue_bulk(NewHandles.data(), NewHandles.size());
+        }
+
+        // 缓存在槽位所属线程第一次使用时分配，没有访问过的线程不占内存
+        FLocalCache* GetLocalCache()
+        {
+            std::size_t Slot = GetMemoryPoolThreadSlot();
+            if (Slot >= kMaxLocalCaches)
+            {
+                return nullptr;
+            }
+
+            FLocalCache* Cache = LocalCaches_[Slot].load(std::memory_order::relaxed);
+            if (Cache == nullptr)
+            {
+                Cache = new FLocalCache;
+                LocalCaches_[Slot].store(Cache, std::memory_order::release);
+            }
+
+            return Cache;
+        }
+
+        // 由退出线程在槽位分配器的锁内调用，此时该槽位的缓存不会再被其他线程访问
+        static void FlushLocalCache(void* Pool, std::size_t Slot)
+        {
+            auto* Self = static_cast<TMemoryPool*>(Pool);
+            if (Slot >= kMaxLocalCaches)
+            {
+                return;
+            }
+
+            FLocalCache* Cache = Self->LocalCaches_[Slot].load(std::memory_order::relaxed);
+            if (Cache != nullptr && Cache->Count != 0)
+            {
+                Self->FreeList_.enqueue_bulk(Cache->Handles.data(), Cache->Count);
+                Cache->Count = 0;
+            }
+        }
+
+        // SlabIndex 所在的段必须已经分配：SlabIndex 小于 SlabCount_，或由 AddSlab 刚刚分配
+        std::atomic<FMemorySlab*>& GetSlabEntry(std::size_t SlabIndex) const
+        {
+            FSlabSegment* Segment = SlabSegments_[SlabIndex >> kSlabSegmentBits].load(std::memory_order::acquire);
+            return (*Segment)[SlabIndex & (kSlabSegmentSize - 1)];
+        }
+
+        FMemorySlab* GetSlab(FMemoryHandle Handle)
+        {
+            return GetSlabEntry(Handle >> kSlabSizeExponent).load(std::memory_order::acquire);
         }
 
         MemoryType* GetMemory(FMemoryHandle Handle)
         {
-            auto* Block = &MemoryBlocks_[Handle];
-            return reinterpret_cast<MemoryType*>(Block->Memory.data());
+            return reinterpret_cast<MemoryType*>(GetSlab(Handle)->Blocks[Handle & (kSlabSize - 1)].Memory.data());
         }
-        
+
+        template <typename Func>
+        void ForEachSlab(Func&& Function) const
+        {
+            std::size_t SlabCount = SlabCount_.load(std::memory_order::acquire);
+            for (std::size_t i = 0; i != SlabCount; ++i)
+            {
+                const FMemorySlab* Slab = GetSlabEntry(i).load(std::memory_order::acquire);
+                if (Slab != nullptr)
+                {
+                    Function(*Slab);
+                }
+            }
+        }
+
+#ifdef NPGS_ENABLE_MEMORY_POOL_POISON
+        // 空闲块整块填充 kPoisonByte，分配时检查填充是否完好以发现释放后写入
+        bool IsPoisoned(FMemoryHandle Handle)
+        {
+            const auto* Bytes = reinterpret_cast<const unsigned char*>(GetMemory(Handle));
+            return std::all_of(Bytes, Bytes + sizeof(MemoryType), [](unsigned char Byte) -> bool
+            {
+                return Byte == kPoisonByte;
+            });
+        }
+#endif // NPGS_ENABLE_MEMORY_POOL_POISON
+
     private:
-        moodycamel::ConcurrentQueue<FMemoryHandle> FreeList_;
-        std::vector<FMemoryBlock>                  MemoryBlocks_;
-        bool                                       bDynamicExpand_;
+        moodycamel::ConcurrentQueue<FMemoryHandle>                               FreeList_;
+        std::array<std::atomic<FSlabSegment*>, kMaxSlabCount / kSlabSegmentSize> SlabSegments_{};
+        std::unique_ptr<std::atomic<FLocalCache*>[]>                             LocalCaches_;
+        std::mutex                                                               ExpandMutex_;
+        std::atomic<std::size_t>                                                 SlabCount_{};
+        std::atomic<std::size_t>                                                 AllocatedSlabCount_{};
+        bool                                                                     bDynamicExpand_;
     };
 } // namespace Npgs
@@ -3,11 +3,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <concepts>
 #include <condition_variable>
 #include <deque>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
@@ -51,34 +54,35 @@ namespace Npgs
         }
     };
 
-    template <typename ResourceType, typename ResourceCreateInfoType, typename ResourceInfoType = TResourceInfo<ResourceType>>
+    // 空闲资源按桶存放，每个桶有独立的锁，获取和归还只锁住涉及的桶
+    // 桶是双端队列，末尾是优先取出的资源。归还时使用次数不少于末尾资源的放到末尾，否则放到开头，归还是 O(1)
+    // 获取时从末尾向开头检查桶内每个资源，同一个桶中的资源大小不一，末尾的资源不满足时仍要继续查找
+    // 维护时按 (UsageCount, LastUsedTimestamp) 重新排序
+    template <typename ResourceType, typename ResourceCreateInfoType, typename ResourceInfoType = TResourceInfo<ResourceType>,
+              std::size_t BucketCount = 1>
     class TResourcePool
     {
     public:
+        // 借出期间持有资源的信息记录，归还时整条记录放回空闲桶，往返过程中不重新创建记录
         class FResourceGuard
         {
         public:
             FResourceGuard() = default;
-            FResourceGuard(TResourcePool* Pool, ResourceType* Resource, std::size_t UsageCount)
-                : Pool_(Pool), Resource_(Resource), UsageCount_(UsageCount)
+            FResourceGuard(TResourcePool* Pool, std::unique_ptr<ResourceInfoType>&& ResourceInfo)
+                : Pool_(Pool), ResourceInfo_(std::move(ResourceInfo))
             {
             }
 
             FResourceGuard(const FResourceGuard&) = delete;
             FResourceGuard(FResourceGuard&& Other) noexcept
                 : Pool_(std::exchange(Other.Pool_, nullptr))
-                , Resource_(std::exchange(Other.Resource_, nullptr))
-                , UsageCount_(std::exchange(Other.UsageCount_, 0))
+                , ResourceInfo_(std::move(Other.ResourceInfo_))
             {
             }
 
             ~FResourceGuard()
             {
-                if (Pool_ != nullptr && Resource_ != nullptr)
-                {
-                    Pool_->ReleaseResource(Resource_, UsageCount_);
-                    Pool_->BusyResourceCount_.fetch_sub(1, std::memory_order::relaxed);
-                }
+                Release();
             }
 
             FResourceGuard& operator=(const FResourceGuard&) = delete;
@@ -86,9 +90,9 @@ namespace Npgs
             {
                 if (this != &Other)
                 {
-                    Pool_       = std::exchange(Other.Pool_, nullptr);
-                    Resource_   = std::exchange(Other.Resource_, nullptr);
-                    UsageCount_ = std::exchange(Other.UsageCount_, 0);
+                    Release();
+                    Pool_         = std::exchange(Other.Pool_, nullptr);
+                    ResourceInfo_ = std::move(Other.ResourceInfo_);
                 }
 
                 return *this;
@@ -96,28 +100,37 @@ namespace Npgs
 
             ResourceType* operator->()
             {
-                return Resource_;
+                return ResourceInfo_->Resource.get();
             }
 
             const ResourceType* operator->() const
             {
-                return Resource_;
+                return ResourceInfo_->Resource.get();
             }
 
             ResourceType& operator*()
             {
-                return *Resource_;
+                return *ResourceInfo_->Resource;
             }
 
             const ResourceType& operator*() const
             {
-                return *Resource_;
+                return *ResourceInfo_->Resource;
+            }
+
+        private:
+            void Release()
+            {
+                if (Pool_ != nullptr && ResourceInfo_ != nullptr)
+                {
+                    Pool_->BusyResourceCount_.fetch_sub(1, std::memory_order::relaxed);
+                    Pool_->ReleaseResource(std::move(ResourceInfo_));
+                }
             }
 
         private:
-            TResourcePool* Pool_{ nullptr };
-            ResourceType*  Resource_{ nullptr };
-            std::size_t    UsageCount_{};
+            TResourcePool*                    Pool_{ nullptr };
+            std::unique_ptr<ResourceInfoType> ResourceInfo_;
         };
 
         struct FStatisticsInfo
@@ -127,6 +140,8 @@ namespace Npgs
             std::uint32_t PeakResourceDemand;
         };
 
+        static constexpr std::size_t kBucketCount = BucketCount;
+
     public:
         TResourcePool(std::uint32_t MinAvailablePoolLimit, std::uint32_t MaxAllocatedPoolLimit,
                       std::uint32_t PoolReclaimThresholdMs, std::uint32_t MaintenanceIntervalMs)
@@ -153,8 +168,10 @@ namespace Npgs
 
         void Reset()
         {
-            std::lock_guard Lock(Mutex_);
-            AvailableResources_.clear();
+            ModifyAvailableResources([](std::vector<std::unique_ptr<ResourceInfoType>>& Resources) -> void
+            {
+                Resources.clear();
+            });
         }
 
         void SetMinAvailableResourceLimit(std::uint32_t MinAvailableResourceLimit)
@@ -204,84 +221,74 @@ namespace Npgs
         {
             return FStatisticsInfo
             {
-                .AvailableResourceCount = AvailableResources_.size(),
+                .AvailableResourceCount = AvailableResourceCount_.load(),
                 .BusyResourceCount      = BusyResourceCount_.load(),
                 .PeakResourceDemand     = PeakResourceDemand_.load()
             };
         }
 
     protected:
+        // 依次在 [FirstBucket, LastBucket] 中查找满足 Pred 的资源，靠前的桶优先。每个桶内从末尾开始检查
         template <typename Func>
         requires std::predicate<Func, const std::unique_ptr<ResourceInfoType>&>
-        FResourceGuard AcquireResource(const ResourceCreateInfoType& CreateInfo, Func&& Pred)
+        FResourceGuard AcquireResource(const ResourceCreateInfoType& CreateInfo, std::size_t FirstBucket, std::size_t LastBucket, Func&& Pred)
         {
-            std::unique_lock Lock(Mutex_);
+            NpgsAssert(FirstBucket <= LastBucket && LastBucket < kBucketCount, "Invalid resource bucket range.");
 
-            std::vector<typename std::deque<std::unique_ptr<ResourceInfoType>>::iterator> MatchedResources;
-            for (auto it = AvailableResources_.begin(); it != AvailableResources_.end(); ++it)
+            std::unique_ptr<ResourceInfoType> ResourceInfo;
+            for (std::size_t Bucket = FirstBucket; Bucket <= LastBucket; ++Bucket)
             {
-                if (Pred(*it))
+                if (TakeResource(Bucket, Pred, ResourceInfo))
                 {
-                    MatchedResources.push_back(it);
+                    return MakeGuard(std::move(ResourceInfo));
                 }
             }
 
-            if (!MatchedResources.empty())
+            if (ReserveAllocation())
             {
-                if (MatchedResources.size() > 1)
-                {
-                    std::ranges::sort(MatchedResources, [](const auto& Lhs, const auto& Rhs) -> bool
-                    {
-                        return (*Lhs)->UsageCount       != (*Rhs)->UsageCount ?
-                               (*Lhs)->UsageCount        > (*Rhs)->UsageCount :
-                               (*Lhs)->LastUsedTimestamp > (*Rhs)->LastUsedTimestamp;
-                    });
-                }
-
-                auto BestIt = MatchedResources.front();
-                ResourceType* Resource = (*BestIt)->Resource.release();
-                std::size_t UsageCount = (*BestIt)->UsageCount + 1;
-                AvailableResources_.erase(BestIt);
-
-                BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
-                IncreasePeakDemand();
-
-                return FResourceGuard(this, Resource, UsageCount);
+                return MakeGuard(CreateReservedResource(CreateInfo));
             }
 
-            if (BusyResourceCount_.load() + AvailableResources_.size() < MaxAllocatedResourceLimit_)
+            constexpr std::uint32_t kMaxWaitTimeMs = 2000;
+            bool bReleased = false;
             {
-                auto ResourceInfo = CreateResource(CreateInfo);
-                ResourceType* Resource = ResourceInfo->Resource.release();
-
-                BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
-                IncreasePeakDemand();
+                std::unique_lock Lock(Mutex_);
+                WaiterCount_.fetch_add(1);
+                bReleased = Condition_.wait_for(Lock, std::chrono::milliseconds(kMaxWaitTimeMs), [&]() -> bool
+                {
+                    for (std::size_t Bucket = FirstBucket; Bucket <= LastBucket; ++Bucket)
+                    {
+                        std::lock_guard BucketLock(Buckets_[Bucket].Mutex);
+                        if (std::ranges::any_of(Buckets_[Bucket].Resources, Pred))
+                        {
+                            return true;
+                        }
+                    }
 
-                return FResourceGuard(this, Resource, 1);
+                    return false;
+                });
+                WaiterCount_.fetch_sub(1);
             }
 
-            constexpr std::uint32_t kMaxWaitTimeMs = 2000;
-            if (Condition_.wait_for(Lock, std::chrono::milliseconds(kMaxWaitTimeMs),
-                [this, &Pred]() -> bool { return std::ranges::any_of(AvailableResources_, Pred); }))
+            if (bReleased)
             {
-                Lock.unlock();
-                return AcquireResource(CreateInfo, Pred);
+                return AcquireResource(CreateInfo, FirstBucket, LastBucket, Pred);
             }
 
-            if (!AvailableResources_.empty())
+            // 等待超时，从使用次数最少的资源开始尝试就地替换
+            for (auto& Bucket : Buckets_)
             {
-                for (auto it = AvailableResources_.begin(); it != AvailableResources_.end(); ++it)
+                std::lock_guard Lock(Bucket.Mutex);
+                for (auto it = Bucket.Resources.begin(); it != Bucket.Resources.end(); ++it)
                 {
                     if (HandleResourceEmergency(CreateInfo, **it))
                     {
-                        ResourceType* Resource = (*it)->Resource.release();
-                        std::size_t UsageCount = (*it)->UsageCount + 1;
-                        AvailableResources_.erase(it);
-
-                        BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
-                        IncreasePeakDemand();
+                        ResourceInfo = std::move(*it);
+                        ++ResourceInfo->UsageCount;
+                        Bucket.Resources.erase(it);
+                        AvailableResourceCount_.fetch_sub(1, std::memory_order::relaxed);
 
-                        return FResourceGuard(this, Resource, UsageCount);
+                        return MakeGuard(std::move(ResourceInfo));
                     }
                 }
             }
@@ -291,38 +298,36 @@ namespace Npgs
 
         template <typename Func>
         requires std::predicate<Func, const std::unique_ptr<ResourceInfoType>&>
-        FResourceGuard AcquireResourceLastUsed(const ResourceCreateInfoType& CreateInfo, Func&& Pred)
+        FResourceGuard AcquireResource(const ResourceCreateInfoType& CreateInfo, Func&& Pred)
         {
-            std::unique_lock Lock(Mutex_);
+            return AcquireResource(CreateInfo, 0, kBucketCount - 1, std::forward<Func>(Pred));
+        }
 
-            if (!AvailableResources_.empty())
+        // 只检查各桶中最优的资源，不满足 Pred 且不能再创建时退回到 AcquireResource
+        template <typename Func>
+        requires std::predicate<Func, const std::unique_ptr<ResourceInfoType>&>
+        FResourceGuard AcquireResourceLastUsed(const ResourceCreateInfoType& CreateInfo, Func&& Pred)
+        {
+            for (auto& Bucket : Buckets_)
             {
-                auto& LastResource = AvailableResources_.back();
-                if (Pred(LastResource))
+                std::unique_lock Lock(Bucket.Mutex);
+                if (!Bucket.Resources.empty() && Pred(Bucket.Resources.back()))
                 {
-                    ResourceType* Resource = LastResource->Resource.release();
-                    std::size_t UsageCount = LastResource->UsageCount + 1;
-                    AvailableResources_.pop_back();
+                    auto ResourceInfo = std::move(Bucket.Resources.back());
+                    ++ResourceInfo->UsageCount;
+                    Bucket.Resources.pop_back();
+                    AvailableResourceCount_.fetch_sub(1, std::memory_order::relaxed);
+                    Lock.unlock();
 
-                    BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
-                    IncreasePeakDemand();
-
-                    return FResourceGuard(this, Resource, UsageCount);
+                    return MakeGuard(std::move(ResourceInfo));
                 }
             }
 
-            if (BusyResourceCount_.load() + AvailableResources_.size() < MaxAllocatedResourceLimit_)
+            if (ReserveAllocation())
             {
-                auto ResourceInfo = CreateResource(CreateInfo);
-                ResourceType* Resource = ResourceInfo->Resource.release();
-
-                BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
-                IncreasePeakDemand();
-
-                return FResourceGuard(this, Resource, 1);
+                return MakeGuard(CreateReservedResource(CreateInfo));
             }
 
-            Lock.unlock();
             return AcquireResource(CreateInfo, std::forward<Func>(Pred));
         }
 
@@ -334,60 +339,143 @@ namespace Npgs
             // Default implementation does nothing.
         }
 
-        virtual void ReleaseResource(ResourceType* Resource, std::size_t UsageCount)
+        // 资源归还时放入的桶，返回值必须小于 kBucketCount
+        virtual std::size_t GetBucketIndex(const ResourceInfoType& ResourceInfo) const
+        {
+            return 0;
+        }
+
+        // ResourceInfo 是借出时取出的同一条记录，UsageCount 已在借出时累加
+        virtual void ReleaseResource(std::unique_ptr<ResourceInfoType>&& ResourceInfo)
+        {
+            ResourceInfo->LastUsedTimestamp = GetCurrentTimeMs();
+
+            OnReleaseResource(*ResourceInfo);
+            PushAvailableResource(std::move(ResourceInfo));
+        }
+
+        void PushAvailableResource(std::unique_ptr<ResourceInfoType>&& ResourceInfo)
         {
-            std::lock_guard Lock(Mutex_);
+            std::size_t BucketIndex = GetBucketIndex(*ResourceInfo);
+            NpgsAssert(BucketIndex < kBucketCount, "Resource bucket index out of range.");
 
-            auto ResourceInfoPtr = std::make_unique<ResourceInfoType>();
-            ResourceInfoPtr->Resource          = std::unique_ptr<ResourceType>(Resource);
-            ResourceInfoPtr->LastUsedTimestamp = GetCurrentTimeMs();
-            ResourceInfoPtr->UsageCount        = UsageCount;
+            {
+                auto& Bucket = Buckets_[BucketIndex];
+                std::lock_guard Lock(Bucket.Mutex);
+                if (Bucket.Resources.empty() || !IsLowerPriority(ResourceInfo, Bucket.Resources.back()))
+                {
+                    Bucket.Resources.push_back(std::move(ResourceInfo));
+                }
+                else
+                {
+                    Bucket.Resources.push_front(std::move(ResourceInfo));
+                }
+            }
 
-            OnReleaseResource(*ResourceInfoPtr);
+            AvailableResourceCount_.fetch_add(1, std::memory_order::relaxed);
 
-            AvailableResources_.push_back(std::move(ResourceInfoPtr));
-            Condition_.notify_one();
+            // 与等待者中 WaiterCount_ 的递增配对：要么这里看到等待者，要么等待者的检查能看到刚放入的资源
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            if (WaiterCount_.load(std::memory_order::relaxed) != 0)
+            {
+                std::lock_guard Lock(Mutex_);
+                Condition_.notify_all();
+            }
         }
 
-        virtual void OptimizeResourceCount()
+        // 锁住所有桶，把全部空闲资源交给 Modifier 增删或重排，之后重新分桶。只用于维护等低频操作
+        template <typename Func>
+        void ModifyAvailableResources(Func&& Modifier)
         {
-            std::size_t CurrentTimeMs = GetCurrentTimeMs();
-            std::lock_guard Lock(Mutex_);
+            std::array<std::unique_lock<std::mutex>, kBucketCount> Locks;
+            std::vector<std::unique_ptr<ResourceInfoType>> Resources;
+            for (std::size_t i = 0; i != kBucketCount; ++i)
+            {
+                Locks[i] = std::unique_lock(Buckets_[i].Mutex);
+                std::ranges::move(Buckets_[i].Resources, std::back_inserter(Resources));
+                Buckets_[i].Resources.clear();
+            }
+
+            std::size_t OldCount = Resources.size();
+            Modifier(Resources);
 
+            for (auto& ResourceInfo : Resources)
+            {
+                std::size_t BucketIndex = GetBucketIndex(*ResourceInfo);
+                NpgsAssert(BucketIndex < kBucketCount, "Resource bucket index out of range.");
+                Buckets_[BucketIndex].Resources.push_back(std::move(ResourceInfo));
+            }
+
+            for (auto& Bucket : Buckets_)
+            {
+                std::ranges::sort(Bucket.Resources, &TResourcePool::IsLowerPriority);
+            }
+
+            AvailableResourceCount_.store(static_cast<std::uint32_t>(Resources.size()), std::memory_order::relaxed);
+            if (Resources.size() >= OldCount)
+            {
+                AllocatedResourceCount_.fetch_add(static_cast<std::uint32_t>(Resources.size() - OldCount), std::memory_order::relaxed);
+            }
+            else
+            {
+                AllocatedResourceCount_.fetch_sub(static_cast<std::uint32_t>(OldCount - Resources.size()), std::memory_order::relaxed);
+            }
+        }
+
+        virtual void OptimizeResourceCount()
+        {
             std::uint32_t TargetCount = std::max(MinAvailableResourceLimit_, PeakResourceDemand_.load());
-            if (AvailableResources_.size() > TargetCount)
+            if (AvailableResourceCount_.load(std::memory_order::relaxed) <= TargetCount)
             {
-                std::erase_if(AvailableResources_, [&](const auto& ResourceInfo) -> bool
-                {
-                    return CurrentTimeMs - ResourceInfo->LastUsedTimestamp > ResourceReclaimThresholdMs_;
-                });
+                return;
             }
 
-            if (AvailableResources_.size() > TargetCount)
+            ModifyAvailableResources([&](std::vector<std::unique_ptr<ResourceInfoType>>& Resources) -> void
             {
-                std::ranges::sort(AvailableResources_, [](const auto& Lhs, const auto& Rhs) -> bool
+                // 在持有所有桶的锁之后取时间，保证不早于任何记录中的时间戳
+                std::size_t CurrentTimeMs = GetCurrentTimeMs();
+                std::erase_if(Resources, [&](const auto& ResourceInfo) -> bool
                 {
-                    return Lhs->UsageCount > Rhs->UsageCount;
+                    return CurrentTimeMs - ResourceInfo->LastUsedTimestamp > ResourceReclaimThresholdMs_;
                 });
 
-                AvailableResources_.resize(TargetCount);
-            }
+                if (Resources.size() > TargetCount)
+                {
+                    std::ranges::sort(Resources, [](const auto& Lhs, const auto& Rhs) -> bool
+                    {
+                        return Lhs->UsageCount > Rhs->UsageCount;
+                    });
+
+                    Resources.resize(TargetCount);
+                }
+            });
         }
 
+        // 单调时钟，只用于计算闲置时长，不受系统时间调整影响
         std::size_t GetCurrentTimeMs() const
         {
             return std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()).count();
+                std::chrono::steady_clock::now().time_since_epoch()).count();
         }
 
+    private:
+        struct alignas(64) FResourceBucket
+        {
+            std::mutex                                    Mutex;
+            std::deque<std::unique_ptr<ResourceInfoType>> Resources;
+        };
+
     protected:
-        std::mutex                                    Mutex_;
+        std::mutex                                    Mutex_;    // 只用于等待资源归还
         std::mutex                                    MaintenanceMutex_;
         std::condition_variable                       Condition_;
         std::condition_variable                       MaintenanceCondition_;
-        std::deque<std::unique_ptr<ResourceInfoType>> AvailableResources_;
+        std::array<FResourceBucket, kBucketCount>     Buckets_;
+        std::atomic<std::uint32_t>                    AvailableResourceCount_{};
+        std::atomic<std::uint32_t>                    AllocatedResourceCount_{};  // 空闲与使用中的资源总数
         std::atomic<std::uint32_t>                    BusyResourceCount_{};
         std::atomic<std::uint32_t>                    PeakResourceDemand_{};
+        std::atomic<std::uint32_t>                    WaiterCount_{};
 
         std::uint32_t                                 MinAvailableResourceLimit_;
         std::uint32_t                                 MaxAllocatedResourceLimit_;
@@ -400,6 +488,71 @@ namespace Npgs
         std::jthread                                  MaintenanceThread_;
 
     private:
+        static bool IsLowerPriority(const std::unique_ptr<ResourceInfoType>& Lhs, const std::unique_ptr<ResourceInfoType>& Rhs)
+        {
+            return Lhs->UsageCount != Rhs->UsageCount ?
+                   Lhs->UsageCount        < Rhs->UsageCount :
+                   Lhs->LastUsedTimestamp < Rhs->LastUsedTimestamp;
+        }
+
+        template <typename Func>
+        bool TakeResource(std::size_t BucketIndex, Func& Pred, std::unique_ptr<ResourceInfoType>& ResourceInfo)
+        {
+            auto& Bucket = Buckets_[BucketIndex];
+            std::lock_guard Lock(Bucket.Mutex);
+            for (auto it = Bucket.Resources.rbegin(); it != Bucket.Resources.rend(); ++it)
+            {
+                if (Pred(*it))
+                {
+                    ResourceInfo = std::move(*it);
+                    ++ResourceInfo->UsageCount;
+                    Bucket.Resources.erase(std::next(it).base());
+                    AvailableResourceCount_.fetch_sub(1, std::memory_order::relaxed);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // 在总数上限内预留一个名额，成功后由调用者创建资源
+        bool ReserveAllocation()
+        {
+            std::uint32_t AllocatedCount = AllocatedResourceCount_.load(std::memory_order::relaxed);
+            while (AllocatedCount < MaxAllocatedResourceLimit_)
+            {
+                if (AllocatedResourceCount_.compare_exchange_weak(AllocatedCount, AllocatedCount + 1, std::memory_order::relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        std::unique_ptr<ResourceInfoType> CreateReservedResource(const ResourceCreateInfoType& CreateInfo)
+        {
+            try
+            {
+                auto ResourceInfo = CreateResource(CreateInfo);
+                ResourceInfo->UsageCount = 1;
+                return ResourceInfo;
+            }
+            catch (...)
+            {
+                AllocatedResourceCount_.fetch_sub(1, std::memory_order::relaxed);
+                throw;
+            }
+        }
+
+        FResourceGuard MakeGuard(std::unique_ptr<ResourceInfoType>&& ResourceInfo)
+        {
+            BusyResourceCount_.fetch_add(1, std::memory_order::relaxed);
+            IncreasePeakDemand();
+
+            return FResourceGuard(this, std::move(ResourceInfo));
+        }
+
         void Maintenance()
         {
             while (!bStopMaintenance_.load())
@@ -35,9 +35,12 @@ namespace Npgs
     FStagingBufferPool::FBufferGuard FStagingBufferPool::AcquireBuffer(vk::DeviceSize RequestedSize)
     {
         vk::DeviceSize AlignedSize = AlignSize(RequestedSize);
+        vk::DeviceSize MaxSize     = std::max(AlignedSize * 2, RequestedSize + 1ull * 1024 * 1024);
 
+        // 满足条件的缓冲区只会位于 [RequestedSize, MaxSize] 覆盖的桶中
         FStagingBufferCreateInfo CreateInfo{ AlignedSize };
-        return AcquireResource(CreateInfo, [RequestedSize, AlignedSize](const std::unique_ptr<FStagingBufferInfo>& Info) -> bool
+        return AcquireResource(CreateInfo, GetSizeBucket(RequestedSize), GetSizeBucket(MaxSize),
+                               [RequestedSize, AlignedSize](const std::unique_ptr<FStagingBufferInfo>& Info) -> bool
         {
             return Info->Size >= RequestedSize && (Info->Size <= AlignedSize * 2 || Info->Size <= RequestedSize + 1ull * 1024 * 1024);
         });
@@ -86,187 +89,188 @@ namespace Npgs
         return false;
     }
 
-    void FStagingBufferPool::ReleaseResource(FStagingBuffer* Buffer, std::size_t UsageCount)
+    std::size_t FStagingBufferPool::GetBucketIndex(const FStagingBufferInfo& BufferInfo) const
     {
-        std::lock_guard Lock(Mutex_);
+        return GetSizeBucket(BufferInfo.Size);
+    }
 
-        Buffer->GetMemory().SetPersistentMapping(true);
-        auto BufferInfoPtr = std::make_unique<FStagingBufferInfo>();
-        BufferInfoPtr->LastUsedTimestamp = GetCurrentTimeMs();
-        BufferInfoPtr->UsageCount        = UsageCount;
-        BufferInfoPtr->Size              = Buffer->GetMemory().GetAllocationSize();
-        BufferInfoPtr->Resource          = std::make_unique<FStagingBuffer>(std::move(*Buffer));
+    void FStagingBufferPool::ReleaseResource(std::unique_ptr<FStagingBufferInfo>&& BufferInfo)
+    {
+        BufferInfo->Resource->GetMemory().SetPersistentMapping(true);
+        BufferInfo->LastUsedTimestamp = GetCurrentTimeMs();
+        BufferInfo->Size              = BufferInfo->Resource->GetMemory().GetAllocationSize();
 
-        AvailableResources_.push_back(std::move(BufferInfoPtr));
-        Condition_.notify_one();
+        PushAvailableResource(std::move(BufferInfo));
     }
 
     void FStagingBufferPool::OptimizeResourceCount()
     {
-        std::size_t CurrentTimeMs = GetCurrentTimeMs();
         std::uint32_t TargetCount = std::max(MinAvailableResourceLimit_, PeakResourceDemand_.load());
-        std::lock_guard Lock(Mutex_);
-
-        constexpr vk::DeviceSize kCompactSizeThreshold = 32uz * 1024 * 1024;
-        RemoveOversizedBuffers(kCompactSizeThreshold);
 
-        if (AvailableResources_.size() < MinAvailableResourceLimit_ &&
-            AvailableResources_.size() + BusyResourceCount_.load() < MaxAllocatedResourceLimit_)
+        ModifyAvailableResources([&](std::vector<std::unique_ptr<FStagingBufferInfo>>& Buffers) -> void
         {
-            std::size_t MinExtraCount = MinAvailableResourceLimit_ - AvailableResources_.size();
-            std::size_t MaxExtraCount = MaxAllocatedResourceLimit_ - AvailableResources_.size() - BusyResourceCount_.load();
-            std::size_t ExtraCount    = std::min(MinExtraCount, MaxExtraCount);
-            for (std::size_t i = 0; i != ExtraCount; ++i)
+            std::size_t CurrentTimeMs = GetCurrentTimeMs();
+            constexpr vk::DeviceSize kCompactSizeThreshold = 32uz * 1024 * 1024;
+            RemoveOversizedBuffers(Buffers, kCompactSizeThreshold);
+
+            if (Buffers.size() < MinAvailableResourceLimit_ &&
+                Buffers.size() + BusyResourceCount_.load() < MaxAllocatedResourceLimit_)
             {
-                FStagingBufferCreateInfo CreateInfo{ kSizeTiers[3] };
-                CreateResource(CreateInfo);
-            }
+                std::size_t MinExtraCount = MinAvailableResourceLimit_ - Buffers.size();
+                std::size_t MaxExtraCount = MaxAllocatedResourceLimit_ - Buffers.size() - BusyResourceCount_.load();
+                std::size_t ExtraCount    = std::min(MinExtraCount, MaxExtraCount);
+                for (std::size_t i = 0; i != ExtraCount; ++i)
+                {
+                    FStagingBufferCreateInfo CreateInfo{ kSizeTiers[3] };
+                    Buffers.push_back(CreateResource(CreateInfo));
+                }
 
-            return;
-        }
-        else if (AvailableResources_.size() == MinAvailableResourceLimit_)
-        {
-            return;
-        }
+                return;
+            }
+            else if (Buffers.size() == MinAvailableResourceLimit_)
+            {
+                return;
+            }
 
-        ankerl::unordered_dense::map<vk::DeviceSize, std::vector<std::size_t>> CategoryBufferIndices;
-        ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> CategoryUsages;
+            ankerl::unordered_dense::map<vk::DeviceSize, std::vector<std::size_t>> CategoryBufferIndices;
+            ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> CategoryUsages;
 
-        for (std::size_t i = 0; i != AvailableResources_.size(); ++i)
-        {
-            const auto& BufferInfo = *AvailableResources_[i];
-            CategoryBufferIndices[BufferInfo.Size].push_back(i);
-            CategoryUsages[BufferInfo.Size] += BufferInfo.UsageCount;
-        }
-
-        std::vector<std::size_t> BufferNeedRemove;
-        for (auto& [Size, Indices] : CategoryBufferIndices)
-        {
-            if (Indices.size() <= 1)
+            for (std::size_t i = 0; i != Buffers.size(); ++i)
             {
-                continue;
+                const auto& BufferInfo = *Buffers[i];
+                CategoryBufferIndices[BufferInfo.Size].push_back(i);
+                CategoryUsages[BufferInfo.Size] += BufferInfo.UsageCount;
             }
 
-            std::ranges::sort(Indices, [&](std::size_t Lhs, std::size_t Rhs) -> bool
+            std::vector<std::size_t> BufferNeedRemove;
+            for (auto& [Size, Indices] : CategoryBufferIndices)
             {
-                const auto& BufferA = *AvailableResources_[Lhs];
-                const auto& BufferB = *AvailableResources_[Rhs];
-
-                bool bExpiredA = (CurrentTimeMs - BufferA.LastUsedTimestamp > ResourceReclaimThresholdMs_);
-                bool bExpiredB = (CurrentTimeMs - BufferB.LastUsedTimestamp > ResourceReclaimThresholdMs_);
-                if (bExpiredA != bExpiredB)
+                if (Indices.size() <= 1)
                 {
-                    return bExpiredA;
+                    continue;
                 }
 
-                return BufferA.UsageCount < BufferB.UsageCount;
-            });
+                std::ranges::sort(Indices, [&](std::size_t Lhs, std::size_t Rhs) -> bool
+                {
+                    const auto& BufferA = *Buffers[Lhs];
+                    const auto& BufferB = *Buffers[Rhs];
 
-            for (std::size_t i = 0; i != Indices.size(); ++i)
-            {
-                const auto& BufferInfo = *AvailableResources_[Indices[i]];
-                if (CurrentTimeMs - BufferInfo.LastUsedTimestamp > ResourceReclaimThresholdMs_ && BufferInfo.UsageCount < 5)
+                    bool bExpiredA = (CurrentTimeMs - BufferA.LastUsedTimestamp > ResourceReclaimThresholdMs_);
+                    bool bExpiredB = (CurrentTimeMs - BufferB.LastUsedTimestamp > ResourceReclaimThresholdMs_);
+                    if (bExpiredA != bExpiredB)
+                    {
+                        return bExpiredA;
+                    }
+
+                    return BufferA.UsageCount < BufferB.UsageCount;
+                });
+
+                for (std::size_t i = 0; i != Indices.size(); ++i)
                 {
-                    BufferNeedRemove.push_back(Indices[i]);
+                    const auto& BufferInfo = *Buffers[Indices[i]];
+                    if (CurrentTimeMs - BufferInfo.LastUsedTimestamp > ResourceReclaimThresholdMs_ && BufferInfo.UsageCount < 5)
+                    {
+                        BufferNeedRemove.push_back(Indices[i]);
+                    }
                 }
             }
-        }
 
-        std::ranges::sort(BufferNeedRemove, std::greater<std::size_t>{});
-        for (std::size_t Index : BufferNeedRemove)
-        {
-            if (AvailableResources_.size() < TargetCount)
+            std::ranges::sort(BufferNeedRemove, std::greater<std::size_t>{});
+            for (std::size_t Index : BufferNeedRemove)
             {
-                break;
-            }
-
-            AvailableResources_.erase(AvailableResources_.begin() + Index);
-        }
+                if (Buffers.size() < TargetCount)
+                {
+                    break;
+                }
 
-        if (AvailableResources_.size() > TargetCount)
-        {
-            ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> RemainingCounts;
-            for (const auto& Resource : AvailableResources_)
-            {
-                const auto& BufferInfo = *Resource;
-                ++RemainingCounts[BufferInfo.Size];
+                Buffers.erase(Buffers.begin() + Index);
             }
 
-            std::size_t TotalRemoveCount = AvailableResources_.size() - TargetCount;
-            ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> NeedRemoveCounts;
-            for (auto [Size, Count] : RemainingCounts)
+            if (Buffers.size() > TargetCount)
             {
-                std::size_t MinKeep   = std::min<std::size_t>(1, Count);
-                std::size_t MaxRemove = std::max<std::size_t>(0, Count - MinKeep);
+                ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> RemainingCounts;
+                for (const auto& Resource : Buffers)
+                {
+                    const auto& BufferInfo = *Resource;
+                    ++RemainingCounts[BufferInfo.Size];
+                }
 
-                float       RemoveRatio = static_cast<float>(TotalRemoveCount) / AvailableResources_.size();
-                std::size_t RemoveCount = std::min(MaxRemove, static_cast<std::size_t>(Count * RemoveRatio + 0.5));
+                std::size_t TotalRemoveCount = Buffers.size() - TargetCount;
+                ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> NeedRemoveCounts;
+                for (auto [Size, Count] : RemainingCounts)
+                {
+                    std::size_t MinKeep   = std::min<std::size_t>(1, Count);
+                    std::size_t MaxRemove = std::max<std::size_t>(0, Count - MinKeep);
 
-                NeedRemoveCounts[Size] = RemoveCount;
-            }
+                    float       RemoveRatio = static_cast<float>(TotalRemoveCount) / Buffers.size();
+                    std::size_t RemoveCount = std::min(MaxRemove, static_cast<std::size_t>(Count * RemoveRatio + 0.5));
 
-            std::vector<std::pair<vk::DeviceSize, std::size_t>> IndexedBuffers;
-            for (std::size_t i = 0; i != AvailableResources_.size(); ++i)
-            {
-                const auto& BufferInfo = *AvailableResources_[i];
-                IndexedBuffers.emplace_back(BufferInfo.Size, i);
-            }
+                    NeedRemoveCounts[Size] = RemoveCount;
+                }
 
-            std::ranges::sort(IndexedBuffers, [&](const auto& Lhs, const auto& Rhs) -> bool
-            {
-                if (Lhs.first != Rhs.first)
+                std::vector<std::pair<vk::DeviceSize, std::size_t>> IndexedBuffers;
+                for (std::size_t i = 0; i != Buffers.size(); ++i)
                 {
-                    return false;
+                    const auto& BufferInfo = *Buffers[i];
+                    IndexedBuffers.emplace_back(BufferInfo.Size, i);
                 }
 
-                const auto& BufferA = *AvailableResources_[Lhs.second];
-                const auto& BufferB = *AvailableResources_[Rhs.second];
-
-                if (BufferA.LastUsedTimestamp != BufferB.LastUsedTimestamp)
+                std::ranges::sort(IndexedBuffers, [&](const auto& Lhs, const auto& Rhs) -> bool
                 {
-                    return BufferA.LastUsedTimestamp < BufferB.LastUsedTimestamp;
-                }
+                    if (Lhs.first != Rhs.first)
+                    {
+                        return false;
+                    }
 
-                return BufferA.UsageCount < BufferB.UsageCount;
-            });
+                    const auto& BufferA = *Buffers[Lhs.second];
+                    const auto& BufferB = *Buffers[Rhs.second];
 
-            std::vector<std::size_t> NeedRemoveIndices;
-            ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> RemovedCounts;
-            for (auto [Size, Index] : IndexedBuffers)
-            {
-                if (RemovedCounts[Size] < NeedRemoveCounts[Size])
-                {
-                    NeedRemoveIndices.push_back(Index);
-                    ++RemovedCounts[Size];
+                    if (BufferA.LastUsedTimestamp != BufferB.LastUsedTimestamp)
+                    {
+                        return BufferA.LastUsedTimestamp < BufferB.LastUsedTimestamp;
+                    }
+
+                    return BufferA.UsageCount < BufferB.UsageCount;
+                });
 
-                    if (NeedRemoveIndices.size() >= TotalRemoveCount)
+                std::vector<std::size_t> NeedRemoveIndices;
+                ankerl::unordered_dense::map<vk::DeviceSize, std::size_t> RemovedCounts;
+                for (auto [Size, Index] : IndexedBuffers)
+                {
+                    if (RemovedCounts[Size] < NeedRemoveCounts[Size])
                     {
-                        break;
+                        NeedRemoveIndices.push_back(Index);
+                        ++RemovedCounts[Size];
+
+                        if (NeedRemoveIndices.size() >= TotalRemoveCount)
+                        {
+                            break;
+                        }
                     }
                 }
-            }
 
-            std::ranges::sort(NeedRemoveIndices, std::greater<std::size_t>{});
-            for (std::size_t Index : NeedRemoveIndices)
-            {
-                if (AvailableResources_.size() < TargetCount)
+                std::ranges::sort(NeedRemoveIndices, std::greater<std::size_t>{});
+                for (std::size_t Index : NeedRemoveIndices)
                 {
-                    break;
-                }
+                    if (Buffers.size() < TargetCount)
+                    {
+                        break;
+                    }
 
-                AvailableResources_.erase(AvailableResources_.begin() + Index);
+                    Buffers.erase(Buffers.begin() + Index);
+                }
             }
-        }
+        });
     }
 
-    void FStagingBufferPool::RemoveOversizedBuffers(vk::DeviceSize Threshold)
+    void FStagingBufferPool::RemoveOversizedBuffers(std::vector<std::unique_ptr<FStagingBufferInfo>>& Buffers, vk::DeviceSize Threshold)
     {
         ankerl::unordered_dense::map<vk::DeviceSize, std::vector<std::size_t>> CategoryBufferIndices;
         ankerl::unordered_dense::map<vk::DeviceSize, std::size_t>              CategoryUsages;
 
-        for (std::size_t i = 0; i != AvailableResources_.size(); ++i)
+        for (std::size_t i = 0; i != Buffers.size(); ++i)
         {
-            const auto& BufferInfo = *AvailableResources_[i];
+            const auto& BufferInfo = *Buffers[i];
             CategoryBufferIndices[BufferInfo.Size].push_back(i);
             CategoryUsages[BufferInfo.Size] += BufferInfo.UsageCount;
         }
@@ -284,7 +288,7 @@ namespace Npgs
         std::ranges::sort(NeedRemoveIndices, std::greater<std::size_t>{});
         for (std::size_t Index : NeedRemoveIndices)
         {
-            AvailableResources_.erase(AvailableResources_.begin() + Index);
+            Buffers.erase(Buffers.begin() + Index);
         }
     }
 
@@ -299,4 +303,9 @@ namespace Npgs
         constexpr vk::DeviceSize kAlighment = 2ull * 1024 * 1024;
         return (RequestedSize + kAlighment - 1) & ~(kAlighment - 1);
     }
+
+    std::size_t FStagingBufferPool::GetSizeBucket(vk::DeviceSize Size) const
+    {
+        return std::ranges::lower_bound(kSizeTiers, Size) - kSizeTiers.begin();
+    }
 } // namespace Npgs
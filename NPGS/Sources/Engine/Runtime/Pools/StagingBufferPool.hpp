@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <array>
 #include <memory>
+#include <vector>
 
 #include <vma/vk_mem_alloc.h>
 #include <vulkan/vulkan.hpp>
@@ -23,7 +24,8 @@ namespace Npgs
         vk::DeviceSize Size{};
     };
 
-    class FStagingBufferPool : public TResourcePool<FStagingBuffer, FStagingBufferCreateInfo, FStagingBufferInfo>
+    // 每个尺寸档位一个桶，另有一个桶存放超过最大档位的缓冲区
+    class FStagingBufferPool : public TResourcePool<FStagingBuffer, FStagingBufferCreateInfo, FStagingBufferInfo, 10>
     {
     public:
         enum class EPoolUsage : std::uint8_t
@@ -33,7 +35,7 @@ namespace Npgs
         };
 
     public:
-        using Base = TResourcePool<FStagingBuffer, FStagingBufferCreateInfo, FStagingBufferInfo>;
+        using Base = TResourcePool<FStagingBuffer, FStagingBufferCreateInfo, FStagingBufferInfo, 10>;
         using FBufferGuard = Base::FResourceGuard;
 
         FStagingBufferPool(vk::PhysicalDevice PhysicalDevice, vk::Device Device, VmaAllocator Allocator,
@@ -45,10 +47,12 @@ namespace Npgs
     private:
         std::unique_ptr<FStagingBufferInfo> CreateResource(const FStagingBufferCreateInfo& CreateInfo) override;
         bool HandleResourceEmergency(const FStagingBufferCreateInfo& CreateInfo, FStagingBufferInfo& LowUsageResource) override;
-        void ReleaseResource(FStagingBuffer* Buffer, std::size_t UsageCount) override;
+        std::size_t GetBucketIndex(const FStagingBufferInfo& BufferInfo) const override;
+        void ReleaseResource(std::unique_ptr<FStagingBufferInfo>&& BufferInfo) override;
         void OptimizeResourceCount() override;
-        void RemoveOversizedBuffers(vk::DeviceSize Threshold);
+        void RemoveOversizedBuffers(std::vector<std::unique_ptr<FStagingBufferInfo>>& Buffers, vk::DeviceSize Threshold);
         vk::DeviceSize AlignSize(vk::DeviceSize RequestedSize);
+        std::size_t GetSizeBucket(vk::DeviceSize Size) const;
 
     private:
         vk::PhysicalDevice      PhysicalDevice_;
@@ -68,5 +72,7 @@ namespace Npgs
             1024uz * 1024 * 1024,
             4096uz * 1024 * 1024
         };
+
+        static_assert(kSizeTiers.size() + 1 == kBucketCount);
     };
 } // namespace Npgs
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "Engine/Runtime/Pools/ThreadPool.hpp"
+
+namespace Npgs
+{
+    template <typename Ty = void>
+    class TTask;
+
+    class FTaskPromiseBase
+    {
+    public:
+        // 结束时对称转移到等待者，不占用额外的栈帧，也不会在任务结束后再访问任务帧
+        struct FFinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template <typename PromiseType>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> Handle) noexcept
+            {
+                std::coroutine_handle<> Continuation = Handle.promise().GetContinuation();
+                return Continuation ? Continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+    public:
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        FFinalAwaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void SetContinuation(std::coroutine_handle<> Continuation) noexcept
+        {
+            Continuation_ = Continuation;
+        }
+
+        std::coroutine_handle<> GetContinuation() const noexcept
+        {
+            return Continuation_;
+        }
+
+    private:
+        std::coroutine_handle<> Continuation_;
+    };
+
+    template <typename Ty>
+    class TTaskPromise : public FTaskPromiseBase
+    {
+    public:
+        TTask<Ty> get_return_object() noexcept;
+
+        template <typename ValueType>
+        requires std::is_convertible_v<ValueType&&, Ty>
+        void return_value(ValueType&& Value)
+        {
+            Result_.template emplace<1>(std::forward<ValueType>(Value));
+        }
+
+        void unhandled_exception() noexcept
+        {
+            Result_.template emplace<2>(std::current_exception());
+        }
+
+        Ty& GetResult() &
+        {
+            if (Result_.index() == 2)
+            {
+                std::rethrow_exception(std::get<2>(Result_));
+            }
+
+            return std::get<1>(Result_);
+        }
+
+        Ty GetResult() &&
+        {
+            if (Result_.index() == 2)
+            {
+                std::rethrow_exception(std::get<2>(Result_));
+            }
+
+            return std::move(std::get<1>(Result_));
+        }
+
+    private:
+        std::variant<std::monostate, Ty, std::exception_ptr> Result_;
+    };
+
+    template <>
+    class TTaskPromise<void> : public FTaskPromiseBase
+    {
+    public:
+        TTask<void> get_return_object() noexcept;
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            Exception_ = std::current_exception();
+        }
+
+        void GetResult() const
+        {
+            if (Exception_ != nullptr)
+            {
+                std::rethrow_exception(Exception_);
+            }
+        }
+
+    private:
+        std::exception_ptr Exception_;
+    };
+
+    // 惰性启动的协程任务：创建时不执行，被 co_await 时才在等待者的线程上开始运行
+    // 任务体内 co_await ThreadPool->Schedule() 即可转移到线程池，等待子任务时挂起而不是阻塞工作线程
+    // 异常保存在任务中，在 co_await 或 GetResult 时重新抛出
+    template <typename Ty>
+    class TTask
+    {
+        static_assert(!std::is_reference_v<Ty>, "TTask does not support reference results.");
+
+    public:
+        using promise_type = TTaskPromise<Ty>;
+        using FHandle      = std::coroutine_handle<promise_type>;
+
+        // 等待任务完成但不取结果，也不抛出异常，供 WhenAll 等组合器使用
+        class FReadyAwaiter
+        {
+        public:
+            explicit FReadyAwaiter(FHandle Handle) noexcept
+                : Handle_(Handle)
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return Handle_.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> Awaiting) noexcept
+            {
+                Handle_.promise().SetContinuation(Awaiting);
+                return Handle_;
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+
+        protected:
+            FHandle Handle_;
+        };
+
+    public:
+        TTask() = default;
+        explicit TTask(FHandle Handle) noexcept
+            : Handle_(Handle)
+        {
+        }
+
+        TTask(const TTask&) = delete;
+        TTask(TTask&& Other) noexcept
+            : Handle_(std::exchange(Other.Handle_, nullptr))
+        {
+        }
+
+        ~TTask()
+        {
+            if (Handle_)
+            {
+                Handle_.destroy();
+            }
+        }
+
+        TTask& operator=(const TTask&) = delete;
+        TTask& operator=(TTask&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                if (Handle_)
+                {
+                    Handle_.destroy();
+                }
+
+                Handle_ = std::exchange(Other.Handle_, nullptr);
+            }
+
+            return *this;
+        }
+
+        auto operator co_await() & noexcept
+        {
+            struct FAwaiter : FReadyAwaiter
+            {
+                using FReadyAwaiter::FReadyAwaiter;
+
+                decltype(auto) await_resume()
+                {
+                    return this->Handle_.promise().GetResult();
+                }
+            };
+
+            return FAwaiter(Handle_);
+        }
+
+        auto operator co_await() && noexcept
+        {
+            struct FAwaiter : FReadyAwaiter
+            {
+                using FReadyAwaiter::FReadyAwaiter;
+
+                decltype(auto) await_resume()
+                {
+                    return std::move(this->Handle_.promise()).GetResult();
+                }
+            };
+
+            return FAwaiter(Handle_);
+        }
+
+        FReadyAwaiter WhenReady() const noexcept
+        {
+            return FReadyAwaiter(Handle_);
+        }
+
+        // 只能在任务完成后调用
+        decltype(auto) GetResult() &
+        {
+            return Handle_.promise().GetResult();
+        }
+
+        decltype(auto) GetResult() &&
+        {
+            return std::move(Handle_.promise()).GetResult();
+        }
+
+        bool IsReady() const noexcept
+        {
+            return !Handle_ || Handle_.done();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(Handle_);
+        }
+
+    private:
+        FHandle Handle_;
+    };
+
+    // 立即开始执行、结束时自行销毁的协程，只用于实现组合器
+    class FTaskSignal
+    {
+    public:
+        struct promise_type
+        {
+            FTaskSignal get_return_object() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    // 等待任务完成后调用 Callback，Task 必须存活到任务完成
+    template <typename Ty, typename Func>
+    FTaskSignal SignalOnCompletion(const TTask<Ty>& Task, Func Callback);
+
+    // 在线程池中执行 Pred 并返回其结果
+    template <typename Func>
+    TTask<std::invoke_result_t<Func&>> RunAsync(FThreadPool& ThreadPool, Func Pred);
+
+    // 等待所有任务完成。任务按顺序依次启动，所有任务结束后按顺序重新抛出第一个异常，否则按顺序返回结果
+    TTask<void> WhenAll(std::vector<TTask<void>> Tasks);
+
+    template <typename Ty>
+    requires (!std::is_void_v<Ty>)
+    TTask<std::vector<Ty>> WhenAll(std::vector<TTask<Ty>> Tasks);
+
+    // 等待任意一个任务完成，返回其下标（与结果）。其余任务继续在后台运行，结果被丢弃
+    TTask<std::size_t> WhenAny(std::vector<TTask<void>> Tasks);
+
+    template <typename Ty>
+    requires (!std::is_void_v<Ty>)
+    TTask<std::pair<std::size_t, Ty>> WhenAny(std::vector<TTask<Ty>> Tasks);
+
+    // 在非协程代码中阻塞等待任务完成，等待期间调用线程帮助执行线程池中的任务，因此可以在工作线程中使用
+    template <typename Ty>
+    Ty SyncWait(FThreadPool& ThreadPool, TTask<Ty> Task);
+} // namespace Npgs
+
+#include "Task.inl"
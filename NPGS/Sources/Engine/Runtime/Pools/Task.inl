@@ -0,0 +1,218 @@
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    // 组合器共享的计数器：初始值为任务数加一，多出的一份由发起等待的线程在启动完所有任务后释放，
+    // 保证等待者不会在启动循环结束之前被恢复
+    struct FWhenAllCounter
+    {
+        std::atomic<std::size_t> Remaining{};
+        std::coroutine_handle<>  Continuation;
+
+        void Arrive() noexcept
+        {
+            if (Remaining.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                Continuation.resume();
+            }
+        }
+    };
+
+    template <typename Ty>
+    class TWhenAllAwaiter
+    {
+    public:
+        explicit TWhenAllAwaiter(std::vector<TTask<Ty>>& Tasks) noexcept
+            : Tasks_(Tasks)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return Tasks_.empty();
+        }
+
+        bool await_suspend(std::coroutine_handle<> Handle)
+        {
+            Counter_.Remaining.store(Tasks_.size() + 1, std::memory_order::relaxed);
+            Counter_.Continuation = Handle;
+            for (auto& Task : Tasks_)
+            {
+                SignalOnCompletion(Task, [Counter = &Counter_]() -> void { Counter->Arrive(); });
+            }
+
+            return Counter_.Remaining.fetch_sub(1, std::memory_order::acq_rel) != 1;
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        std::vector<TTask<Ty>>& Tasks_;
+        FWhenAllCounter         Counter_;
+    };
+
+    // WhenAny 返回时其余任务可能仍在运行，任务与状态由所有回调共同持有，最后一个任务结束时释放
+    template <typename Ty>
+    struct TWhenAnyState
+    {
+        static constexpr std::size_t kNoWinner = std::numeric_limits<std::size_t>::max();
+
+        std::vector<TTask<Ty>>   Tasks;
+        std::atomic<std::size_t> Winner{ kNoWinner };
+        std::atomic<int>         Gate{ 2 };  // 胜者与启动循环各释放一次，后到者恢复等待者
+        std::coroutine_handle<>  Continuation;
+
+        void Pass() noexcept
+        {
+            if (Gate.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                Continuation.resume();
+            }
+        }
+    };
+
+    template <typename Ty>
+    class TWhenAnyAwaiter
+    {
+    public:
+        explicit TWhenAnyAwaiter(std::shared_ptr<TWhenAnyState<Ty>> State) noexcept
+            : State_(std::move(State))
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> Handle)
+        {
+            State_->Continuation = Handle;
+            for (std::size_t i = 0; i != State_->Tasks.size(); ++i)
+            {
+                SignalOnCompletion(State_->Tasks[i], [State = State_, i]() -> void
+                {
+                    std::size_t Expected = TWhenAnyState<Ty>::kNoWinner;
+                    if (State->Winner.compare_exchange_strong(Expected, i, std::memory_order::acq_rel))
+                    {
+                        State->Pass();
+                    }
+                });
+            }
+
+            return State_->Gate.fetch_sub(1, std::memory_order::acq_rel) != 1;
+        }
+
+        std::size_t await_resume() const noexcept
+        {
+            return State_->Winner.load(std::memory_order::acquire);
+        }
+
+    private:
+        std::shared_ptr<TWhenAnyState<Ty>> State_;
+    };
+
+    template <typename Ty>
+    TTask<Ty> TTaskPromise<Ty>::get_return_object() noexcept
+    {
+        return TTask<Ty>(std::coroutine_handle<TTaskPromise>::from_promise(*this));
+    }
+
+    NPGS_INLINE TTask<void> TTaskPromise<void>::get_return_object() noexcept
+    {
+        return TTask<void>(std::coroutine_handle<TTaskPromise>::from_promise(*this));
+    }
+
+    template <typename Ty, typename Func>
+    FTaskSignal SignalOnCompletion(const TTask<Ty>& Task, Func Callback)
+    {
+        co_await Task.WhenReady();
+        Callback();
+    }
+
+    template <typename Func>
+    TTask<std::invoke_result_t<Func&>> RunAsync(FThreadPool& ThreadPool, Func Pred)
+    {
+        co_await ThreadPool.Schedule();
+        co_return Pred();
+    }
+
+    NPGS_INLINE TTask<void> WhenAll(std::vector<TTask<void>> Tasks)
+    {
+        co_await TWhenAllAwaiter<void>(Tasks);
+        for (auto& Task : Tasks)
+        {
+            Task.GetResult();
+        }
+    }
+
+    template <typename Ty>
+    requires (!std::is_void_v<Ty>)
+    TTask<std::vector<Ty>> WhenAll(std::vector<TTask<Ty>> Tasks)
+    {
+        co_await TWhenAllAwaiter<Ty>(Tasks);
+
+        std::vector<Ty> Results;
+        Results.reserve(Tasks.size());
+        for (auto& Task : Tasks)
+        {
+            Results.push_back(std::move(Task).GetResult());
+        }
+
+        co_return Results;
+    }
+
+    NPGS_INLINE TTask<std::size_t> WhenAny(std::vector<TTask<void>> Tasks)
+    {
+        if (Tasks.empty())
+        {
+            throw std::invalid_argument("WhenAny requires at least one task.");
+        }
+
+        auto State = std::make_shared<TWhenAnyState<void>>();
+        State->Tasks = std::move(Tasks);
+
+        std::size_t Winner = co_await TWhenAnyAwaiter<void>(State);
+        State->Tasks[Winner].GetResult();
+        co_return Winner;
+    }
+
+    template <typename Ty>
+    requires (!std::is_void_v<Ty>)
+    TTask<std::pair<std::size_t, Ty>> WhenAny(std::vector<TTask<Ty>> Tasks)
+    {
+        if (Tasks.empty())
+        {
+            throw std::invalid_argument("WhenAny requires at least one task.");
+        }
+
+        auto State = std::make_shared<TWhenAnyState<Ty>>();
+        State->Tasks = std::move(Tasks);
+
+        std::size_t Winner = co_await TWhenAnyAwaiter<Ty>(State);
+        co_return std::pair<std::size_t, Ty>(Winner, std::move(State->Tasks[Winner]).GetResult());
+    }
+
+    template <typename Ty>
+    Ty SyncWait(FThreadPool& ThreadPool, TTask<Ty> Task)
+    {
+        std::atomic<bool> bDone{ false };
+        SignalOnCompletion(Task, [&bDone]() -> void { bDone.store(true, std::memory_order::release); });
+
+        while (!bDone.load(std::memory_order::acquire))
+        {
+            if (!ThreadPool.RunPendingTask())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        return std::move(Task).GetResult();
+    }
+} // namespace Npgs
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <concepts>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Engine/Runtime/Pools/MemoryPool.hpp"
+
+namespace Npgs
+{
+    // 只能移动的 void() 可调用对象，捕获不超过 kInlineSize 字节时直接存储在对象内部，不会分配堆内存
+    // 对象大小固定为两个缓存行，便于放入 TMemoryPool
+    class FTaskFunction
+    {
+    public:
+        static constexpr std::size_t kInlineSize = 112;
+
+    public:
+        FTaskFunction() = default;
+
+        template <typename Func>
+        requires (!std::same_as<std::decay_t<Func>, FTaskFunction> && std::invocable<std::decay_t<Func>&>)
+        FTaskFunction(Func&& Pred)
+        {
+            using FFunctionType = std::decay_t<Func>;
+            if constexpr (kbStoredInline<FFunctionType>)
+            {
+                new (Storage_.data()) FFunctionType(std::forward<Func>(Pred));
+                Operations_ = &kInlineOperations<FFunctionType>;
+            }
+            else
+            {
+                *reinterpret_cast<FFunctionType**>(Storage_.data()) = new FFunctionType(std::forward<Func>(Pred));
+                Operations_ = &kHeapOperations<FFunctionType>;
+            }
+        }
+
+        FTaskFunction(const FTaskFunction&) = delete;
+        FTaskFunction(FTaskFunction&& Other) noexcept
+            : Operations_(std::exchange(Other.Operations_, nullptr))
+        {
+            if (Operations_ != nullptr)
+            {
+                Operations_->Relocate(Storage_.data(), Other.Storage_.data());
+            }
+        }
+
+        ~FTaskFunction()
+        {
+            Reset();
+        }
+
+        FTaskFunction& operator=(const FTaskFunction&) = delete;
+        FTaskFunction& operator=(FTaskFunction&& Other) noexcept
+        {
+            if (this != &Other)
+            {
+                Reset();
+                Operations_ = std::exchange(Other.Operations_, nullptr);
+                if (Operations_ != nullptr)
+                {
+                    Operations_->Relocate(Storage_.data(), Other.Storage_.data());
+                }
+            }
+
+            return *this;
+        }
+
+        void operator()()
+        {
+            Operations_->Invoke(Storage_.data());
+        }
+
+        explicit operator bool() const
+        {
+            return Operations_ != nullptr;
+        }
+
+        void Reset()
+        {
+            if (Operations_ != nullptr)
+            {
+                std::exchange(Operations_, nullptr)->Destroy(Storage_.data());
+            }
+        }
+
+    private:
+        struct FOperations
+        {
+            void (*Invoke)(std::byte* Storage);
+            void (*Relocate)(std::byte* Target, std::byte* Source) noexcept; // 移动到 Target 并销毁 Source
+            void (*Destroy)(std::byte* Storage) noexcept;
+        };
+
+        template <typename FunctionType>
+        static constexpr bool kbStoredInline = sizeof(FunctionType) <= kInlineSize &&
+                                               alignof(FunctionType) <= alignof(std::max_align_t) &&
+                                               std::is_nothrow_move_constructible_v<FunctionType>;
+
+        template <typename FunctionType>
+        static constexpr FOperations kInlineOperations
+        {
+            .Invoke = [](std::byte* Storage) -> void
+            {
+                (*std::launder(reinterpret_cast<FunctionType*>(Storage)))();
+            },
+            .Relocate = [](std::byte* Target, std::byte* Source) noexcept -> void
+            {
+                auto* Function = std::launder(reinterpret_cast<FunctionType*>(Source));
+                new (Target) FunctionType(std::move(*Function));
+                Function->~FunctionType();
+            },
+            .Destroy = [](std::byte* Storage) noexcept -> void
+            {
+                std::launder(reinterpret_cast<FunctionType*>(Storage))->~FunctionType();
+            }
+        };
+
+        template <typename FunctionType>
+        static constexpr FOperations kHeapOperations
+        {
+            .Invoke = [](std::byte* Storage) -> void
+            {
+                (**reinterpret_cast<FunctionType**>(Storage))();
+            },
+            .Relocate = [](std::byte* Target, std::byte* Source) noexcept -> void
+            {
+                *reinterpret_cast<FunctionType**>(Target) = *reinterpret_cast<FunctionType**>(Source);
+            },
+            .Destroy = [](std::byte* Storage) noexcept -> void
+            {
+                delete *reinterpret_cast<FunctionType**>(Storage);
+            }
+        };
+
+    private:
+        alignas(std::max_align_t) std::array<std::byte, kInlineSize> Storage_;
+        const FOperations*                                           Operations_{ nullptr };
+    };
+
+    struct FTaskStateBlock
+    {
+        static constexpr std::size_t kSize = 128;
+
+        alignas(std::max_align_t) std::array<std::byte, kSize> Storage;
+        std::size_t                                            Handle;
+    };
+
+    // 内存池永不销毁，因此 future 可以比线程池存活得更久
+    inline TMemoryPool<FTaskStateBlock, 10>& GetTaskStatePool()
+    {
+        static auto* Pool = new TMemoryPool<FTaskStateBlock, 10>(0);
+        return *Pool;
+    }
+
+    // std::promise 共享状态的分配器。不超过 FTaskStateBlock::kSize 的状态从全局 TMemoryPool 中分配，
+    // 线程本地缓存使提交与完成任务时都不需要访问堆
+    template <typename Ty>
+    class TTaskStateAllocator
+    {
+    public:
+        using value_type = Ty;
+
+    public:
+        TTaskStateAllocator() = default;
+
+        template <typename OtherType>
+        TTaskStateAllocator(const TTaskStateAllocator<OtherType>&) noexcept
+        {
+        }
+
+        Ty* allocate(std::size_t Count)
+        {
+            if (!IsPooled(Count))
+            {
+                return static_cast<Ty*>(::operator new(Count * sizeof(Ty), std::align_val_t{ alignof(Ty) }));
+            }
+
+            auto  Guard = GetTaskStatePool().Allocate();
+            auto* Block = Guard.Get();
+            Block->Handle = Guard.Release();
+            return reinterpret_cast<Ty*>(Block->Storage.data());
+        }
+
+        void deallocate(Ty* Pointer, std::size_t Count) noexcept
+        {
+            if (!IsPooled(Count))
+            {
+                ::operator delete(Pointer, std::align_val_t{ alignof(Ty) });
+                return;
+            }
+
+            auto* Block = reinterpret_cast<FTaskStateBlock*>(Pointer);
+            GetTaskStatePool().Adopt(Block->Handle); // 临时 guard 析构时归还
+        }
+
+        template <typename OtherType>
+        bool operator==(const TTaskStateAllocator<OtherType>&) const noexcept
+        {
+            return true;
+        }
+
+    private:
+        static bool IsPooled(std::size_t Count)
+        {
+            return Count * sizeof(Ty) <= FTaskStateBlock::kSize && alignof(Ty) <= alignof(std::max_align_t);
+        }
+    };
+} // namespace Npgs
@@ -0,0 +1,250 @@
+#include "stdafx.h"
+#include "TaskGraph.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Engine/Core/Base/Assert.hpp"
+#include "Engine/Core/Logger.hpp"
+
+namespace Npgs
+{
+    FTaskGraph::FTaskGraph(FThreadPool* ThreadPool, ETaskPriority Priority)
+        : ThreadPool_(ThreadPool)
+        , Priority_(Priority)
+    {
+    }
+
+    void FTaskGraph::AddDependency(FNodeId Node, FNodeId Dependency)
+    {
+        NpgsAssert(Node < Nodes_.size() && Dependency < Node, "Dependency must be added before the node.");
+        auto& Dependencies = Nodes_[Node]->Dependencies;
+        if (std::ranges::find(Dependencies, Dependency) != Dependencies.end())
+        {
+            return;
+        }
+
+        Dependencies.push_back(Dependency);
+        Nodes_[Dependency]->Successors.push_back(Node);
+    }
+
+    void FTaskGraph::Execute(const FCancellationToken& CancellationToken)
+    {
+        StartTime_ = FClock::now();
+        EndTime_   = StartTime_;
+        if (Nodes_.empty())
+        {
+            return;
+        }
+
+        RemainingCount_.store(Nodes_.size(), std::memory_order::relaxed);
+        bFailed_.store(false, std::memory_order::relaxed);
+        bCanceled_.store(false, std::memory_order::relaxed);
+        bCompleted_        = false;
+        Exception_         = nullptr;
+        CancellationToken_ = CancellationToken;
+
+        std::vector<FNodeId> Roots;
+        for (FNodeId Id = 0; Id != Nodes_.size(); ++Id)
+        {
+            auto& Node = *Nodes_[Id];
+            Node.PendingCount.store(static_cast<std::uint32_t>(Node.Dependencies.size()), std::memory_order::relaxed);
+            Node.StartTime = StartTime_;
+            Node.EndTime   = StartTime_;
+            if (Node.Dependencies.empty())
+            {
+                Roots.push_back(Id);
+            }
+        }
+
+        // 先记录所有根节点再提交，避免根节点的后继在计数重置之前被调度
+        for (FNodeId Root : Roots)
+        {
+            Schedule(Root);
+        }
+
+        {
+            std::unique_lock Lock(CompletionMutex_);
+            CompletionCondition_.wait(Lock, [this]() -> bool { return bCompleted_; });
+        }
+
+        EndTime_ = FClock::now();
+
+        CancellationToken_ = {};
+        if (Exception_ != nullptr)
+        {
+            std::rethrow_exception(Exception_);
+        }
+
+        if (bCanceled_.load(std::memory_order::relaxed))
+        {
+            throw FOperationCanceledError();
+        }
+    }
+
+    std::vector<FTaskGraph::FNodeTiming> FTaskGraph::GetTimings() const
+    {
+        std::vector<FNodeTiming> Timings;
+        Timings.reserve(Nodes_.size());
+        for (const auto& Node : Nodes_)
+        {
+            Timings.push_back(
+            {
+                .Name       = Node->Name,
+                .StartMs    = ToMilliseconds(Node->StartTime - StartTime_),
+                .DurationMs = ToMilliseconds(Node->EndTime - Node->StartTime)
+            });
+        }
+
+        for (FNodeId Id : GetCriticalPath())
+        {
+            Timings[Id].bCritical = true;
+        }
+
+        return Timings;
+    }
+
+    std::vector<FTaskGraph::FNodeId> FTaskGraph::GetCriticalPath() const
+    {
+        if (Nodes_.empty())
+        {
+            return {};
+        }
+
+        // 节点编号是拓扑序，按编号顺序做一次最长路径动态规划
+        constexpr FNodeId kNone = static_cast<FNodeId>(-1);
+        std::vector<FClock::duration> Finish(Nodes_.size());
+        std::vector<FNodeId>          Previous(Nodes_.size(), kNone);
+        FNodeId Last = 0;
+
+        for (FNodeId Id = 0; Id != Nodes_.size(); ++Id)
+        {
+            const auto& Node = *Nodes_[Id];
+            FClock::duration Longest{};
+            for (FNodeId Dependency : Node.Dependencies)
+            {
+                if (Previous[Id] == kNone || Finish[Dependency] > Longest)
+                {
+                    Longest      = Finish[Dependency];
+                    Previous[Id] = Dependency;
+                }
+            }
+
+            Finish[Id] = Longest + (Node.EndTime - Node.StartTime);
+            if (Finish[Id] > Finish[Last])
+            {
+                Last = Id;
+            }
+        }
+
+        std::vector<FNodeId> Path;
+        for (FNodeId Id = Last; Id != kNone; Id = Previous[Id])
+        {
+            Path.push_back(Id);
+        }
+
+        std::ranges::reverse(Path);
+        return Path;
+    }
+
+    void FTaskGraph::LogTimings() const
+    {
+        double CriticalMs = 0.0;
+        for (const auto& Timing : GetTimings())
+        {
+            NpgsCoreInfo("{} {:<32} start {:>10.2f} ms, duration {:>10.2f} ms",
+                         Timing.bCritical ? '*' : ' ', Timing.Name, Timing.StartMs, Timing.DurationMs);
+            CriticalMs += Timing.bCritical ? Timing.DurationMs : 0.0;
+        }
+
+        NpgsCoreInfo("Task graph wall time {:.2f} ms, critical path {:.2f} ms.", GetWallTimeMs(), CriticalMs);
+    }
+
+    FTaskGraph::FNodeId FTaskGraph::AddNodeImpl(std::string Name, FTaskFunction Function, std::initializer_list<FNodeId> Dependencies)
+    {
+        auto Id = static_cast<FNodeId>(Nodes_.size());
+        auto Node = std::make_unique<FNode>();
+        Node->Name     = std::move(Name);
+        Node->Function = std::move(Function);
+#ifdef NPGS_ENABLE_TASK_TRACE
+        Node->TraceName = FTaskTracer::InternName(Node->Name);
+#endif // NPGS_ENABLE_TASK_TRACE
+        Nodes_.push_back(std::move(Node));
+
+        for (FNodeId Dependency : Dependencies)
+        {
+            AddDependency(Id, Dependency);
+        }
+
+        return Id;
+    }
+
+    void FTaskGraph::Schedule(FNodeId Node)
+    {
+        ThreadPool_->Enqueue(Priority_, [this, Node]() -> void { RunNode(Node); });
+    }
+
+    void FTaskGraph::RunNode(FNodeId Id)
+    {
+        // 每轮最后一个就绪的后继在当前线程上继续执行，省去一次入队与唤醒
+        while (true)
+        {
+            auto& Node = *Nodes_[Id];
+            Node.StartTime = FClock::now();
+            if (CancellationToken_.IsCancellationRequested())
+            {
+                bCanceled_.store(true, std::memory_order::relaxed);
+            }
+            else if (!bFailed_.load(std::memory_order::relaxed))
+            {
+                try
+                {
+                    NpgsTraceScope(Node.TraceName);
+                    Node.Function();
+                }
+                catch (...)
+                {
+                    std::lock_guard Lock(ExceptionMutex_);
+                    if (Exception_ == nullptr)
+                    {
+                        Exception_ = std::current_exception();
+                    }
+
+                    bFailed_.store(true, std::memory_order::relaxed);
+                }
+            }
+            Node.EndTime = FClock::now();
+
+            constexpr FNodeId kNone = static_cast<FNodeId>(-1);
+            FNodeId Continuation = kNone;
+            for (FNodeId Successor : Node.Successors)
+            {
+                if (Nodes_[Successor]->PendingCount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                {
+                    if (Continuation != kNone)
+                    {
+                        Schedule(Continuation);
+                    }
+
+                    Continuation = Successor;
+                }
+            }
+
+            if (RemainingCount_.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                // 持锁通知：Execute 返回后图可能立即被销毁，解锁之后不能再访问任何成员
+                std::lock_guard Lock(CompletionMutex_);
+                bCompleted_ = true;
+                CompletionCondition_.notify_all();
+                return;
+            }
+
+            if (Continuation == kNone)
+            {
+                return;
+            }
+
+            Id = Continuation;
+        }
+    }
+} // namespace Npgs
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Engine/Runtime/Pools/CancellationToken.hpp"
+#include "Engine/Runtime/Pools/TaskFunction.hpp"
+#include "Engine/Runtime/Pools/TaskTrace.hpp"
+#include "Engine/Runtime/Pools/ThreadPool.hpp"
+
+namespace Npgs
+{
+    // 基于 FThreadPool 的有向无环任务图。节点在所有依赖完成后被提交到线程池，互不依赖的节点自动并行
+    // 依赖必须是先于节点添加的节点，因此图在构造时就保证无环，节点编号即为一个拓扑序
+    // 节点内可以使用 ParallelFor 等并行算法；Execute 会阻塞调用线程，不应在线程池的工作线程中调用
+    class FTaskGraph
+    {
+    public:
+        using FNodeId = std::uint32_t;
+
+        struct FNodeTiming
+        {
+            std::string Name;
+            double      StartMs{};     // 相对于 Execute 开始的时间
+            double      DurationMs{};
+            bool        bCritical{};   // 是否位于关键路径上
+        };
+
+    public:
+        // 所有节点以 Priority 提交，节点内部的并行循环与子任务默认继承该优先级
+        explicit FTaskGraph(FThreadPool* ThreadPool, ETaskPriority Priority = ETaskPriority::kInteractive);
+        FTaskGraph(const FTaskGraph&) = delete;
+        FTaskGraph(FTaskGraph&&)      = delete;
+        ~FTaskGraph()                 = default;
+
+        FTaskGraph& operator=(const FTaskGraph&) = delete;
+        FTaskGraph& operator=(FTaskGraph&&)      = delete;
+
+        template <typename Func>
+        FNodeId AddNode(std::string Name, Func&& Pred, std::initializer_list<FNodeId> Dependencies = {});
+        void AddDependency(FNodeId Node, FNodeId Dependency);
+
+        // 执行所有节点并等待完成，可以重复执行。某个节点抛出异常后，尚未开始的节点被跳过，异常在调用线程中重新抛出
+        // 令牌被取消后尚未开始的节点同样被跳过，全部结束后抛出 FOperationCanceledError
+        void Execute(const FCancellationToken& CancellationToken = {});
+
+        // 以下结果来自最近一次 Execute
+        std::vector<FNodeTiming> GetTimings() const;
+        std::vector<FNodeId> GetCriticalPath() const; // 按耗时加权的最长依赖链，从起点到终点
+        double GetWallTimeMs() const;
+        void LogTimings() const;
+
+        std::size_t GetNodeCount() const;
+
+    private:
+        using FClock = std::chrono::steady_clock;
+
+        struct FNode
+        {
+            std::string                Name;
+            FTaskFunction              Function;
+            std::vector<FNodeId>       Dependencies;
+            std::vector<FNodeId>       Successors;
+            std::atomic<std::uint32_t> PendingCount{};
+            FClock::time_point         StartTime;
+            FClock::time_point         EndTime;
+#ifdef NPGS_ENABLE_TASK_TRACE
+            const char*                TraceName{};  // 节点名的驻留副本，追踪事件在图销毁后仍会引用它
+#endif // NPGS_ENABLE_TASK_TRACE
+        };
+
+    private:
+        FNodeId AddNodeImpl(std::string Name, FTaskFunction Function, std::initializer_list<FNodeId> Dependencies);
+        void Schedule(FNodeId Node);
+        void RunNode(FNodeId Node);
+        double ToMilliseconds(FClock::duration Duration) const;
+
+    private:
+        std::vector<std::unique_ptr<FNode>> Nodes_;
+        FThreadPool*                        ThreadPool_;
+        ETaskPriority                       Priority_;
+        FCancellationToken                  CancellationToken_;
+        std::atomic<std::size_t>            RemainingCount_{};
+        std::atomic<bool>                   bFailed_{ false };
+        std::atomic<bool>                   bCanceled_{ false };
+        std::mutex                          CompletionMutex_;
+        std::condition_variable             CompletionCondition_;
+        bool                                bCompleted_{ false };  // 由 CompletionMutex_ 保护
+        std::mutex                          ExceptionMutex_;
+        std::exception_ptr                  Exception_;
+        FClock::time_point                  StartTime_;
+        FClock::time_point                  EndTime_;
+    };
+} // namespace Npgs
+
+#include "TaskGraph.inl"
@@ -0,0 +1,27 @@
+#include <utility>
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    template <typename Func>
+    FTaskGraph::FNodeId FTaskGraph::AddNode(std::string Name, Func&& Pred, std::initializer_list<FNodeId> Dependencies)
+    {
+        return AddNodeImpl(std::move(Name), FTaskFunction(std::forward<Func>(Pred)), Dependencies);
+    }
+
+    NPGS_INLINE std::size_t FTaskGraph::GetNodeCount() const
+    {
+        return Nodes_.size();
+    }
+
+    NPGS_INLINE double FTaskGraph::GetWallTimeMs() const
+    {
+        return ToMilliseconds(EndTime_ - StartTime_);
+    }
+
+    NPGS_INLINE double FTaskGraph::ToMilliseconds(FClock::duration Duration) const
+    {
+        return std::chrono::duration<double, std::milli>(Duration).count();
+    }
+} // namespace Npgs
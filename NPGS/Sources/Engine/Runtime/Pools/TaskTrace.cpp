@@ -0,0 +1,211 @@
+#include "stdafx.h"
+#include "TaskTrace.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Engine/Core/Logger.hpp"
+
+namespace Npgs
+{
+    namespace
+    {
+        struct FTraceEvent
+        {
+            const char*   Name;
+            std::uint64_t StartTime;
+            std::uint64_t EndTime;
+        };
+
+        // 每个线程独占一个缓冲区，锁只在导出或清空时才会发生竞争。线程退出后缓冲区仍然保留，以便导出
+        struct FThreadBuffer
+        {
+            std::mutex               Mutex;
+            std::vector<FTraceEvent> Events;
+            std::string              ThreadName;
+            std::uint32_t            ThreadId{};
+        };
+
+        const std::chrono::steady_clock::time_point kTraceEpoch = std::chrono::steady_clock::now();
+
+        std::mutex                                  RegistryMutex;
+        std::vector<std::unique_ptr<FThreadBuffer>> ThreadBuffers;
+        std::unordered_set<std::string>             InternedNames;
+
+        thread_local FThreadBuffer* CurrentThreadBuffer = nullptr;
+        thread_local const char*    CurrentScopeName    = nullptr;
+
+        FThreadBuffer& GetThreadBuffer()
+        {
+            if (CurrentThreadBuffer == nullptr)
+            {
+                std::lock_guard Lock(RegistryMutex);
+                auto Buffer = std::make_unique<FThreadBuffer>();
+                Buffer->ThreadId   = static_cast<std::uint32_t>(ThreadBuffers.size() + 1);
+                Buffer->ThreadName = "Thread " + std::to_string(Buffer->ThreadId);
+                CurrentThreadBuffer = Buffer.get();
+                ThreadBuffers.push_back(std::move(Buffer));
+            }
+
+            return *CurrentThreadBuffer;
+        }
+
+        void WriteJsonString(std::ofstream& Stream, std::string_view String)
+        {
+            Stream << '"';
+            for (char Char : String)
+            {
+                switch (Char)
+                {
+                case '"':
+                    Stream << "\\\"";
+                    break;
+                case '\\':
+                    Stream << "\\\\";
+                    break;
+                case '\n':
+                    Stream << "\\n";
+                    break;
+                default:
+                    Stream << Char;
+                    break;
+                }
+            }
+            Stream << '"';
+        }
+    }
+
+    std::atomic<bool> FTaskTracer::bRecording_{ false };
+
+    // TaskTracer implementations
+    // --------------------------
+    void FTaskTracer::Start()
+    {
+        std::lock_guard Lock(RegistryMutex);
+        for (auto& Buffer : ThreadBuffers)
+        {
+            std::lock_guard BufferLock(Buffer->Mutex);
+            Buffer->Events.clear();
+        }
+
+        bRecording_.store(true, std::memory_order::relaxed);
+    }
+
+    void FTaskTracer::Stop()
+    {
+        bRecording_.store(false, std::memory_order::relaxed);
+    }
+
+    std::uint64_t FTaskTracer::GetTimestamp()
+    {
+        auto Elapsed = std::chrono::steady_clock::now() - kTraceEpoch;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed).count());
+    }
+
+    const char* FTaskTracer::InternName(std::string_view Name)
+    {
+        std::lock_guard Lock(RegistryMutex);
+        return InternedNames.emplace(Name).first->c_str();
+    }
+
+    void FTaskTracer::SetThreadName(std::string_view Name)
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+        std::lock_guard Lock(Buffer.Mutex);
+        Buffer.ThreadName = Name;
+    }
+
+    void FTaskTracer::RecordEvent(const char* Name, std::uint64_t StartTime, std::uint64_t EndTime)
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+        std::lock_guard Lock(Buffer.Mutex);
+        Buffer.Events.emplace_back(Name, StartTime, EndTime);
+    }
+
+    const char* FTaskTracer::GetCurrentScopeName()
+    {
+        return CurrentScopeName;
+    }
+
+    bool FTaskTracer::ExportChromeTrace(const std::string& Filename)
+    {
+        std::ofstream Stream(Filename, std::ios::trunc);
+        if (!Stream.is_open())
+        {
+            NpgsCoreError("Failed to open trace file \"{}\".", Filename);
+            return false;
+        }
+
+        // 时间单位为微秒，每个作用域对应一个完整事件（"ph":"X"），线程名通过元数据事件给出
+        std::size_t EventCount = 0;
+        bool bFirst = true;
+        auto BeginEvent = [&]() -> void
+        {
+            Stream << (bFirst ? "\n" : ",\n");
+            bFirst = false;
+        };
+
+        Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        std::lock_guard Lock(RegistryMutex);
+        for (auto& Buffer : ThreadBuffers)
+        {
+            std::lock_guard BufferLock(Buffer->Mutex);
+
+            BeginEvent();
+            Stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << Buffer->ThreadId << ",\"args\":{\"name\":";
+            WriteJsonString(Stream, Buffer->ThreadName);
+            Stream << "}}";
+
+            for (const auto& Event : Buffer->Events)
+            {
+                BeginEvent();
+                Stream << "{\"name\":";
+                WriteJsonString(Stream, Event.Name);
+                Stream << ",\"cat\":\"task\",\"ph\":\"X\",\"pid\":1,\"tid\":" << Buffer->ThreadId
+                       << ",\"ts\":"  << static_cast<double>(Event.StartTime) / 1000.0
+                       << ",\"dur\":" << static_cast<double>(Event.EndTime - Event.StartTime) / 1000.0 << '}';
+            }
+
+            EventCount += Buffer->Events.size();
+        }
+
+        Stream << "\n]}\n";
+        if (!Stream.good())
+        {
+            NpgsCoreError("Failed to write trace file \"{}\".", Filename);
+            return false;
+        }
+
+        NpgsCoreInfo("Exported {} trace events to \"{}\".", EventCount, Filename);
+        return true;
+    }
+
+    // TraceScope implementations
+    // --------------------------
+    FTraceScope::FTraceScope(const char* Name)
+        : Name_(Name != nullptr ? Name : "Task")
+        , ParentName_(std::exchange(CurrentScopeName, Name_))
+        , StartTime_(0)
+        , bRecording_(FTaskTracer::IsRecording())
+    {
+        if (bRecording_)
+        {
+            StartTime_ = FTaskTracer::GetTimestamp();
+        }
+    }
+
+    FTraceScope::~FTraceScope()
+    {
+        CurrentScopeName = ParentName_;
+        if (bRecording_)
+        {
+            FTaskTracer::RecordEvent(Name_, StartTime_, FTaskTracer::GetTimestamp());
+        }
+    }
+} // namespace Npgs
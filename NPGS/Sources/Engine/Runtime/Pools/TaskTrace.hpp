@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <string>
+#include <string_view>
+
+// Task trace
+// ----------
+// 默认关闭，需要追踪时在项目的预处理器定义中加入 NPGS_ENABLE_TASK_TRACE
+// 开启后 FUniverse::FillUniverse 会记录整个生成过程并导出到工作目录下的 FillUniverse.trace.json
+
+namespace Npgs
+{
+    // 任务追踪：各线程把 (名称, 开始, 结束) 事件写入自己的缓冲区，导出为 Chrome trace JSON，
+    // 可以直接在 chrome://tracing 或 ui.perfetto.dev 中打开
+    // 编译期关闭 NPGS_ENABLE_TASK_TRACE 时线程池不插入任何追踪代码，NpgsTraceScope 展开为空语句
+    // 编译期开启但未 Start 时，线程池只在提交和执行任务时各读一次 IsRecording，不读时钟也不包装任务
+    class FTaskTracer
+    {
+    public:
+        // 开始记录并清空之前的事件，只有在记录期间进入的作用域才会产生事件
+        static void Start();
+        static void Stop();
+        static bool IsRecording();
+
+        // 自追踪器首次使用以来经过的纳秒数，单调递增
+        static std::uint64_t GetTimestamp();
+
+        // 返回在程序生命周期内有效的名称副本，供名称不是字符串字面量的作用域使用
+        static const char* InternName(std::string_view Name);
+        static void SetThreadName(std::string_view Name);
+
+        static void RecordEvent(const char* Name, std::uint64_t StartTime, std::uint64_t EndTime);
+
+        // 当前线程最内层追踪作用域的名称，不在作用域内时返回 nullptr
+        static const char* GetCurrentScopeName();
+
+        static bool ExportChromeTrace(const std::string& Filename);
+
+    private:
+        FTaskTracer()  = default;
+        ~FTaskTracer() = default;
+
+        static std::atomic<bool> bRecording_;
+    };
+
+    class FTraceScope
+    {
+    public:
+        explicit FTraceScope(const char* Name);
+        FTraceScope(const FTraceScope&) = delete;
+        FTraceScope(FTraceScope&&)      = delete;
+        ~FTraceScope();
+
+        FTraceScope& operator=(const FTraceScope&) = delete;
+        FTraceScope& operator=(FTraceScope&&)      = delete;
+
+    private:
+        const char*   Name_;
+        const char*   ParentName_;
+        std::uint64_t StartTime_;
+        bool          bRecording_;
+    };
+} // namespace Npgs
+
+#ifdef NPGS_ENABLE_TASK_TRACE
+
+#define NpgsTraceConcatImpl(x, y) x##y
+#define NpgsTraceConcat(x, y)     NpgsTraceConcatImpl(x, y)
+#define NpgsTraceScope(Name)      ::Npgs::FTraceScope NpgsTraceConcat(TraceScope, __LINE__)(Name)
+
+#else
+
+#define NpgsTraceScope(Name) static_cast<void>(0)
+
+#endif // NPGS_ENABLE_TASK_TRACE
+
+#include "TaskTrace.inl"
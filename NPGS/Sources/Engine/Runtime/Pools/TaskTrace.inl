@@ -0,0 +1,9 @@
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE bool FTaskTracer::IsRecording()
+    {
+        return bRecording_.load(std::memory_order::relaxed);
+    }
+} // namespace Npgs
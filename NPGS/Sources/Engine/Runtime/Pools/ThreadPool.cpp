@@ -6,104 +6,599 @@
 #include <algorithm>
 #include <functional>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <utility>
 
-#include <Windows.h>
+#include "Engine/Core/Base/Assert.hpp"
 #include "Engine/Core/Base/Base.hpp"
+#include "Engine/Core/Logger.hpp"
 
 namespace Npgs
 {
     namespace
     {
-        int GetPhysicalCoreCount()
+        constexpr int kSpinRoundCount = 64; // 进入睡眠前的自旋轮数，避免短暂空闲时频繁陷入内核
+
+        thread_local FThreadPool*  CurrentThreadPool   = nullptr;
+        thread_local std::size_t   CurrentWorkerIndex  = 0;
+        thread_local ETaskPriority CurrentTaskPriority = ETaskPriority::kInteractive;
+    }
+
+    // TaskPriorityScope implementations
+    // ---------------------------------
+    FTaskPriorityScope::FTaskPriorityScope(ETaskPriority Priority)
+        : PreviousPriority_(std::exchange(CurrentTaskPriority, Priority))
+    {
+    }
+
+    FTaskPriorityScope::~FTaskPriorityScope()
+    {
+        CurrentTaskPriority = PreviousPriority_;
+    }
+
+    ETaskPriority FTaskPriorityScope::GetCurrentPriority()
+    {
+        return CurrentTaskPriority;
+    }
+
+    // ThreadPool implementations
+    // --------------------------
+    FThreadPool::FThreadPool(int MaxThreadCount, bool bEnableHyperThread, EThreadAffinityPolicy AffinityPolicy)
+        : TaskPool_(0)
+        , Topology_(FCpuTopology::Detect())
+        , AffinityPolicy_(bEnableHyperThread && AffinityPolicy == EThreadAffinityPolicy::kOnePerCore ? EThreadAffinityPolicy::kNone : AffinityPolicy)
+        , MaxWorkerCount_(std::max(static_cast<int>(std::thread::hardware_concurrency()), 1))
+        , bEnableHyperThread_(bEnableHyperThread)
+    {
+        // 所有工作线程的队列一次性创建，之后不再增删，窃取时可以无锁访问其他线程的队列
+        Workers_.reserve(MaxWorkerCount_);
+        for (std::size_t i = 0; i != MaxWorkerCount_; ++i)
         {
-            DWORD Length = 0;
-            GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &Length);
-            std::vector<std::uint8_t> Buffer(Length);
-            auto* BufferPtr = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(Buffer.data());
-            GetLogicalProcessorInformationEx(RelationProcessorCore, BufferPtr, &Length);
+            Workers_.emplace_back(std::make_unique<FWorker>());
+            Workers_.back()->RandomState = 0x9E3779B97F4A7C15ull * (i + 1);
+        }
+
+        int ThreadCount = std::clamp(MaxThreadCount, 0, MaxWorkerCount_);
+        ThreadCount_.store(ThreadCount, std::memory_order::relaxed);
+        for (std::size_t i = 0; i != ThreadCount; ++i)
+        {
+            Workers_[i]->Thread = std::jthread(&FThreadPool::WorkerLoop, this, i);
+            BindWorker(i);
+        }
+    }
 
-            int CoreCount = 0;
-            while (Length > 0)
+    FThreadPool::~FThreadPool()
+    {
+        Shutdown(EShutdownMode::kDrain);
+    }
+
+    void FThreadPool::WaitIdle()
+    {
+        NpgsAssert(CurrentThreadPool != this, "WaitIdle must not be called from a worker thread.");
+
+        std::size_t Pending = PendingTaskCount_.load(std::memory_order::acquire);
+        while (Pending != 0)
+        {
+            // 计数只在归零时通知，没有可帮助执行的任务时直接睡眠到归零
+            if (!RunPendingTask())
             {
-                if (BufferPtr->Relationship == RelationProcessorCore)
-                {
-                    ++CoreCount;
-                }
+                PendingTaskCount_.wait(Pending, std::memory_order::acquire);
+            }
+
+            Pending = PendingTaskCount_.load(std::memory_order::acquire);
+        }
+    }
+
+    void FThreadPool::Resize(int ThreadCount)
+    {
+        NpgsAssert(CurrentThreadPool != this, "Resize must not be called from a worker thread.");
+
+        std::lock_guard Lock(ResizeMutex_);
+        if (bTerminate_.load())
+        {
+            return;
+        }
+
+        int NewCount = std::clamp(ThreadCount, 1, MaxWorkerCount_);
+        int OldCount = ThreadCount_.load(std::memory_order::relaxed);
+        if (NewCount == OldCount)
+        {
+            return;
+        }
 
-                Length   -= BufferPtr->Size;
-                BufferPtr = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(reinterpret_cast<std::uint8_t*>(BufferPtr) + BufferPtr->Size);
+        ThreadCount_.store(NewCount, std::memory_order::relaxed);
+        if (NewCount > OldCount)
+        {
+            for (std::size_t i = OldCount; i != NewCount; ++i)
+            {
+                Workers_[i]->Thread = std::jthread(&FThreadPool::WorkerLoop, this, i);
+                BindWorker(i);
             }
 
-            return CoreCount;
+            return;
+        }
+
+        // 唤醒睡眠中的线程，让编号超出范围的线程看到新的线程数后退出
+        WakeAllWorkers();
+        for (std::size_t i = NewCount; i != OldCount; ++i)
+        {
+            Workers_[i]->Thread.join();
         }
     }
 
-    // ThreadPool implementations
-    // --------------------------
-    FThreadPool::FThreadPool(int MaxThreadCount, bool bEnableHyperThread)
-        : MaxThreadCount_(std::clamp(MaxThreadCount, 0, static_cast<int>(std::thread::hardware_concurrency())))
-        , PhysicalCoreCount_(GetPhysicalCoreCount())
-        , bEnableHyperThread_(bEnableHyperThread)
+    void FThreadPool::Shutdown(EShutdownMode Mode)
     {
-        Workers_.reserve(MaxThreadCount_);
-        Threads_.reserve(MaxThreadCount_);
+        NpgsAssert(CurrentThreadPool != this, "Shutdown must not be called from a worker thread.");
 
-        for (std::size_t i = 0; i != MaxThreadCount_; ++i)
+        std::lock_guard ResizeLock(ResizeMutex_);
+        if (bTerminate_.load())
         {
-            Workers_.emplace_back(std::make_unique<FWorker>());
+            return;
+        }
+
+        ShutdownSource_.RequestCancellation();
+        {
+            std::lock_guard Lock(SleepMutex_);
+            bDiscardPending_.store(Mode == EShutdownMode::kDiscardPending);
+            bTerminate_.store(true);
+            ++WakeEpoch_;
+        }
+        SleepCondition_.notify_all();
+
+        int ThreadCount = ThreadCount_.load(std::memory_order::relaxed);
+        for (std::size_t i = 0; i != ThreadCount; ++i)
+        {
+            Workers_[i]->Thread.join();
+        }
+
+        // 之后提交的任务直接在提交线程上执行。线程退出后才进入队列的任务在这里执行或销毁
+        ThreadCount_.store(0, std::memory_order::relaxed);
+
+        ETaskPriority Priority{};
+        FTaskHandle   Handle{};
+        while (TakeExternalTask(Priority, Handle))
+        {
+            if (Mode == EShutdownMode::kDrain)
+            {
+                ExecuteTask(Priority, Handle);
+            }
+            else
+            {
+                TaskPool_.Adopt(Handle);
+                FinishTask();
+            }
+        }
+    }
+
+    bool FThreadPool::RunPendingTask()
+    {
+        ETaskPriority Priority{};
+        FTaskHandle   Handle{};
+        bool bFound = CurrentThreadPool == this ? FindTask(CurrentWorkerIndex, Priority, Handle) : TakeExternalTask(Priority, Handle);
+        if (!bFound)
+        {
+            return false;
+        }
+
+        ExecuteTask(Priority, Handle);
+        return true;
+    }
+
+    std::vector<FThreadPool::FNumaShard> FThreadPool::MakeNumaShards(std::size_t Count) const
+    {
+        std::vector<std::size_t> NodeWorkerCounts;
+        std::size_t BoundWorkerCount = 0;
+        int ThreadCount = GetMaxThreadCount();
+        for (std::size_t i = 0; i != ThreadCount; ++i)
+        {
+            std::uint32_t NumaNode = Workers_[i]->NumaNode.load(std::memory_order::relaxed);
+            if (NumaNode != kAnyNumaNode)
+            {
+                NodeWorkerCounts.resize(std::max<std::size_t>(NodeWorkerCounts.size(), NumaNode + 1));
+                ++NodeWorkerCounts[NumaNode];
+                ++BoundWorkerCount;
+            }
+        }
+
+        if (std::ranges::count_if(NodeWorkerCounts, [](std::size_t Workers) -> bool { return Workers != 0; }) < 2)
+        {
+            std::uint32_t NumaNode = BoundWorkerCount == 0 ? kAnyNumaNode : static_cast<std::uint32_t>(
+                std::ranges::find_if(NodeWorkerCounts, [](std::size_t Workers) -> bool { return Workers != 0; }) - NodeWorkerCounts.begin());
+            return { { .NumaNode = NumaNode, .Begin = 0, .End = Count } };
+        }
+
+        // 未绑定节点的线程不参与分配，它们在执行时会帮助任意分片
+        std::vector<FNumaShard> Shards;
+        std::size_t AssignedWorkers = 0;
+        std::size_t Begin           = 0;
+        for (std::uint32_t NumaNode = 0; NumaNode != NodeWorkerCounts.size(); ++NumaNode)
+        {
+            if (NodeWorkerCounts[NumaNode] == 0)
+            {
+                continue;
+            }
+
+            AssignedWorkers += NodeWorkerCounts[NumaNode];
+            std::size_t End = Count * AssignedWorkers / BoundWorkerCount;
+            Shards.push_back({ .NumaNode = NumaNode, .Begin = Begin, .End = End });
+            Begin = End;
+        }
+
+        return Shards;
+    }
+
+    std::uint32_t FThreadPool::GetCurrentNumaNode()
+    {
+        if (CurrentThreadPool == nullptr)
+        {
+            return kAnyNumaNode;
+        }
+
+        return CurrentThreadPool->Workers_[CurrentWorkerIndex]->NumaNode.load(std::memory_order::relaxed);
+    }
+
+    FThreadPool::FStatistics FThreadPool::GetStatistics() const
+    {
+        FStatistics Statistics;
+        for (std::size_t Lane = 0; Lane != kPriorityCount; ++Lane)
+        {
+            Statistics.QueuedTaskCounts[Lane] = QueuedTaskCounts_[Lane].load(std::memory_order::relaxed);
+        }
+
+        Statistics.PendingTaskCount = PendingTaskCount_.load(std::memory_order::relaxed);
+
+        int ThreadCount = GetMaxThreadCount();
+        Statistics.Workers.reserve(ThreadCount);
+        for (std::size_t i = 0; i != ThreadCount; ++i)
+        {
+            const auto& Counters = Workers_[i]->Counters;
+            Statistics.Workers.push_back(
+            {
+                .ExecutedCount = Counters.ExecutedCount.load(std::memory_order::relaxed),
+                .StealCount    = Counters.StealCount.load(std::memory_order::relaxed),
+                .SleepCount    = Counters.SleepCount.load(std::memory_order::relaxed),
+                .RunTimeMs     = static_cast<double>(Counters.RunTime.load(std::memory_order::relaxed))  / 1e6,
+                .WaitTimeMs    = static_cast<double>(Counters.WaitTime.load(std::memory_order::relaxed)) / 1e6
+            });
+
+            const auto& Worker = Statistics.Workers.back();
+            Statistics.bTaskTimingCollected |= Worker.RunTimeMs != 0.0 || Worker.WaitTimeMs != 0.0;
+        }
+
+        return Statistics;
+    }
+
+    void FThreadPool::LogStatistics() const
+    {
+        FStatistics Statistics = GetStatistics();
+        NpgsCoreInfo("Thread pool: {} pending tasks, queued frame-critical {}, interactive {}, background {}.",
+                     Statistics.PendingTaskCount, Statistics.QueuedTaskCounts[0], Statistics.QueuedTaskCounts[1],
+                     Statistics.QueuedTaskCounts[2]);
+
+        for (std::size_t i = 0; i != Statistics.Workers.size(); ++i)
+        {
+            // 未统计任务耗时（默认构建或追踪器从未记录）时不输出耗时列，避免把 0 当成实际数据
+            const auto& Worker = Statistics.Workers[i];
+            if (Statistics.bTaskTimingCollected)
+            {
+                NpgsCoreInfo("Worker {:>2}: executed {:>8}, stolen {:>8}, slept {:>6}, run {:>10.2f} ms, wait {:>10.2f} ms",
+                             i, Worker.ExecutedCount, Worker.StealCount, Worker.SleepCount, Worker.RunTimeMs, Worker.WaitTimeMs);
+            }
+            else
+            {
+                NpgsCoreInfo("Worker {:>2}: executed {:>8}, stolen {:>8}, slept {:>6}",
+                             i, Worker.ExecutedCount, Worker.StealCount, Worker.SleepCount);
+            }
+        }
+    }
+
+    void FThreadPool::SwitchHyperThread()
+    {
+        std::lock_guard Lock(ResizeMutex_);
+        HyperThreadIndex_.store(1 - HyperThreadIndex_.load());
+
+        int ThreadCount = ThreadCount_.load(std::memory_order::relaxed);
+        for (std::size_t i = 0; i != ThreadCount; ++i)
+        {
+            BindWorker(i);
+        }
+    }
+
+    void FThreadPool::PushTask(ETaskPriority Priority, FTaskHandle Task)
+    {
+        auto Lane = static_cast<std::size_t>(Priority);
+        PendingTaskCount_.fetch_add(1, std::memory_order::relaxed);
+        QueuedTaskCounts_[Lane].fetch_add(1, std::memory_order::relaxed);
+        if (CurrentThreadPool == this)
+        {
+            Workers_[CurrentWorkerIndex]->Tasks[Lane].Push(Task);
+        }
+        else
+        {
+            InjectionQueues_[Lane].enqueue(Task);
+        }
+
+        NotifyWorker();
+    }
+
+    void FThreadPool::NotifyWorker()
+    {
+        // 与 WorkerLoop 中的栅栏配对：要么这里看到睡眠计数，要么睡眠前的检查看到新任务
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (SleepingCount_.load(std::memory_order::relaxed) == 0)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard Lock(SleepMutex_);
+            ++WakeEpoch_;
+        }
+        SleepCondition_.notify_one();
+    }
+
+    void FThreadPool::WakeAllWorkers()
+    {
+        {
+            std::lock_guard Lock(SleepMutex_);
+            ++WakeEpoch_;
+        }
+        SleepCondition_.notify_all();
+    }
+
+    void FThreadPool::ExecuteTask(ETaskPriority Priority, FTaskHandle Task)
+    {
+        // 外部线程帮助执行的任务不计入工作线程的统计
+        FWorker* Worker = CurrentThreadPool == this ? Workers_[CurrentWorkerIndex].get() : nullptr;
+#ifdef NPGS_ENABLE_TASK_TRACE
+        bool          bTimed    = Worker != nullptr && FTaskTracer::IsRecording();
+        std::uint64_t StartTime = bTimed ? FTaskTracer::GetTimestamp() : 0;
+#endif // NPGS_ENABLE_TASK_TRACE
+
+        {
+            // 任务对象析构后其槽位进入当前线程的本地缓存，下一次提交可以直接复用
+            FTaskPriorityScope PriorityScope(Priority);
+            auto Function = TaskPool_.Adopt(Task);
+            (*Function)();
+        }
+
+        if (Worker != nullptr)
+        {
+            FWorkerCounters::Add(Worker->Counters.ExecutedCount, 1);
+#ifdef NPGS_ENABLE_TASK_TRACE
+            if (bTimed)
+            {
+                FWorkerCounters::Add(Worker->Counters.RunTime, FTaskTracer::GetTimestamp() - StartTime);
+            }
+#endif // NPGS_ENABLE_TASK_TRACE
+        }
+
+        FinishTask();
+    }
+
+    void FThreadPool::FinishTask()
+    {
+        if (PendingTaskCount_.fetch_sub(1, std::memory_order::acq_rel) == 1)
+        {
+            PendingTaskCount_.notify_all();
         }
+    }
+
+    void FThreadPool::RecordTaskWait(std::uint64_t EnqueueTime)
+    {
+        if (CurrentThreadPool == this)
+        {
+            FWorkerCounters::Add(Workers_[CurrentWorkerIndex]->Counters.WaitTime, FTaskTracer::GetTimestamp() - EnqueueTime);
+        }
+    }
+
+    void FThreadPool::WorkerLoop(std::size_t WorkerIndex)
+    {
+        CurrentThreadPool  = this;
+        CurrentWorkerIndex = WorkerIndex;
+#ifdef NPGS_ENABLE_TASK_TRACE
+        FTaskTracer::SetThreadName("Worker " + std::to_string(WorkerIndex));
+#endif // NPGS_ENABLE_TASK_TRACE
 
-        for (std::size_t i = 0; i != MaxThreadCount_; ++i)
+        while (true)
         {
-            Threads_.emplace_back([this, i]() -> void
+            if (bDiscardPending_.load(std::memory_order::relaxed))
             {
-                FWorker& Worker = *Workers_[i];
-                while (true)
+                return;
+            }
+
+            if (WorkerIndex >= static_cast<std::size_t>(ThreadCount_.load(std::memory_order::relaxed)))
+            {
+                RetireWorker(WorkerIndex);
+                return;
+            }
+
+            ETaskPriority Priority{};
+            FTaskHandle   Handle{};
+            bool bFound = FindTask(WorkerIndex, Priority, Handle);
+            for (int Round = 0; !bFound && Round != kSpinRoundCount; ++Round)
+            {
+                std::this_thread::yield();
+                bFound = FindTask(WorkerIndex, Priority, Handle);
+            }
+
+            if (bFound)
+            {
+                ExecuteTask(Priority, Handle);
+                continue;
+            }
+
+            std::unique_lock Lock(SleepMutex_);
+            std::uint64_t Epoch = WakeEpoch_;
+            SleepingCount_.fetch_add(1, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+
+            // 线程数在持锁唤醒之前写入，这里重新检查，避免错过 Resize 的唤醒后一直睡眠
+            bool bRetired = WorkerIndex >= static_cast<std::size_t>(ThreadCount_.load(std::memory_order::relaxed));
+            if (!bRetired && !HasPendingTask())
+            {
+                if (bTerminate_.load())
                 {
-                    std::function<void()> Task;
-                    {
-                        std::unique_lock Lock(Worker.Mutex);
-                        Worker.Condition.wait(Lock, [this, &Worker]() -> bool
-                        {
-                            return !Worker.Tasks.empty() || bTerminate_.load();
-                        });
-
-                        if (bTerminate_.load() && Worker.Tasks.empty())
-                        {
-                            return;
-                        }
-
-                        Task = std::move(Worker.Tasks.front());
-                        Worker.Tasks.pop();
-                    }
-
-                    Task();
+                    SleepingCount_.fetch_sub(1, std::memory_order::relaxed);
+                    return;
                 }
-            });
 
-            if (!bEnableHyperThread_)
+                FWorkerCounters::Add(Workers_[WorkerIndex]->Counters.SleepCount, 1);
+                SleepCondition_.wait(Lock, [this, Epoch]() -> bool
+                {
+                    return WakeEpoch_ != Epoch || bTerminate_.load();
+                });
+            }
+
+            SleepingCount_.fetch_sub(1, std::memory_order::relaxed);
+        }
+    }
+
+    void FThreadPool::RetireWorker(std::size_t WorkerIndex)
+    {
+        // 只有所有者可以从 LIFO 端弹出，剩余任务转交给注入队列，由仍在运行的线程执行
+        FTaskHandle Handle{};
+        bool bMoved = false;
+        for (std::size_t Lane = 0; Lane != kPriorityCount; ++Lane)
+        {
+            while (Workers_[WorkerIndex]->Tasks[Lane].TryPop(Handle))
             {
-                SetThreadAffinity(Threads_.back(), i);
+                InjectionQueues_[Lane].enqueue(Handle);
+                bMoved = true;
             }
         }
+
+        if (bMoved)
+        {
+            NotifyWorker();
+        }
     }
 
-    FThreadPool::~FThreadPool()
+    bool FThreadPool::FindTask(std::size_t WorkerIndex, ETaskPriority& Priority, FTaskHandle& Task)
     {
-        bTerminate_.store(true);
-        for (auto& Worker : Workers_)
+        // 从随机位置开始轮询其他线程，避免所有空闲线程同时窃取同一个队列
+        FWorker& Worker = *Workers_[WorkerIndex];
+        Worker.RandomState ^= Worker.RandomState << 13;
+        Worker.RandomState ^= Worker.RandomState >> 7;
+        Worker.RandomState ^= Worker.RandomState << 17;
+        std::size_t StealStart = static_cast<std::size_t>(Worker.RandomState % Workers_.size());
+
+        // 按固定间隔先查找低优先级队列，保证高优先级任务持续到来时低优先级任务也能推进
+        std::uint32_t Tick = Worker.ScheduleTick;
+        std::size_t FirstLane = 0;
+        if (Tick % kBackgroundAgingInterval == kBackgroundAgingInterval - 1)
         {
-            Worker->Condition.notify_one();
+            FirstLane = static_cast<std::size_t>(ETaskPriority::kBackground);
         }
+        else if (Tick % kInteractiveAgingInterval == kInteractiveAgingInterval - 1)
+        {
+            FirstLane = static_cast<std::size_t>(ETaskPriority::kInteractive);
+        }
+
+        bool bFound = FindTaskInLane(WorkerIndex, FirstLane, StealStart, Task);
+        std::size_t Lane = FirstLane;
+        for (std::size_t i = 0; !bFound && i != kPriorityCount; ++i)
+        {
+            Lane   = i;
+            bFound = i != FirstLane && FindTaskInLane(WorkerIndex, i, StealStart, Task);
+        }
+
+        if (!bFound)
+        {
+            return false;
+        }
+
+        ++Worker.ScheduleTick;
+        Priority = static_cast<ETaskPriority>(Lane);
+        QueuedTaskCounts_[Lane].fetch_sub(1, std::memory_order::relaxed);
+        return true;
     }
 
-    void FThreadPool::SetThreadAffinity(std::jthread& Thread, std::size_t CoreId) const
+    bool FThreadPool::FindTaskInLane(std::size_t WorkerIndex, std::size_t Lane, std::size_t StealStart, FTaskHandle& Task)
     {
-        CoreId = CoreId % PhysicalCoreCount_;
-        HANDLE Handle = Thread.native_handle();
-        DWORD_PTR Mask = 0;
-        Mask = static_cast<DWORD_PTR>(Bit(CoreId * 2) + HyperThreadIndex_);
-        SetThreadAffinityMask(Handle, Mask);
+        if (QueuedTaskCounts_[Lane].load(std::memory_order::relaxed) == 0)
+        {
+            return false;
+        }
+
+        if (Workers_[WorkerIndex]->Tasks[Lane].TryPop(Task) || InjectionQueues_[Lane].try_dequeue(Task))
+        {
+            return true;
+        }
+
+        std::size_t WorkerCount = Workers_.size();
+        for (std::size_t i = 0; i != WorkerCount; ++i)
+        {
+            std::size_t Victim = (StealStart + i) % WorkerCount;
+            if (Victim != WorkerIndex && Workers_[Victim]->Tasks[Lane].TrySteal(Task))
+            {
+                FWorkerCounters::Add(Workers_[WorkerIndex]->Counters.StealCount, 1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool FThreadPool::TakeExternalTask(ETaskPriority& Priority, FTaskHandle& Task)
+    {
+        // 非工作线程没有本地队列，按优先级依次查找注入队列并从各工作线程窃取
+        for (std::size_t Lane = 0; Lane != kPriorityCount; ++Lane)
+        {
+            if (QueuedTaskCounts_[Lane].load(std::memory_order::relaxed) == 0)
+            {
+                continue;
+            }
+
+            bool bFound = InjectionQueues_[Lane].try_dequeue(Task);
+            for (std::size_t i = 0; !bFound && i != Workers_.size(); ++i)
+            {
+                bFound = Workers_[i]->Tasks[Lane].TrySteal(Task);
+            }
+
+            if (bFound)
+            {
+                Priority = static_cast<ETaskPriority>(Lane);
+                QueuedTaskCounts_[Lane].fetch_sub(1, std::memory_order::relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool FThreadPool::HasPendingTask() const
+    {
+        // 计数在任务入队之前增加，与 NotifyWorker 中的栅栏配对后不会漏掉刚提交的任务
+        return std::ranges::any_of(QueuedTaskCounts_, [](const auto& Count) -> bool
+        {
+            return Count.load(std::memory_order::relaxed) != 0;
+        });
+    }
+
+    void FThreadPool::BindWorker(std::size_t WorkerIndex)
+    {
+        FWorker& Worker = *Workers_[WorkerIndex];
+        auto SmtIndex   = static_cast<std::uint32_t>(HyperThreadIndex_.load());
+        auto Processors = Topology_.GetAffinitySet(AffinityPolicy_, WorkerIndex, SmtIndex);
+
+        // 只有所有处理器都位于同一节点时，线程所在的节点才是确定的
+        std::uint32_t NumaNode = kAnyNumaNode;
+        if (Topology_.ApplyAffinity(Worker.Thread, Processors))
+        {
+            const auto& LogicalProcessors = Topology_.GetLogicalProcessors();
+            NumaNode = LogicalProcessors[Processors.front()].NumaNode;
+            for (std::size_t Index : Processors)
+            {
+                if (LogicalProcessors[Index].NumaNode != NumaNode)
+                {
+                    NumaNode = kAnyNumaNode;
+                    break;
+                }
+            }
+        }
+
+        Worker.NumaNode.store(NumaNode, std::memory_order::relaxed);
     }
 } // namespace Npgs
@@ -1,53 +1,263 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <array>
 #include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <functional>
 #include <future>
 #include <memory>
+#include <limits>
+#include <mutex>
+#include <span>
 #include <thread>
 #include <vector>
 
+#include <concurrentqueue/moodycamel/concurrentqueue.h>
+
+#include "Engine/Core/Base/CpuTopology.hpp"
+#include "Engine/Runtime/Pools/CancellationToken.hpp"
+#include "Engine/Runtime/Pools/MemoryPool.hpp"
+#include "Engine/Runtime/Pools/TaskFunction.hpp"
+#include "Engine/Runtime/Pools/TaskTrace.hpp"
+
 namespace Npgs
 {
+    enum class EShutdownMode
+    {
+        kDrain,          // 执行完所有已提交的任务再退出
+        kDiscardPending  // 只等待正在执行的任务，尚未开始的任务被销毁，对应的 future 得到 broken_promise
+    };
+
+    // 任务优先级，工作线程总是先取高优先级的任务。为避免持续的高优先级负载饿死低优先级任务，
+    // 每个工作线程每取若干个任务就有一次从较低的优先级开始查找
+    enum class ETaskPriority : std::uint8_t
+    {
+        kFrameCritical,  // 当前帧必须完成的工作，如剔除、更新 uniform
+        kInteractive,    // 需要尽快完成但不阻塞帧的工作，如资产解码。非工作线程提交时的默认优先级
+        kBackground      // 长时间运行的批处理，如宇宙生成
+    };
+
+    // 在作用域内设置当前线程的任务优先级，不指定优先级的提交（包括并行算法的辅助任务）使用该优先级
+    // 工作线程执行任务时自动设为该任务的优先级，因此任务内部派生的子任务默认继承父任务的优先级
+    class FTaskPriorityScope
+    {
+    public:
+        explicit FTaskPriorityScope(ETaskPriority Priority);
+        FTaskPriorityScope(const FTaskPriorityScope&) = delete;
+        FTaskPriorityScope(FTaskPriorityScope&&)      = delete;
+        ~FTaskPriorityScope();
+
+        FTaskPriorityScope& operator=(const FTaskPriorityScope&) = delete;
+        FTaskPriorityScope& operator=(FTaskPriorityScope&&)      = delete;
+
+        static ETaskPriority GetCurrentPriority();
+
+    private:
+        ETaskPriority PreviousPriority_;
+    };
+
+    // 工作窃取线程池：每个工作线程拥有一个 Chase-Lev 双端队列，外部线程提交的任务进入全局注入队列
+    // 工作线程内部提交的任务压入自身队列（LIFO，利于缓存），空闲线程依次从自身队列、注入队列和其他线程的队列中获取任务
+    // 每个优先级各有一组队列，查找时按优先级从高到低进行
     class FThreadPool
     {
     public:
-        FThreadPool(int MaxThreadCount = 0, bool bEnableHyperThread = false);
+        // co_await ThreadPool->Schedule() 将当前协程挂起并转移到线程池中继续执行
+        class FScheduleAwaiter
+        {
+        public:
+            FScheduleAwaiter(FThreadPool* ThreadPool, ETaskPriority Priority);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> Handle);
+            void await_resume() const noexcept;
+
+        private:
+            FThreadPool*  ThreadPool_;
+            ETaskPriority Priority_;
+        };
+
+        // 工作线程自启动以来的累计计数。RunTimeMs 与 WaitTimeMs（任务从提交到开始执行的时间）
+        // 只在启用 NPGS_ENABLE_TASK_TRACE 且 FTaskTracer 正在记录时统计，否则不增长，见 FStatistics::bTaskTimingCollected
+        struct FWorkerStatistics
+        {
+            std::uint64_t ExecutedCount{};
+            std::uint64_t StealCount{};
+            std::uint64_t SleepCount{};
+            double        RunTimeMs{};
+            double        WaitTimeMs{};
+        };
+
+        // 区间中由同一 NUMA 节点上的工作线程优先处理的连续分片
+        struct FNumaShard
+        {
+            std::uint32_t NumaNode{};
+            std::size_t   Begin{};
+            std::size_t   End{};
+        };
+
+        struct FStatistics
+        {
+            std::array<std::size_t, 3>     QueuedTaskCounts{};  // 按 ETaskPriority 索引的队列深度
+            std::size_t                    PendingTaskCount{};  // 已提交但尚未完成的任务数，包括正在执行的任务
+            std::vector<FWorkerStatistics> Workers;             // 只包括正在运行的工作线程
+            bool                           bTaskTimingCollected{}; // RunTimeMs 与 WaitTimeMs 是否有记录，为 false 时二者没有意义
+        };
+
+    public:
+        // bEnableHyperThread 为 true 时 kOnePerCore 不绑定线程，由系统在所有逻辑处理器上调度
+        // MaxThreadCount 为 0 时任务在提交线程上同步执行，之后仍可以通过 Resize 启动工作线程
+        FThreadPool(int MaxThreadCount = 0, bool bEnableHyperThread = false,
+                    EThreadAffinityPolicy AffinityPolicy = EThreadAffinityPolicy::kOnePerCore);
         FThreadPool(const FThreadPool&) = delete;
         FThreadPool(FThreadPool&&)      = delete;
-        ~FThreadPool();
+        ~FThreadPool(); // 等价于 Shutdown(EShutdownMode::kDrain)
 
         FThreadPool& operator=(const FThreadPool&) = delete;
         FThreadPool& operator=(FThreadPool&&)      = delete;
 
+        // 不指定优先级时使用 FTaskPriorityScope::GetCurrentPriority()
         template <typename Func, typename... Types>
+        requires std::invocable<Func, Types...>
         auto Submit(Func&& Pred, Types&&... Args);
 
+        template <typename Func, typename... Types>
+        auto Submit(ETaskPriority Priority, Func&& Pred, Types&&... Args);
+
+        // 不返回 future 的提交方式，稳态下不分配堆内存。任务中抛出的异常不会被捕获
+        template <typename Func, typename... Types>
+        requires std::invocable<Func, Types...>
+        void Enqueue(Func&& Pred, Types&&... Args);
+
+        template <typename Func, typename... Types>
+        void Enqueue(ETaskPriority Priority, Func&& Pred, Types&&... Args);
+
+        // 并行算法：区间被切分为连续的块，由空闲线程动态领取，调用线程也参与执行，因此可以在工作线程中嵌套调用
+        // 辅助任务使用调用线程当前的优先级
+        // Grain 为每块的最小元素数量，为 0 时按线程数自动选择，块内异常会在调用线程中重新抛出
+        // Pred 可以接受 (Begin, End) 处理整块，也可以接受单个下标
+        template <typename Func>
+        void ParallelFor(std::size_t Begin, std::size_t End, std::size_t Grain, Func&& Pred);
+
+        // 固定块数的并行循环，Pred(ChunkIndex, Begin, End)，用于每个块需要独占资源（如生成器）的场合
+        template <typename Func>
+        void ParallelForChunks(std::size_t Count, std::size_t ChunkCount, Func&& Pred);
+
+        // 把 [0, Count) 按各 NUMA 节点上运行的工作线程数成比例切成连续分片，单节点或线程未绑定到节点时只有一个分片
+        std::vector<FNumaShard> MakeNumaShards(std::size_t Count) const;
+
+        // 按分片执行的并行循环：每个分片再切成块，工作线程先领取本节点分片中的块，本节点完成后再帮助其他节点
+        // 配合同样分片的首次写入（first-touch），可以让各分片的数据分配在其节点上并在之后的遍历中保持本地访问
+        // Pred 的形式与 ParallelFor 相同，Grain 为 0 时按线程数自动选择
+        template <typename Func>
+        void ParallelForShards(std::span<const FNumaShard> Shards, std::size_t Grain, Func&& Pred);
+
+        // Reduce(Begin, End, Accumulator) 返回块内的累积结果，块结果按块顺序用 Combine 合并，结果与调度顺序无关
+        template <typename ValueType, typename RangeFunc, typename CombineFunc>
+        ValueType ParallelReduce(std::size_t Begin, std::size_t End, std::size_t Grain, ValueType Identity,
+                                 RangeFunc&& Reduce, CombineFunc&& Combine);
+
+        template <typename InputIt, typename OutputIt, typename Func>
+        OutputIt ParallelTransform(InputIt First, InputIt Last, OutputIt Output, Func&& Pred, std::size_t Grain = 0);
+
+        // 各块分别排序后两两归并
+        template <typename RandomIt, typename Compare = std::less<>>
+        void ParallelSort(RandomIt First, RandomIt Last, Compare Comp = {});
+
+        FScheduleAwaiter Schedule(ETaskPriority Priority = FTaskPriorityScope::GetCurrentPriority());
+
+        // 等待所有已提交的任务（包括执行期间新提交的任务）完成，等待期间调用线程也执行任务。不能在工作线程中调用
+        void WaitIdle();
+
+        // 调整工作线程数量，范围 [1, 逻辑处理器数量]。减少时被回收的线程执行完当前任务后，
+        // 把自身队列中剩余的任务转交给注入队列再退出，函数返回时这些线程已经结束。不能在工作线程中调用
+        void Resize(int ThreadCount);
+
+        // 取消 GetShutdownToken 返回的令牌并停止所有工作线程，之后提交的任务在提交线程上同步执行
+        // 调用期间不应再从其他线程提交任务。不能在工作线程中调用，重复调用没有效果
+        void Shutdown(EShutdownMode Mode = EShutdownMode::kDrain);
+        FCancellationToken GetShutdownToken() const;
+
+        // 在调用线程上执行一个待处理的任务，没有任务时返回 false。用于同步等待时帮助线程池推进，避免工作线程全部阻塞
+        bool RunPendingTask();
+
+        // 当前线程所在的 NUMA 节点。只有绑定到单个节点的工作线程有确定的节点，其他线程返回 kAnyNumaNode
+        static std::uint32_t GetCurrentNumaNode();
+        std::size_t GetNumaNodeCount() const;
+
+        FStatistics GetStatistics() const;
+        void LogStatistics() const;
+
+        // 切换 kOnePerCore 使用的超线程并重新绑定所有工作线程
         void SwitchHyperThread();
         int  GetMaxThreadCount() const;
+        const FCpuTopology& GetTopology() const;
 
     private:
+        struct FWorkerCounters;
         struct FWorker;
+        struct FParallelState;
+        struct FShardedParallelState;
+
+        using FTaskPool       = TMemoryPool<FTaskFunction, 12>;
+        using FTaskHandle     = FTaskPool::FMemoryHandle;
+        using FInjectionQueue = moodycamel::ConcurrentQueue<FTaskHandle>;
+
+    public:
+        static constexpr std::uint32_t kAnyNumaNode = std::numeric_limits<std::uint32_t>::max();
 
     private:
-        void SetThreadAffinity(std::jthread& Thread, std::size_t CoreId) const;
+        static constexpr std::size_t   kChunksPerThread          = 4;
+        static constexpr std::size_t   kMinParallelSortCount     = 8192;
+        static constexpr std::size_t   kPriorityCount            = 3;
+        static constexpr std::uint32_t kInteractiveAgingInterval = 8;   // 每取这么多个任务，从 kInteractive 开始查找一次
+        static constexpr std::uint32_t kBackgroundAgingInterval  = 32;  // 每取这么多个任务，从 kBackground 开始查找一次
 
     private:
-        std::vector<std::unique_ptr<FWorker>> Workers_;
-        std::vector<std::jthread>             Threads_;
-        std::atomic<std::size_t>              NextThreadIndex_{};
-        int                                   MaxThreadCount_;
-        int                                   PhysicalCoreCount_;
-        std::atomic<int>                      HyperThreadIndex_{};
-        std::atomic<bool>                     bTerminate_{ false };
-        bool                                  bEnableHyperThread_;
-    };
+        std::size_t GetChunkCount(std::size_t Count, std::size_t Grain) const;
+
+        template <typename Func>
+        void Dispatch(ETaskPriority Priority, Func&& Pred);
 
-    template <typename DataType, typename ResultType>
-    void MakeChunks(int MaxThread, std::vector<DataType>& Data,
-                    std::vector<std::vector<DataType>>& DataLists,
-                    std::vector<std::promise<std::vector<ResultType>>>& Promises,
-                    std::vector<std::future<std::vector<ResultType>>>& ChunkFutures);
+        void PushTask(ETaskPriority Priority, FTaskHandle Task);
+        void ExecuteTask(ETaskPriority Priority, FTaskHandle Task);
+        void FinishTask();
+        void RecordTaskWait(std::uint64_t EnqueueTime);
+        void NotifyWorker();
+        void WakeAllWorkers();
+        void WorkerLoop(std::size_t WorkerIndex);
+        void RetireWorker(std::size_t WorkerIndex);
+        bool FindTask(std::size_t WorkerIndex, ETaskPriority& Priority, FTaskHandle& Task);
+        bool FindTaskInLane(std::size_t WorkerIndex, std::size_t Lane, std::size_t StealStart, FTaskHandle& Task);
+        bool TakeExternalTask(ETaskPriority& Priority, FTaskHandle& Task);
+        bool HasPendingTask() const;
+        void BindWorker(std::size_t WorkerIndex);
+
+    private:
+        FTaskPool                                            TaskPool_;
+        std::vector<std::unique_ptr<FWorker>>                Workers_;            // 按最大线程数预先创建，只有前 ThreadCount_ 个在运行
+        std::array<FInjectionQueue, kPriorityCount>          InjectionQueues_;
+        std::array<std::atomic<std::size_t>, kPriorityCount> QueuedTaskCounts_{}; // 各优先级已入队、尚未被取走的任务数
+        std::mutex                                           ResizeMutex_;        // 串行化线程的启动、回收与重新绑定
+        std::atomic<std::size_t>                             PendingTaskCount_{};
+        FCancellationSource                                  ShutdownSource_;
+        std::mutex                                           SleepMutex_;
+        std::condition_variable                              SleepCondition_;
+        std::uint64_t                                        WakeEpoch_{};        // 由 SleepMutex_ 保护
+        std::atomic<int>                                     SleepingCount_{};
+        FCpuTopology                                         Topology_;
+        EThreadAffinityPolicy                                AffinityPolicy_;
+        int                                                  MaxWorkerCount_;
+        std::atomic<int>                                     ThreadCount_{};
+        std::atomic<int>                                     HyperThreadIndex_{};
+        std::atomic<bool>                                    bTerminate_{ false };
+        std::atomic<bool>                                    bDiscardPending_{ false };
+        bool                                                 bEnableHyperThread_;
+    };
 } // namespace Npgs
 
 #include "ThreadPool.inl"
@@ -1,76 +1,539 @@
-#include <condition_variable>
+#include <algorithm>
+#include <bit>
+#include <exception>
 #include <functional>
-#include <mutex>
-#include <queue>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
 #include "Engine/Core/Base/Base.hpp"
+#include "Engine/Runtime/Pools/WorkStealingDeque.hpp"
 
 namespace Npgs
 {
+    // 只由所属的工作线程写入，用普通的读写代替原子读改写，统计时其他线程可以并发读取
+    struct FThreadPool::FWorkerCounters
+    {
+        std::atomic<std::uint64_t> ExecutedCount{};
+        std::atomic<std::uint64_t> StealCount{};
+        std::atomic<std::uint64_t> SleepCount{};
+        std::atomic<std::uint64_t> RunTime{};   // 纳秒
+        std::atomic<std::uint64_t> WaitTime{};  // 纳秒
+
+        static void Add(std::atomic<std::uint64_t>& Counter, std::uint64_t Value)
+        {
+            Counter.store(Counter.load(std::memory_order::relaxed) + Value, std::memory_order::relaxed);
+        }
+    };
+
     struct FThreadPool::FWorker
     {
-        std::mutex                        Mutex;
-        std::condition_variable           Condition;
-        std::queue<std::function<void()>> Tasks;
+        std::array<TWorkStealingDeque<FTaskHandle>, kPriorityCount> Tasks;            // 按优先级分开的本地队列
+        std::uint64_t                                               RandomState{};    // 选择窃取对象用的 xorshift 状态
+        std::uint32_t                                               ScheduleTick{};   // 已取得的任务数，决定何时优先查找低优先级队列
+        std::jthread                                                Thread;
+        std::atomic<std::uint32_t>                                  NumaNode{ kAnyNumaNode };  // 由 BindWorker 写入
+        FWorkerCounters                                             Counters;
+    };
+
+    // 并行循环的共享状态。辅助任务可能在循环结束后才被调度，因此状态由 shared_ptr 持有，
+    // 调用者栈上的函数对象以指针传入 Drain，只在领取到有效的块之后才解引用，循环结束后调度的辅助任务不会触及它
+    struct FThreadPool::FParallelState
+    {
+        std::atomic<std::size_t> NextChunk{};
+        std::atomic<std::size_t> CompletedChunks{};
+        std::size_t              ChunkCount{};
+        std::mutex               ExceptionMutex;
+        std::exception_ptr       Exception;
+
+        template <typename Func>
+        void Drain(Func* RunChunk)
+        {
+            std::size_t Chunk = 0;
+            while ((Chunk = NextChunk.fetch_add(1, std::memory_order::relaxed)) < ChunkCount)
+            {
+                try
+                {
+                    (*RunChunk)(Chunk);
+                }
+                catch (...)
+                {
+                    std::lock_guard Lock(ExceptionMutex);
+                    if (Exception == nullptr)
+                    {
+                        Exception = std::current_exception();
+                    }
+                }
+
+                if (CompletedChunks.fetch_add(1, std::memory_order::acq_rel) + 1 == ChunkCount)
+                {
+                    CompletedChunks.notify_all();
+                }
+            }
+        }
+    };
+
+    // 按分片划分的并行循环状态。每个分片有独立的块计数器，各自占用一条缓存行，不同节点的线程领取块时互不干扰
+    struct FThreadPool::FShardedParallelState
+    {
+        struct alignas(64) FShardCursor
+        {
+            std::atomic<std::size_t> NextChunk{};
+            std::size_t              ChunkCount{};
+            std::uint32_t            NumaNode{};
+        };
+
+        std::unique_ptr<FShardCursor[]> Cursors;
+        std::size_t                     ShardCount{};
+        std::size_t                     ChunkCount{};
+        std::atomic<std::size_t>        CompletedChunks{};
+        std::mutex                      ExceptionMutex;
+        std::exception_ptr              Exception;
+
+        // 先处理本节点的分片，再按顺序帮助其他分片
+        template <typename Func>
+        void Drain(Func* RunChunk, std::uint32_t NumaNode)
+        {
+            if (NumaNode != kAnyNumaNode)
+            {
+                for (std::size_t Shard = 0; Shard != ShardCount; ++Shard)
+                {
+                    if (Cursors[Shard].NumaNode == NumaNode)
+                    {
+                        DrainShard(RunChunk, Shard);
+                    }
+                }
+            }
+
+            for (std::size_t Shard = 0; Shard != ShardCount; ++Shard)
+            {
+                DrainShard(RunChunk, Shard);
+            }
+        }
+
+        template <typename Func>
+        void DrainShard(Func* RunChunk, std::size_t Shard)
+        {
+            FShardCursor& Cursor = Cursors[Shard];
+            std::size_t Chunk = 0;
+            while ((Chunk = Cursor.NextChunk.fetch_add(1, std::memory_order::relaxed)) < Cursor.ChunkCount)
+            {
+                try
+                {
+                    (*RunChunk)(Shard, Chunk);
+                }
+                catch (...)
+                {
+                    std::lock_guard Lock(ExceptionMutex);
+                    if (Exception == nullptr)
+                    {
+                        Exception = std::current_exception();
+                    }
+                }
+
+                if (CompletedChunks.fetch_add(1, std::memory_order::acq_rel) + 1 == ChunkCount)
+                {
+                    CompletedChunks.notify_all();
+                }
+            }
+        }
     };
 
     template <typename Func, typename... Types>
+    requires std::invocable<Func, Types...>
     auto FThreadPool::Submit(Func&& Pred, Types&&... Args)
+    {
+        return Submit(FTaskPriorityScope::GetCurrentPriority(), std::forward<Func>(Pred), std::forward<Types>(Args)...);
+    }
+
+    template <typename Func, typename... Types>
+    auto FThreadPool::Submit(ETaskPriority Priority, Func&& Pred, Types&&... Args)
     {
         using FReturnType = std::invoke_result_t<Func, Types...>;
 
-        if (Threads_.empty())
+        // 共享状态与结果都从 TTaskStateAllocator 分配，任务本身存储在 TaskPool_ 中，稳态下不访问堆
+        std::promise<FReturnType> Promise(std::allocator_arg, TTaskStateAllocator<FReturnType>{});
+        std::future<FReturnType>  Future = Promise.get_future();
+
+        auto Task = [Promise = std::move(Promise), Pred = std::forward<Func>(Pred), ...Args = std::forward<Types>(Args)]() mutable -> void
         {
-            return std::future<FReturnType>();
+            try
+            {
+                if constexpr (std::is_void_v<FReturnType>)
+                {
+                    std::invoke(std::move(Pred), std::move(Args)...);
+                    Promise.set_value();
+                }
+                else
+                {
+                    Promise.set_value(std::invoke(std::move(Pred), std::move(Args)...));
+                }
+            }
+            catch (...)
+            {
+                Promise.set_exception(std::current_exception());
+            }
+        };
+
+        // 没有工作线程时（未启动或已关闭）在提交线程上同步执行，返回的 future 已经就绪
+        if (GetMaxThreadCount() == 0)
+        {
+            Task();
+        }
+        else
+        {
+            Dispatch(Priority, std::move(Task));
         }
 
-        auto Task = std::make_shared<std::packaged_task<FReturnType()>>(
-        [Pred = std::forward<Func>(Pred), ...Args = std::forward<Types>(Args)]() mutable -> FReturnType
+        return Future;
+    }
+
+    template <typename Func, typename... Types>
+    requires std::invocable<Func, Types...>
+    void FThreadPool::Enqueue(Func&& Pred, Types&&... Args)
+    {
+        Enqueue(FTaskPriorityScope::GetCurrentPriority(), std::forward<Func>(Pred), std::forward<Types>(Args)...);
+    }
+
+    template <typename Func, typename... Types>
+    void FThreadPool::Enqueue(ETaskPriority Priority, Func&& Pred, Types&&... Args)
+    {
+        if (GetMaxThreadCount() == 0)
+        {
+            std::invoke(std::forward<Func>(Pred), std::forward<Types>(Args)...);
+            return;
+        }
+
+        if constexpr (sizeof...(Types) == 0)
         {
-            return std::invoke(std::move(Pred), std::move(Args)...);
+            Dispatch(Priority, std::forward<Func>(Pred));
+        }
+        else
+        {
+            Dispatch(Priority, [Pred = std::forward<Func>(Pred), ...Args = std::forward<Types>(Args)]() mutable -> void
+            {
+                std::invoke(std::move(Pred), std::move(Args)...);
+            });
+        }
+    }
+
+    template <typename Func>
+    void FThreadPool::ParallelFor(std::size_t Begin, std::size_t End, std::size_t Grain, Func&& Pred)
+    {
+        if (Begin >= End)
+        {
+            return;
+        }
+
+        std::size_t Count = End - Begin;
+        ParallelForChunks(Count, GetChunkCount(Count, Grain), [Begin, &Pred](std::size_t, std::size_t ChunkBegin, std::size_t ChunkEnd) -> void
+        {
+            if constexpr (std::is_invocable_v<Func&, std::size_t, std::size_t>)
+            {
+                Pred(Begin + ChunkBegin, Begin + ChunkEnd);
+            }
+            else
+            {
+                for (std::size_t i = Begin + ChunkBegin; i != Begin + ChunkEnd; ++i)
+                {
+                    Pred(i);
+                }
+            }
         });
-        std::future<FReturnType> Future = Task->get_future();
+    }
 
-        std::size_t ThreadIndex = NextThreadIndex_.fetch_add(1) % MaxThreadCount_;
-        auto& TargetWorker = Workers_[ThreadIndex];
+    template <typename Func>
+    void FThreadPool::ParallelForChunks(std::size_t Count, std::size_t ChunkCount, Func&& Pred)
+    {
+        ChunkCount = std::min(ChunkCount, Count);
+        if (ChunkCount == 0)
         {
-            std::unique_lock<std::mutex> Lock(TargetWorker->Mutex);
-            TargetWorker->Tasks.emplace([Task]() -> void { (*Task)(); });
+            return;
         }
-        TargetWorker->Condition.notify_one();
 
-        return Future;
+        // 前 Remainder 个块各多分一个元素，块之间连续且大小最多相差 1
+        std::size_t ChunkSize = Count / ChunkCount;
+        std::size_t Remainder = Count % ChunkCount;
+        auto RunChunk = [&Pred, ChunkSize, Remainder](std::size_t Chunk) -> void
+        {
+            std::size_t ChunkBegin = Chunk * ChunkSize + std::min(Chunk, Remainder);
+            std::size_t ChunkEnd   = ChunkBegin + ChunkSize + (Chunk < Remainder ? 1 : 0);
+            Pred(Chunk, ChunkBegin, ChunkEnd);
+        };
+
+        int ThreadCount = GetMaxThreadCount();
+        if (ChunkCount == 1 || ThreadCount == 0)
+        {
+            for (std::size_t Chunk = 0; Chunk != ChunkCount; ++Chunk)
+            {
+                RunChunk(Chunk);
+            }
+
+            return;
+        }
+
+        auto State = std::make_shared<FParallelState>();
+        State->ChunkCount = ChunkCount;
+
+        ETaskPriority Priority    = FTaskPriorityScope::GetCurrentPriority();
+        std::size_t   HelperCount = std::min(ChunkCount - 1, static_cast<std::size_t>(ThreadCount));
+        for (std::size_t i = 0; i != HelperCount; ++i)
+        {
+            Dispatch(Priority, [State, Runner = &RunChunk]() -> void { State->Drain(Runner); });
+        }
+
+        State->Drain(&RunChunk);
+
+        std::size_t Completed = State->CompletedChunks.load(std::memory_order::acquire);
+        while (Completed != ChunkCount)
+        {
+            State->CompletedChunks.wait(Completed, std::memory_order::acquire);
+            Completed = State->CompletedChunks.load(std::memory_order::acquire);
+        }
+
+        if (State->Exception != nullptr)
+        {
+            std::rethrow_exception(State->Exception);
+        }
+    }
+
+    template <typename Func>
+    void FThreadPool::ParallelForShards(std::span<const FNumaShard> Shards, std::size_t Grain, Func&& Pred)
+    {
+        std::size_t Count = 0;
+        for (const auto& Shard : Shards)
+        {
+            Count += Shard.End - Shard.Begin;
+        }
+
+        if (Count == 0)
+        {
+            return;
+        }
+
+        // 所有分片使用同一块大小，块数与分片大小成比例
+        if (Grain == 0)
+        {
+            Grain = (Count + GetChunkCount(Count, 0) - 1) / GetChunkCount(Count, 0);
+        }
+
+        auto RunRange = [&Pred](std::size_t Begin, std::size_t End) -> void
+        {
+            if constexpr (std::is_invocable_v<Func&, std::size_t, std::size_t>)
+            {
+                Pred(Begin, End);
+            }
+            else
+            {
+                for (std::size_t i = Begin; i != End; ++i)
+                {
+                    Pred(i);
+                }
+            }
+        };
+
+        int ThreadCount = GetMaxThreadCount();
+        if (ThreadCount == 0 || Count <= Grain)
+        {
+            for (const auto& Shard : Shards)
+            {
+                if (Shard.Begin != Shard.End)
+                {
+                    RunRange(Shard.Begin, Shard.End);
+                }
+            }
+
+            return;
+        }
+
+        auto State = std::make_shared<FShardedParallelState>();
+        State->Cursors    = std::make_unique<FShardedParallelState::FShardCursor[]>(Shards.size());
+        State->ShardCount = Shards.size();
+        for (std::size_t i = 0; i != Shards.size(); ++i)
+        {
+            State->Cursors[i].ChunkCount = (Shards[i].End - Shards[i].Begin + Grain - 1) / Grain;
+            State->Cursors[i].NumaNode   = Shards[i].NumaNode;
+            State->ChunkCount           += State->Cursors[i].ChunkCount;
+        }
+
+        auto RunChunk = [&RunRange, Shards, Grain](std::size_t Shard, std::size_t Chunk) -> void
+        {
+            std::size_t ChunkBegin = Shards[Shard].Begin + Chunk * Grain;
+            RunRange(ChunkBegin, std::min(ChunkBegin + Grain, Shards[Shard].End));
+        };
+
+        ETaskPriority Priority    = FTaskPriorityScope::GetCurrentPriority();
+        std::size_t   HelperCount = std::min(State->ChunkCount - 1, static_cast<std::size_t>(ThreadCount));
+        for (std::size_t i = 0; i != HelperCount; ++i)
+        {
+            Dispatch(Priority, [State, Runner = &RunChunk]() -> void { State->Drain(Runner, GetCurrentNumaNode()); });
+        }
+
+        State->Drain(&RunChunk, GetCurrentNumaNode());
+
+        std::size_t Completed = State->CompletedChunks.load(std::memory_order::acquire);
+        while (Completed != State->ChunkCount)
+        {
+            State->CompletedChunks.wait(Completed, std::memory_order::acquire);
+            Completed = State->CompletedChunks.load(std::memory_order::acquire);
+        }
+
+        if (State->Exception != nullptr)
+        {
+            std::rethrow_exception(State->Exception);
+        }
     }
 
-    NPGS_INLINE void FThreadPool::SwitchHyperThread()
+    template <typename ValueType, typename RangeFunc, typename CombineFunc>
+    ValueType FThreadPool::ParallelReduce(std::size_t Begin, std::size_t End, std::size_t Grain, ValueType Identity,
+                                          RangeFunc&& Reduce, CombineFunc&& Combine)
     {
-        HyperThreadIndex_.store(1 - HyperThreadIndex_.load());
+        if (Begin >= End)
+        {
+            return Identity;
+        }
+
+        std::size_t Count      = End - Begin;
+        std::size_t ChunkCount = GetChunkCount(Count, Grain);
+        std::vector<ValueType> Partials(ChunkCount, Identity);
+
+        ParallelForChunks(Count, ChunkCount, [&](std::size_t Chunk, std::size_t ChunkBegin, std::size_t ChunkEnd) -> void
+        {
+            Partials[Chunk] = Reduce(Begin + ChunkBegin, Begin + ChunkEnd, std::move(Partials[Chunk]));
+        });
+
+        ValueType Result = std::move(Identity);
+        for (auto& Partial : Partials)
+        {
+            Result = Combine(std::move(Result), std::move(Partial));
+        }
+
+        return Result;
     }
 
-    NPGS_INLINE int FThreadPool::GetMaxThreadCount() const
+    template <typename InputIt, typename OutputIt, typename Func>
+    OutputIt FThreadPool::ParallelTransform(InputIt First, InputIt Last, OutputIt Output, Func&& Pred, std::size_t Grain)
     {
-        return MaxThreadCount_;
+        auto Count = static_cast<std::size_t>(std::distance(First, Last));
+        ParallelFor(0, Count, Grain, [&](std::size_t Begin, std::size_t End) -> void
+        {
+            std::transform(First + Begin, First + End, Output + Begin, Pred);
+        });
+
+        return Output + Count;
     }
 
-    template <typename DataType, typename ResultType>
-    void MakeChunks(int MaxThread, std::vector<DataType>& Data,
-                    std::vector<std::vector<DataType>>& DataLists,
-                    std::vector<std::promise<std::vector<ResultType>>>& Promises,
-                    std::vector<std::future<std::vector<ResultType>>>& ChunkFutures)
+    template <typename RandomIt, typename Compare>
+    void FThreadPool::ParallelSort(RandomIt First, RandomIt Last, Compare Comp)
     {
-        for (std::size_t i = 0; i != Data.size(); ++i)
+        auto Count = static_cast<std::size_t>(std::distance(First, Last));
+        int ThreadCount = GetMaxThreadCount();
+        if (Count < kMinParallelSortCount || ThreadCount == 0)
         {
-            std::size_t ThreadId = i % MaxThread;
-            DataLists[ThreadId].push_back(std::move(Data[i]));
+            std::sort(First, Last, Comp);
+            return;
         }
 
-        Promises.resize(MaxThread);
+        // 块数取 2 的幂，便于逐层两两归并
+        std::size_t ChunkCount = std::bit_floor(std::min(static_cast<std::size_t>(ThreadCount) * 2, Count / (kMinParallelSortCount / 2)));
+        std::size_t ChunkSize  = Count / ChunkCount;
+        std::size_t Remainder  = Count % ChunkCount;
+        auto ChunkBoundary = [&](std::size_t Chunk) -> RandomIt
+        {
+            return First + (Chunk * ChunkSize + std::min(Chunk, Remainder));
+        };
 
-        for (int i = 0; i != MaxThread; ++i)
+        ParallelForChunks(Count, ChunkCount, [&](std::size_t, std::size_t Begin, std::size_t End) -> void
         {
-            ChunkFutures.push_back(Promises[i].get_future());
+            std::sort(First + Begin, First + End, Comp);
+        });
+
+        for (std::size_t Width = 1; Width < ChunkCount; Width *= 2)
+        {
+            ParallelFor(0, ChunkCount / (Width * 2), 1, [&](std::size_t Pair) -> void
+            {
+                std::size_t Left = Pair * Width * 2;
+                std::inplace_merge(ChunkBoundary(Left), ChunkBoundary(Left + Width), ChunkBoundary(Left + Width * 2), Comp);
+            });
         }
     }
+
+    template <typename Func>
+    void FThreadPool::Dispatch(ETaskPriority Priority, Func&& Pred)
+    {
+#ifdef NPGS_ENABLE_TASK_TRACE
+        // 任务以提交线程当前追踪作用域的名称记录，并行循环的各个块因此可以归属到发起它的阶段
+        // 未在记录时不包装任务，闭包大小与关闭追踪时相同
+        if (FTaskTracer::IsRecording())
+        {
+            auto Task = TaskPool_.Allocate([this, Pred = std::forward<Func>(Pred), EnqueueTime = FTaskTracer::GetTimestamp(),
+                                            Name = FTaskTracer::GetCurrentScopeName()]() mutable -> void
+            {
+                RecordTaskWait(EnqueueTime);
+                FTraceScope TraceScope(Name);
+                Pred();
+            });
+
+            PushTask(Priority, Task.Release());
+            return;
+        }
+#endif // NPGS_ENABLE_TASK_TRACE
+        auto Task = TaskPool_.Allocate(std::forward<Func>(Pred));
+        PushTask(Priority, Task.Release());
+    }
+
+    NPGS_INLINE FThreadPool::FScheduleAwaiter::FScheduleAwaiter(FThreadPool* ThreadPool, ETaskPriority Priority)
+        : ThreadPool_(ThreadPool)
+        , Priority_(Priority)
+    {
+    }
+
+    NPGS_INLINE bool FThreadPool::FScheduleAwaiter::await_ready() const noexcept
+    {
+        return ThreadPool_->GetMaxThreadCount() == 0;
+    }
+
+    NPGS_INLINE void FThreadPool::FScheduleAwaiter::await_suspend(std::coroutine_handle<> Handle)
+    {
+        ThreadPool_->Dispatch(Priority_, [Handle]() -> void { Handle.resume(); });
+    }
+
+    NPGS_INLINE void FThreadPool::FScheduleAwaiter::await_resume() const noexcept
+    {
+    }
+
+    NPGS_INLINE FThreadPool::FScheduleAwaiter FThreadPool::Schedule(ETaskPriority Priority)
+    {
+        return FScheduleAwaiter(this, Priority);
+    }
+
+    NPGS_INLINE std::size_t FThreadPool::GetChunkCount(std::size_t Count, std::size_t Grain) const
+    {
+        if (Grain == 0)
+        {
+            return std::min(Count, std::max<std::size_t>(GetMaxThreadCount(), 1) * kChunksPerThread);
+        }
+
+        return (Count + Grain - 1) / Grain;
+    }
+
+    NPGS_INLINE int FThreadPool::GetMaxThreadCount() const
+    {
+        return ThreadCount_.load(std::memory_order::relaxed);
+    }
+
+    NPGS_INLINE FCancellationToken FThreadPool::GetShutdownToken() const
+    {
+        return ShutdownSource_.GetToken();
+    }
+
+    NPGS_INLINE std::size_t FThreadPool::GetNumaNodeCount() const
+    {
+        return Topology_.GetNumaNodeCount();
+    }
+
+    NPGS_INLINE const FCpuTopology& FThreadPool::GetTopology() const
+    {
+        return Topology_;
+    }
 } // namespace Npgs
@@ -0,0 +1,367 @@
+#include "stdafx.h"
+#include "TlsfAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "Engine/Core/Base/Assert.hpp"
+
+namespace Npgs
+{
+    FTlsfAllocator::FTlsfAllocator(std::uint64_t TotalSize)
+    {
+        Initialize(TotalSize);
+    }
+
+    void FTlsfAllocator::Initialize(std::uint64_t TotalSize)
+    {
+        TotalSize_ = TotalSize;
+        Reset();
+    }
+
+    void FTlsfAllocator::Reset()
+    {
+        Blocks_.clear();
+        Allocations_.clear();
+        for (auto& Heads : FreeHeads_)
+        {
+            Heads.fill(kNullBlock);
+        }
+
+        SecondLevelBitmaps_.fill(0);
+        FirstLevelBitmap_ = 0;
+        UsedSize_         = 0;
+        UnusedRecordHead_ = kNullBlock;
+        FreeBlockCount_   = 0;
+
+        if (TotalSize_ != 0)
+        {
+            FBlock Block;
+            Block.Size = TotalSize_;
+            Blocks_.push_back(Block);
+            InsertFreeBlock(0);
+        }
+    }
+
+    std::optional<std::uint64_t> FTlsfAllocator::TryAllocate(std::uint64_t Size, std::uint64_t Alignment)
+    {
+        NpgsAssert(Size != 0, "Allocation size must not be zero.");
+        Size      = std::max<std::uint64_t>(Size, 1);
+        Alignment = std::max<std::uint64_t>(Alignment, 1);
+        NpgsAssert(std::has_single_bit(Alignment), "Alignment must be a power of two.");
+
+        // 按 Size + Alignment - 1 查找，找到的块无论起点在哪都放得下对齐后的分配
+        std::uint32_t BlockIndex = kNullBlock;
+        if (Size <= std::numeric_limits<std::uint64_t>::max() - (Alignment - 1))
+        {
+            BlockIndex = FindSuitableBlock(Size + Alignment - 1);
+        }
+
+        // 空间将满时保守查找可能失败，再检查按原大小找到的桶首和 Size 所在桶的桶首，仍是 O(1)
+        if (BlockIndex == kNullBlock)
+        {
+            auto Fits = [&](std::uint32_t Index) -> bool
+            {
+                if (Index == kNullBlock)
+                {
+                    return false;
+                }
+
+                const FBlock& Block = Blocks_[Index];
+                std::uint64_t AlignedOffset = (Block.Offset + Alignment - 1) & ~(Alignment - 1);
+                return AlignedOffset - Block.Offset <= Block.Size && Size <= Block.Size - (AlignedOffset - Block.Offset);
+            };
+
+            auto [FirstLevel, SecondLevel] = MapInsert(Size);
+            std::uint32_t Candidates[]{ FindSuitableBlock(Size), FreeHeads_[FirstLevel][SecondLevel] };
+            for (std::uint32_t Candidate : Candidates)
+            {
+                if (Fits(Candidate))
+                {
+                    BlockIndex = Candidate;
+                    break;
+                }
+            }
+        }
+
+        if (BlockIndex == kNullBlock)
+        {
+            return std::nullopt;
+        }
+
+        RemoveFreeBlock(BlockIndex);
+
+        std::uint64_t Offset        = Blocks_[BlockIndex].Offset;
+        std::uint64_t AlignedOffset = (Offset + Alignment - 1) & ~(Alignment - 1);
+        if (AlignedOffset != Offset)
+        {
+            std::uint32_t PaddingIndex = BlockIndex;
+            BlockIndex = SplitBlock(PaddingIndex, AlignedOffset - Offset);
+            InsertFreeBlock(PaddingIndex);
+        }
+
+        if (Blocks_[BlockIndex].Size > Size)
+        {
+            InsertFreeBlock(SplitBlock(BlockIndex, Size));
+        }
+
+        Allocations_.emplace(AlignedOffset, BlockIndex);
+        UsedSize_ += Size;
+
+        return AlignedOffset;
+    }
+
+    std::uint64_t FTlsfAllocator::Allocate(std::uint64_t Size, std::uint64_t Alignment)
+    {
+        auto Offset = TryAllocate(Size, Alignment);
+        if (!Offset)
+        {
+            throw std::runtime_error("Heap allocation failed: insufficient memory.");
+        }
+
+        return *Offset;
+    }
+
+    void FTlsfAllocator::Free(std::uint64_t Offset)
+    {
+        auto it = Allocations_.find(Offset);
+        NpgsAssert(it != Allocations_.end(), "Freeing an offset that was not allocated.");
+        if (it == Allocations_.end())
+        {
+            return;
+        }
+
+        std::uint32_t BlockIndex = it->second;
+        Allocations_.erase(it);
+        UsedSize_ -= Blocks_[BlockIndex].Size;
+
+        // 物理相邻的空闲块不会同时存在，两侧各最多合并一次
+        std::uint32_t PrevIndex = Blocks_[BlockIndex].PrevPhysical;
+        if (PrevIndex != kNullBlock && Blocks_[PrevIndex].bFree)
+        {
+            RemoveFreeBlock(PrevIndex);
+            MergeWithNext(PrevIndex);
+            BlockIndex = PrevIndex;
+        }
+
+        std::uint32_t NextIndex = Blocks_[BlockIndex].NextPhysical;
+        if (NextIndex != kNullBlock && Blocks_[NextIndex].bFree)
+        {
+            RemoveFreeBlock(NextIndex);
+            MergeWithNext(BlockIndex);
+        }
+
+        InsertFreeBlock(BlockIndex);
+    }
+
+    std::uint64_t FTlsfAllocator::GetAllocationSize(std::uint64_t Offset) const
+    {
+        auto it = Allocations_.find(Offset);
+        NpgsAssert(it != Allocations_.end(), "Offset was not allocated.");
+        return it != Allocations_.end() ? Blocks_[it->second].Size : 0;
+    }
+
+    FTlsfAllocator::FStatistics FTlsfAllocator::GetStatistics() const
+    {
+        FStatistics Statistics;
+        Statistics.TotalSize       = TotalSize_;
+        Statistics.UsedSize        = UsedSize_;
+        Statistics.FreeSize        = TotalSize_ - UsedSize_;
+        Statistics.AllocationCount = Allocations_.size();
+        Statistics.FreeBlockCount  = FreeBlockCount_;
+
+        // 最大的空闲块只可能在最高的非空桶中，遍历这一个桶即可
+        if (FirstLevelBitmap_ != 0)
+        {
+            std::uint32_t FirstLevel  = 63 - std::countl_zero(FirstLevelBitmap_);
+            std::uint32_t SecondLevel = 31 - std::countl_zero(SecondLevelBitmaps_[FirstLevel]);
+            for (std::uint32_t Index = FreeHeads_[FirstLevel][SecondLevel]; Index != kNullBlock; Index = Blocks_[Index].NextFree)
+            {
+                Statistics.LargestFreeBlock = std::max(Statistics.LargestFreeBlock, Blocks_[Index].Size);
+            }
+        }
+
+        if (Statistics.FreeSize != 0)
+        {
+            Statistics.Fragmentation =
+                1.0f - static_cast<float>(static_cast<double>(Statistics.LargestFreeBlock) / Statistics.FreeSize);
+        }
+
+        return Statistics;
+    }
+
+    FTlsfAllocator::FMapping FTlsfAllocator::MapInsert(std::uint64_t Size)
+    {
+        // 小于 kSecondLevelCount 的大小放在第 0 级，二级按大小逐一分桶
+        if (Size < kSecondLevelCount)
+        {
+            return { 0, static_cast<std::uint32_t>(Size) };
+        }
+
+        std::uint32_t MostSignificantBit = 63 - std::countl_zero(Size);
+        std::uint32_t FirstLevel  = MostSignificantBit - kSecondLevelBits + 1;
+        std::uint32_t SecondLevel = static_cast<std::uint32_t>(Size >> (MostSignificantBit - kSecondLevelBits)) - kSecondLevelCount;
+        return { FirstLevel, SecondLevel };
+    }
+
+    FTlsfAllocator::FMapping FTlsfAllocator::MapSearch(std::uint64_t Size)
+    {
+        // 向上取整到下一个桶的下界，桶内任意一块都不小于 Size
+        if (Size >= kSecondLevelCount)
+        {
+            std::uint32_t MostSignificantBit = 63 - std::countl_zero(Size);
+            std::uint64_t Round = (std::uint64_t(1) << (MostSignificantBit - kSecondLevelBits)) - 1;
+            if (Size > std::numeric_limits<std::uint64_t>::max() - Round)
+            {
+                return { kFirstLevelCount, 0 };
+            }
+
+            Size += Round;
+        }
+
+        return MapInsert(Size);
+    }
+
+    std::uint32_t FTlsfAllocator::FindSuitableBlock(std::uint64_t Size) const
+    {
+        auto [FirstLevel, SecondLevel] = MapSearch(Size);
+        if (FirstLevel >= kFirstLevelCount)
+        {
+            return kNullBlock;
+        }
+
+        std::uint32_t SecondLevelMap = SecondLevelBitmaps_[FirstLevel] & (~0u << SecondLevel);
+        if (SecondLevelMap == 0)
+        {
+            std::uint64_t FirstLevelMap = FirstLevelBitmap_ & (~std::uint64_t(0) << (FirstLevel + 1));
+            if (FirstLevelMap == 0)
+            {
+                return kNullBlock;
+            }
+
+            FirstLevel     = std::countr_zero(FirstLevelMap);
+            SecondLevelMap = SecondLevelBitmaps_[FirstLevel];
+        }
+
+        SecondLevel = std::countr_zero(SecondLevelMap);
+        return FreeHeads_[FirstLevel][SecondLevel];
+    }
+
+    void FTlsfAllocator::InsertFreeBlock(std::uint32_t BlockIndex)
+    {
+        FBlock& Block = Blocks_[BlockIndex];
+        auto [FirstLevel, SecondLevel] = MapInsert(Block.Size);
+
+        std::uint32_t& Head = FreeHeads_[FirstLevel][SecondLevel];
+        Block.PrevFree = kNullBlock;
+        Block.NextFree = Head;
+        Block.bFree    = true;
+        if (Head != kNullBlock)
+        {
+            Blocks_[Head].PrevFree = BlockIndex;
+        }
+
+        Head = BlockIndex;
+        SecondLevelBitmaps_[FirstLevel] |= 1u << SecondLevel;
+        FirstLevelBitmap_               |= std::uint64_t(1) << FirstLevel;
+        ++FreeBlockCount_;
+    }
+
+    void FTlsfAllocator::RemoveFreeBlock(std::uint32_t BlockIndex)
+    {
+        FBlock& Block = Blocks_[BlockIndex];
+        auto [FirstLevel, SecondLevel] = MapInsert(Block.Size);
+
+        if (Block.PrevFree != kNullBlock)
+        {
+            Blocks_[Block.PrevFree].NextFree = Block.NextFree;
+        }
+        else
+        {
+            FreeHeads_[FirstLevel][SecondLevel] = Block.NextFree;
+            if (Block.NextFree == kNullBlock)
+            {
+                SecondLevelBitmaps_[FirstLevel] &= ~(1u << SecondLevel);
+                if (SecondLevelBitmaps_[FirstLevel] == 0)
+                {
+                    FirstLevelBitmap_ &= ~(std::uint64_t(1) << FirstLevel);
+                }
+            }
+        }
+
+        if (Block.NextFree != kNullBlock)
+        {
+            Blocks_[Block.NextFree].PrevFree = Block.PrevFree;
+        }
+
+        Block.PrevFree = kNullBlock;
+        Block.NextFree = kNullBlock;
+        Block.bFree    = false;
+        --FreeBlockCount_;
+    }
+
+    std::uint32_t FTlsfAllocator::SplitBlock(std::uint32_t BlockIndex, std::uint64_t FrontSize)
+    {
+        // 先取记录再取引用，取记录可能使 Blocks_ 扩容
+        std::uint32_t BackIndex = AcquireBlockRecord();
+        FBlock& Front = Blocks_[BlockIndex];
+        FBlock& Back  = Blocks_[BackIndex];
+
+        Back.Offset       = Front.Offset + FrontSize;
+        Back.Size         = Front.Size - FrontSize;
+        Back.PrevPhysical = BlockIndex;
+        Back.NextPhysical = Front.NextPhysical;
+        Back.bFree        = false;
+        if (Front.NextPhysical != kNullBlock)
+        {
+            Blocks_[Front.NextPhysical].PrevPhysical = BackIndex;
+        }
+
+        Front.Size         = FrontSize;
+        Front.NextPhysical = BackIndex;
+
+        return BackIndex;
+    }
+
+    void FTlsfAllocator::MergeWithNext(std::uint32_t BlockIndex)
+    {
+        FBlock& Block = Blocks_[BlockIndex];
+        std::uint32_t NextIndex = Block.NextPhysical;
+        const FBlock& Next = Blocks_[NextIndex];
+
+        Block.Size        += Next.Size;
+        Block.NextPhysical = Next.NextPhysical;
+        if (Next.NextPhysical != kNullBlock)
+        {
+            Blocks_[Next.NextPhysical].PrevPhysical = BlockIndex;
+        }
+
+        ReleaseBlockRecord(NextIndex);
+    }
+
+    std::uint32_t FTlsfAllocator::AcquireBlockRecord()
+    {
+        if (UnusedRecordHead_ == kNullBlock)
+        {
+            Blocks_.emplace_back();
+            return static_cast<std::uint32_t>(Blocks_.size() - 1);
+        }
+
+        std::uint32_t BlockIndex = UnusedRecordHead_;
+        UnusedRecordHead_ = Blocks_[BlockIndex].NextFree;
+        Blocks_[BlockIndex] = FBlock{};
+        return BlockIndex;
+    }
+
+    void FTlsfAllocator::ReleaseBlockRecord(std::uint32_t BlockIndex)
+    {
+        FBlock& Block = Blocks_[BlockIndex];
+        Block.PrevPhysical = kNullBlock;
+        Block.NextPhysical = kNullBlock;
+        Block.PrevFree     = kNullBlock;
+        Block.NextFree     = UnusedRecordHead_;
+        Block.bFree        = false;
+        UnusedRecordHead_  = BlockIndex;
+    }
+} // namespace Npgs
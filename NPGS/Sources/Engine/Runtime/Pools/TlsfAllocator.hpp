@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <ankerl/unordered_dense.h>
+
+namespace Npgs
+{
+    // 两级分离适配（TLSF）子分配器，只管理 [0, TotalSize) 区间内的偏移，不触碰实际内存，
+    // 适用于描述符堆、数据缓冲区等 GPU 内存的再分配
+    // 一级按大小的最高位分桶，二级把每个一级桶再均分为 kSecondLevelCount 份，
+    // 分配与释放都只做位图查找和链表操作，时间复杂度为 O(1)，释放时与物理相邻的空闲块合并
+    // 块记录存放在可复用的数组中，稳态下不分配堆内存。不是线程安全的
+    class FTlsfAllocator
+    {
+    public:
+        struct FStatistics
+        {
+            std::uint64_t TotalSize{};        // 管理的区间大小
+            std::uint64_t UsedSize{};         // 已分配的大小，对齐填充留在空闲块中，不计入
+            std::uint64_t FreeSize{};         // 空闲大小
+            std::uint64_t LargestFreeBlock{}; // 最大的空闲块
+            std::size_t   AllocationCount{};  // 存活的分配数
+            std::size_t   FreeBlockCount{};   // 空闲块数
+            float         Fragmentation{};    // 1 - 最大空闲块 / 空闲大小，空闲空间连成一块时为 0
+        };
+
+    public:
+        explicit FTlsfAllocator(std::uint64_t TotalSize = 0);
+
+        void Initialize(std::uint64_t TotalSize);
+        void Reset();
+
+        // Alignment 必须是 2 的幂，0 视为 1。空间不足时返回 std::nullopt
+        std::optional<std::uint64_t> TryAllocate(std::uint64_t Size, std::uint64_t Alignment = 1);
+        // 空间不足时抛出 std::runtime_error
+        std::uint64_t Allocate(std::uint64_t Size, std::uint64_t Alignment = 1);
+        // Offset 必须是 Allocate 返回的偏移
+        void Free(std::uint64_t Offset);
+
+        std::uint64_t GetAllocationSize(std::uint64_t Offset) const;
+        std::uint64_t GetTotalSize() const;
+        std::uint64_t GetUsedSize() const;
+        FStatistics GetStatistics() const;
+
+    private:
+        static constexpr std::uint32_t kSecondLevelBits  = 5;
+        static constexpr std::uint32_t kSecondLevelCount = 1u << kSecondLevelBits;
+        static constexpr std::uint32_t kFirstLevelCount  = 64 - kSecondLevelBits + 1;
+        static constexpr std::uint32_t kNullBlock        = std::numeric_limits<std::uint32_t>::max();
+
+        struct FBlock
+        {
+            std::uint64_t Offset{};
+            std::uint64_t Size{};
+            std::uint32_t PrevPhysical{ kNullBlock };
+            std::uint32_t NextPhysical{ kNullBlock };
+            std::uint32_t PrevFree{ kNullBlock };
+            std::uint32_t NextFree{ kNullBlock }; // 块记录未使用时串联空闲记录
+            bool          bFree{ false };
+        };
+
+        struct FMapping
+        {
+            std::uint32_t FirstLevel;
+            std::uint32_t SecondLevel;
+        };
+
+    private:
+        static FMapping MapInsert(std::uint64_t Size);
+        static FMapping MapSearch(std::uint64_t Size);
+
+        std::uint32_t FindSuitableBlock(std::uint64_t Size) const;
+        void InsertFreeBlock(std::uint32_t BlockIndex);
+        void RemoveFreeBlock(std::uint32_t BlockIndex);
+        std::uint32_t SplitBlock(std::uint32_t BlockIndex, std::uint64_t FrontSize);
+        void MergeWithNext(std::uint32_t BlockIndex);
+        std::uint32_t AcquireBlockRecord();
+        void ReleaseBlockRecord(std::uint32_t BlockIndex);
+
+    private:
+        std::vector<FBlock>                                            Blocks_;
+        std::array<std::array<std::uint32_t, kSecondLevelCount>, kFirstLevelCount> FreeHeads_{};
+        std::array<std::uint32_t, kFirstLevelCount>                    SecondLevelBitmaps_{};
+        std::uint64_t                                                  FirstLevelBitmap_{};
+        ankerl::unordered_dense::map<std::uint64_t, std::uint32_t>     Allocations_; // [Offset, BlockIndex]
+        std::uint64_t                                                  TotalSize_{};
+        std::uint64_t                                                  UsedSize_{};
+        std::uint32_t                                                  UnusedRecordHead_{ kNullBlock };
+        std::size_t                                                    FreeBlockCount_{};
+    };
+} // namespace Npgs
+
+#include "TlsfAllocator.inl"
@@ -0,0 +1,16 @@
+#include "TlsfAllocator.hpp"
+
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE std::uint64_t FTlsfAllocator::GetTotalSize() const
+    {
+        return TotalSize_;
+    }
+
+    NPGS_INLINE std::uint64_t FTlsfAllocator::GetUsedSize() const
+    {
+        return UsedSize_;
+    }
+} // namespace Npgs
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Npgs
+{
+    // Chase-Lev 无锁工作窃取双端队列（Lê et al. 2013 的 C11 内存模型版本）
+    // 只有所有者线程可以调用 Push 和 TryPop（LIFO 端），其他线程只能调用 TrySteal（FIFO 端）
+    // 元素类型必须可平凡复制，通常存储任务指针
+    template <typename ItemType>
+    class TWorkStealingDeque
+    {
+        static_assert(std::is_trivially_copyable_v<ItemType>, "ItemType must be trivially copyable.");
+
+    public:
+        explicit TWorkStealingDeque(std::int64_t InitialCapacity = 1024)
+        {
+            std::int64_t Capacity = 1;
+            while (Capacity < InitialCapacity)
+            {
+                Capacity <<= 1;
+            }
+
+            auto Buffer = std::make_unique<FRingBuffer>(Capacity);
+            Buffer_.store(Buffer.get(), std::memory_order::relaxed);
+            Buffers_.push_back(std::move(Buffer));
+        }
+
+        TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+        TWorkStealingDeque(TWorkStealingDeque&&)      = delete;
+        ~TWorkStealingDeque()                         = default;
+
+        TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+        TWorkStealingDeque& operator=(TWorkStealingDeque&&)      = delete;
+
+        void Push(ItemType Item)
+        {
+            std::int64_t Bottom = Bottom_.load(std::memory_order::relaxed);
+            std::int64_t Top    = Top_.load(std::memory_order::acquire);
+            FRingBuffer* Buffer = Buffer_.load(std::memory_order::relaxed);
+
+            if (Bottom - Top > Buffer->Capacity - 1)
+            {
+                Buffer = Grow(Buffer, Bottom, Top);
+            }
+
+            Buffer->Put(Bottom, Item);
+            Bottom_.store(Bottom + 1, std::memory_order::release);
+        }
+
+        bool TryPop(ItemType& Item)
+        {
+            std::int64_t Bottom = Bottom_.load(std::memory_order::relaxed) - 1;
+            FRingBuffer* Buffer = Buffer_.load(std::memory_order::relaxed);
+            Bottom_.store(Bottom, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            std::int64_t Top = Top_.load(std::memory_order::relaxed);
+
+            if (Top > Bottom)
+            {
+                Bottom_.store(Bottom + 1, std::memory_order::relaxed);
+                return false;
+            }
+
+            Item = Buffer->Get(Bottom);
+            if (Top == Bottom)
+            {
+                // 只剩最后一个元素，与窃取者竞争
+                bool bWon = Top_.compare_exchange_strong(Top, Top + 1, std::memory_order::seq_cst, std::memory_order::relaxed);
+                Bottom_.store(Bottom + 1, std::memory_order::relaxed);
+                return bWon;
+            }
+
+            return true;
+        }
+
+        bool TrySteal(ItemType& Item)
+        {
+            std::int64_t Top = Top_.load(std::memory_order::acquire);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            std::int64_t Bottom = Bottom_.load(std::memory_order::acquire);
+
+            if (Top >= Bottom)
+            {
+                return false;
+            }
+
+            FRingBuffer* Buffer = Buffer_.load(std::memory_order::acquire);
+            ItemType Stolen = Buffer->Get(Top);
+            if (!Top_.compare_exchange_strong(Top, Top + 1, std::memory_order::seq_cst, std::memory_order::relaxed))
+            {
+                return false;
+            }
+
+            Item = Stolen;
+            return true;
+        }
+
+        std::size_t SizeApprox() const
+        {
+            std::int64_t Bottom = Bottom_.load(std::memory_order::relaxed);
+            std::int64_t Top    = Top_.load(std::memory_order::relaxed);
+            return Bottom > Top ? static_cast<std::size_t>(Bottom - Top) : 0;
+        }
+
+        bool EmptyApprox() const
+        {
+            return SizeApprox() == 0;
+        }
+
+    private:
+        struct FRingBuffer
+        {
+            std::int64_t                             Capacity;
+            std::int64_t                             Mask;
+            std::unique_ptr<std::atomic<ItemType>[]> Items;
+
+            explicit FRingBuffer(std::int64_t Capacity)
+                : Capacity(Capacity)
+                , Mask(Capacity - 1)
+                , Items(std::make_unique<std::atomic<ItemType>[]>(Capacity))
+            {
+            }
+
+            void Put(std::int64_t Index, ItemType Item)
+            {
+                Items[Index & Mask].store(Item, std::memory_order::relaxed);
+            }
+
+            ItemType Get(std::int64_t Index) const
+            {
+                return Items[Index & Mask].load(std::memory_order::relaxed);
+            }
+        };
+
+    private:
+        FRingBuffer* Grow(FRingBuffer* Buffer, std::int64_t Bottom, std::int64_t Top)
+        {
+            auto NewBuffer = std::make_unique<FRingBuffer>(Buffer->Capacity * 2);
+            for (std::int64_t i = Top; i != Bottom; ++i)
+            {
+                NewBuffer->Put(i, Buffer->Get(i));
+            }
+
+            // 窃取者可能仍在读取旧缓冲区，旧缓冲区保留到队列析构时再释放
+            FRingBuffer* Result = NewBuffer.get();
+            Buffers_.push_back(std::move(NewBuffer));
+            Buffer_.store(Result, std::memory_order::release);
+            return Result;
+        }
+
+    private:
+        alignas(64) std::atomic<std::int64_t> Top_{};
+        alignas(64) std::atomic<std::int64_t> Bottom_{};
+        alignas(64) std::atomic<FRingBuffer*> Buffer_{ nullptr };
+        std::vector<std::unique_ptr<FRingBuffer>> Buffers_; // 只由所有者线程修改
+    };
+} // namespace Npgs
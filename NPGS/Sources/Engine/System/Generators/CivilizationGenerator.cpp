@@ -185,7 +185,7 @@ namespace Npgs
             OrganismUsedPower *= CommonRandom;
         }
 
-        CivilizationData.SetOrganismBiomass(boost::multiprecision::uint128_t(OrganismBiomass));
+        CivilizationData.SetOrganismBiomass(Math::FUint128(OrganismBiomass));
         CivilizationData.SetOrganismUsedPower(static_cast<float>(OrganismUsedPower));
     }
 
@@ -265,7 +265,7 @@ namespace Npgs
         float Random2 = GenerateRandom2();
 
         // 文明生物的总生物量（CitizenBiomass）
-        boost::multiprecision::uint128_t CitizenBiomass;
+        Math::FUint128 CitizenBiomass;
         if (CivilizationLevel >= Intelli::FStandard::kDigitalAge_ && CivilizationLevel <= Intelli::FStandard::kEarlyAsiAge_)
         {
             double Base        = Random1 * 4e11;
@@ -273,7 +273,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kAtomicAge_ && CivilizationLevel < Intelli::FStandard::kDigitalAge_)
         {
@@ -282,7 +282,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kElectricAge_ && CivilizationLevel < Intelli::FStandard::kAtomicAge_)
         {
@@ -291,7 +291,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kSteamAge_ && CivilizationLevel < Intelli::FStandard::kElectricAge_)
         {
@@ -300,7 +300,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kEarlyIndustrielle_ && CivilizationLevel < Intelli::FStandard::kSteamAge_)
         {
@@ -309,7 +309,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kUrgesellschaft_ && CivilizationLevel < Intelli::FStandard::kEarlyIndustrielle_)
         {
@@ -318,7 +318,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kInitialGeneralIntelligence_ && CivilizationLevel < Intelli::FStandard::kUrgesellschaft_)
         {
@@ -327,7 +327,7 @@ namespace Npgs
             double Result      = Base * Coefficient;
             float  Random      = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result            *= Random;
-            CitizenBiomass     = boost::multiprecision::uint128_t(Result);
+            CitizenBiomass     = Math::FUint128(Result);
         }
         else
         {
@@ -336,7 +336,7 @@ namespace Npgs
         CivilizationData.SetCitizenBiomass(CitizenBiomass);
 
         // 文明造物总质量（AtrificalStructureMass）
-        boost::multiprecision::uint128_t AtrificalStructureMass;
+        Math::FUint128 AtrificalStructureMass;
         if (CivilizationLevel >= Intelli::FStandard::kDigitalAge_ && CivilizationLevel <= Intelli::FStandard::kEarlyAsiAge_)
         {
             double Base            = Random1 * 1e15;
@@ -344,7 +344,7 @@ namespace Npgs
             double Result          = Base * Coefficient;
             float  Random          = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result                *= Random;
-            AtrificalStructureMass = boost::multiprecision::uint128_t(Result);
+            AtrificalStructureMass = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kAtomicAge_ && CivilizationLevel < Intelli::FStandard::kDigitalAge_)
         {
@@ -353,7 +353,7 @@ namespace Npgs
             double Result          = Base * Coefficient;
             float  Random          = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result                *= Random;
-            AtrificalStructureMass = boost::multiprecision::uint128_t(Result);
+            AtrificalStructureMass = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kElectricAge_ && CivilizationLevel < Intelli::FStandard::kAtomicAge_)
         {
@@ -362,7 +362,7 @@ namespace Npgs
             double Result          = Base * Coefficient;
             float  Random          = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result                *= Random;
-            AtrificalStructureMass = boost::multiprecision::uint128_t(Result);
+            AtrificalStructureMass = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kSteamAge_ && CivilizationLevel < Intelli::FStandard::kElectricAge_)
         {
@@ -371,7 +371,7 @@ namespace Npgs
             double Result          = Base * Coefficient;
             float  Random          = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result                *= Random;
-            AtrificalStructureMass = boost::multiprecision::uint128_t(Result);
+            AtrificalStructureMass = Math::FUint128(Result);
         }
         else if (CivilizationLevel >= Intelli::FStandard::kEarlyIndustrielle_ && CivilizationLevel < Intelli::FStandard::kSteamAge_)
         {
@@ -380,7 +380,7 @@ namespace Npgs
             double Result          = Base * Coefficient;
             float  Random          = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Result                *= Random;
-            AtrificalStructureMass = boost::multiprecision::uint128_t(Result);
+            AtrificalStructureMass = Math::FUint128(Result);
         }
         else
         {
@@ -521,7 +521,7 @@ namespace Npgs
         float AverageWeight = Random1 * Random2 * 1e4f;
 
         // 通用智能个体的数量（GeneralIntelligenceCount）
-        std::uint64_t TotalCount = static_cast<std::uint64_t>(CitizenBiomass.convert_to<float>() / AverageWeight);
+        std::uint64_t TotalCount = static_cast<std::uint64_t>(CitizenBiomass.ConvertTo<float>() / AverageWeight);
         CivilizationData.SetGeneralintelligenceCount(TotalCount);
 
         // 通用智能个体平均突触数量（GeneralIntelligenceSynapseCount）
@@ -542,7 +542,7 @@ namespace Npgs
         CivilizationData.SetTeamworkCoefficient(TeamworkCoefficient);
 
         // 可用含能核素（UseableEnergeticNuclide）
-        boost::multiprecision::uint128_t UseableEnergeticNuclide;
+        Math::FUint128 UseableEnergeticNuclide;
         if (CivilizationLevel >= Intelli::FStandard::kAtomicAge_ && CivilizationLevel <= Intelli::FStandard::kEarlyAsiAge_)
         {
             double StarAge = Star->GetAge();
@@ -557,7 +557,7 @@ namespace Npgs
             float Random = 0.9f + 0.2f * CommonGenerator_(RandomEngine_);
             Base *= Random;
 
-            UseableEnergeticNuclide = static_cast<boost::multiprecision::uint128_t>(Base);
+            UseableEnergeticNuclide = static_cast<Math::FUint128>(Base);
             CivilizationData.SetUseableEnergeticNuclide(UseableEnergeticNuclide);
         }
 
@@ -579,7 +579,7 @@ namespace Npgs
         {
             OrbitAssetsMass = std::sqrt(GenerateRandom1()) * LaunchCapability * (CivilizationLevel - 6) / TeamworkCoefficient;
         }
-        CivilizationData.SetOrbitAssetsMass(boost::multiprecision::uint128_t(OrbitAssetsMass));
+        CivilizationData.SetOrbitAssetsMass(Math::FUint128(OrbitAssetsMass));
 
 #ifdef DEBUG_OUTPUT
         std::println("");
@@ -6,19 +6,21 @@
 #include <cstdint>
 #include <algorithm>
 #include <limits>
+#include <memory_resource>
 #include <numeric>
 #include <print>
 #include <ranges>
 #include <utility>
 
-#include <boost/multiprecision/cpp_int.hpp>
 #include <glm/glm.hpp>
 
 #include "Engine/Core/Base/Assert.hpp"
 #include "Engine/Core/Base/Base.hpp"
+#include "Engine/Core/Math/Uint128.hpp"
 #include "Engine/Core/Math/NumericConstants.hpp"
 #include "Engine/Core/Types/Properties/StellarClass.hpp"
 #include "Engine/Core/Utils/Utils.hpp"
+#include "Engine/Runtime/Pools/LinearArena.hpp"
 
 #define DEBUG_OUTPUT // Temp
 
@@ -49,7 +51,7 @@ namespace Npgs
             return Luminosity;
         }
 
-        std::unique_ptr<Astro::AAsteroidCluster> PlanetToAsteroidCluster(const Astro::APlanet* Planet)
+        Astro::AAsteroidCluster PlanetToAsteroidCluster(const Astro::APlanet* Planet)
         {
             Astro::AAsteroidCluster AsteroidCluster;
 
@@ -67,7 +69,7 @@ namespace Npgs
             AsteroidCluster.SetMassVolatiles(Planet->GetCoreMassVolatiles());
             AsteroidCluster.SetMassEnergeticNuclide(Planet->GetCoreMassEnergeticNuclide());
 
-            return std::make_unique<Astro::AAsteroidCluster>(AsteroidCluster);
+            return AsteroidCluster;
         }
     }
 
@@ -200,13 +202,13 @@ namespace Npgs
         if (System.StarsData().size() == 2)
         {
             GenerateBinaryOrbit(System);
-            Astro::AStar* Star1 = System.StarsData()[0].get();
-            Astro::AStar* Star2 = System.StarsData()[1].get();
+            Astro::AStar* Star1 = &System.StarsData()[0];
+            Astro::AStar* Star2 = &System.StarsData()[1];
 
             for (auto& Star : System.StarsData())
             {
-                Astro::AStar* Current  = Star.get();
-                Astro::AStar* TheOther = Star.get() == Star1 ? Star2 : Star1;
+                Astro::AStar* Current  = &Star;
+                Astro::AStar* TheOther = &Star == Star1 ? Star2 : Star1;
 
                 if (Current->GetMass() > 12 * kSolarMass)
                 {
@@ -250,22 +252,20 @@ namespace Npgs
         }
         else
         {
-            Astro::AStar* Star = System.StarsData().front().get();
+            Astro::AStar* Star = &System.StarsData().front();
 
-            auto ZeroOrbit = std::make_unique<Astro::FOrbit>();
-            Astro::FOrbit::FOrbitalDetails MainStar(Star, Astro::FOrbit::EObjectType::kStar, ZeroOrbit.get());
-            ZeroOrbit->ObjectsData().push_back(std::move(MainStar));
-            ZeroOrbit->SetParent(System.GetBaryCenter(), Astro::FOrbit::EObjectType::kBaryCenter);
-            System.OrbitsData().push_back(std::move(ZeroOrbit));
+            Astro::FOrbit ZeroOrbit;
+            ZeroOrbit.SetParent(Astro::FOrbit::EObjectType::kBaryCenter, 0);
+            System.AddOrbitalObject(System.AddOrbit(ZeroOrbit), Astro::FOrbit::EObjectType::kStar, 0);
 
             float NearStarSemiMajorAxis = static_cast<float>(
                 std::sqrt(Star->GetLuminosity() / (4 * Math::kPi * kStefanBoltzmann * std::pow(CoilTemperatureLimit_, 4))));
-            auto NearStarOrbit = std::make_unique<Astro::FOrbit>();
+            Astro::FOrbit NearStarOrbit;
 
-            NearStarOrbit->SetParent(System.GetBaryCenter(), Astro::FOrbit::EObjectType::kBaryCenter);
-            NearStarOrbit->SetNormal(System.GetBaryNormal());
-            NearStarOrbit->SetSemiMajorAxis(NearStarSemiMajorAxis);
-            System.OrbitsData().push_back(std::move(NearStarOrbit));
+            NearStarOrbit.SetParent(Astro::FOrbit::EObjectType::kBaryCenter, 0);
+            NearStarOrbit.SetNormal(System.GetBaryNormal());
+            NearStarOrbit.SetSemiMajorAxis(NearStarSemiMajorAxis);
+            System.AddOrbit(NearStarOrbit);
 
 #ifdef DEBUG_OUTPUT
             std::println("");
@@ -292,27 +292,25 @@ namespace Npgs
 
         for (std::size_t i = 0; i != System.StarsData().size(); ++i)
         {
-            if (System.StarsData()[i]->HasPlanets())
+            if (System.StarsData()[i].HasPlanets())
             {
-                GeneratePlanets(i, System.OrbitsData()[i]->ObjectsData().front(), System);
+                GeneratePlanets(i, System.OrbitsData()[i].GetFirstObject(), System);
             }
         }
     }
 
     void FOrbitalGenerator::GenerateBinaryOrbit(Astro::FOrbitalSystem& System)
     {
-        auto* SystemBaryCenter = System.GetBaryCenter();
-
         std::array<Astro::FOrbit, 2> OrbitData;
 
         for (int i = 0; i != 2; ++i)
         {
-            OrbitData[i].SetParent(SystemBaryCenter, Astro::FOrbit::EObjectType::kBaryCenter);
+            OrbitData[i].SetParent(Astro::FOrbit::EObjectType::kBaryCenter, 0);
             GenerateOrbitElements(OrbitData[i]);
         }
 
-        float MassSol1 = static_cast<float>(System.StarsData().front()->GetMass() / kSolarMass);
-        float MassSol2 = static_cast<float>(System.StarsData().back()->GetMass()  / kSolarMass);
+        float MassSol1 = static_cast<float>(System.StarsData().front().GetMass() / kSolarMass);
+        float MassSol2 = static_cast<float>(System.StarsData().back().GetMass()  / kSolarMass);
 
         float LogPeriodDays       = 0.0f;
         float CommonCoefficient   = 365 * std::pow(MassSol1 + MassSol2, 0.3f);
@@ -385,8 +383,8 @@ namespace Npgs
             }
         }
 
-        System.StarsData().front()->SetNormal(StarNormals[0]);
-        System.StarsData().back()->SetNormal(StarNormals[1]);
+        System.StarsData().front().SetNormal(StarNormals[0]);
+        System.StarsData().back().SetNormal(StarNormals[1]);
 
         Random = CommonGenerator_(RandomEngine_) * 2.0f * Math::kPi;
         float ArgumentOfPeriapsis1 = Random;
@@ -415,39 +413,25 @@ namespace Npgs
             InitialTrueAnomaly2 = InitialTrueAnomaly1 + Math::kPi;
         }
 
-        auto Orbit1 = std::make_unique<Astro::FOrbit>(OrbitData[0]);
-        auto Orbit2 = std::make_unique<Astro::FOrbit>(OrbitData[1]);
-
-        Astro::FOrbit::FOrbitalDetails Star1(
-            System.StarsData().front().get(), Astro::FOrbit::EObjectType::kStar, Orbit1.get(), InitialTrueAnomaly1);
-        Astro::FOrbit::FOrbitalDetails Star2(
-            System.StarsData().back().get(),  Astro::FOrbit::EObjectType::kStar, Orbit2.get(), InitialTrueAnomaly2);
-
-        Orbit1->ObjectsData().push_back(std::move(Star1));
-        Orbit2->ObjectsData().push_back(std::move(Star2));
-
-        System.OrbitsData().push_back(std::move(Orbit1));
-        System.OrbitsData().push_back(std::move(Orbit2));
+        System.AddOrbitalObject(System.AddOrbit(OrbitData[0]), Astro::FOrbit::EObjectType::kStar, 0, InitialTrueAnomaly1);
+        System.AddOrbitalObject(System.AddOrbit(OrbitData[1]), Astro::FOrbit::EObjectType::kStar, 1, InitialTrueAnomaly2);
 
         std::array<Astro::FOrbit, 2> NearStarOrbits;
 
         for (std::size_t i = 0; i != 2; ++i)
         {
-            Astro::AStar* Current  = System.StarsData()[i].get();
-            Astro::AStar* TheOther = System.StarsData()[1 - i].get();
+            Astro::AStar* Current  = &System.StarsData()[i];
+            Astro::AStar* TheOther = &System.StarsData()[1 - i];
 
             float NearStarSemiMajorAxis = static_cast<float>(
                 std::sqrt(Current->GetLuminosity() / (4 * Math::kPi * ((kStefanBoltzmann * std::pow(CoilTemperatureLimit_, 4)) -
                                                                        TheOther->GetLuminosity() / (4 * Math::kPi * std::pow(BinarySemiMajorAxis, 2))))));
 
-            std::unique_ptr<Astro::FOrbit> NearStarOrbit = std::make_unique<Astro::FOrbit>();
-            NearStarOrbit->SetParent(Current, Astro::FOrbit::EObjectType::kStar);
-            NearStarOrbit->SetNormal(Current->GetNormal());
-            NearStarOrbit->SetSemiMajorAxis(NearStarSemiMajorAxis);
-
-            NearStarOrbits[i] = *NearStarOrbit;
+            NearStarOrbits[i].SetParent(Astro::FOrbit::EObjectType::kStar, static_cast<std::uint32_t>(i));
+            NearStarOrbits[i].SetNormal(Current->GetNormal());
+            NearStarOrbits[i].SetSemiMajorAxis(NearStarSemiMajorAxis);
 
-            System.OrbitsData().push_back(std::move(NearStarOrbit));
+            System.AddOrbit(NearStarOrbits[i]);
         }
 
 #ifdef DEBUG_OUTPUT
@@ -468,10 +452,10 @@ namespace Npgs
 #endif // DEBUG_OUTPUT
     }
 
-    void FOrbitalGenerator::GeneratePlanets(std::size_t StarIndex, Astro::FOrbit::FOrbitalDetails& ParentStar, Astro::FOrbitalSystem& System)
+    void FOrbitalGenerator::GeneratePlanets(std::size_t StarIndex, std::uint32_t ParentStar, Astro::FOrbitalSystem& System)
     {
         // 变量名未标注单位均为国际单位制
-        Astro::AStar* Star = System.StarsData()[StarIndex].get();
+        Astro::AStar* Star = &System.StarsData()[StarIndex];
         if (Star->GetFeH() < -2.0f)
         {
             return;
@@ -480,7 +464,7 @@ namespace Npgs
         float BinarySemiMajorAxis = 0.0f;
         if (System.StarsData().size() > 1)
         {
-            BinarySemiMajorAxis = System.OrbitsData()[0]->GetSemiMajorAxis() + System.OrbitsData()[1]->GetSemiMajorAxis();
+            BinarySemiMajorAxis = System.OrbitsData()[0].GetSemiMajorAxis() + System.OrbitsData()[1].GetSemiMajorAxis();
         }
 
         // 生成原行星盘数据
@@ -498,7 +482,6 @@ namespace Npgs
         std::size_t PlanetCount = GeneratePlanetCount(Star);
 
         std::vector<std::unique_ptr<Astro::APlanet>> Planets;
-        std::vector<std::unique_ptr<Astro::AAsteroidCluster>> AsteroidClusters;
 
         Planets.reserve(PlanetCount);
         for (std::size_t i = 0; i < PlanetCount; ++i)
@@ -506,11 +489,14 @@ namespace Npgs
             Planets.push_back(std::make_unique<Astro::APlanet>());
         }
 
+        // 核心质量等中间数组只在本函数内使用，从线程 arena 分配，函数返回时整体回收
+        FLinearArenaScope ArenaScope;
+
         // 初始化核心质量
-        std::vector<float> CoreMassesSol = GenerateCoreMassesSol(PlanetaryDisk, PlanetCount);
+        std::pmr::vector<float> CoreMassesSol = GenerateCoreMassesSol(PlanetaryDisk, PlanetCount, ArenaScope.GetArena());
 
         // 初始化轨道
-        std::vector<std::unique_ptr<Astro::FOrbit>> Orbits = GenerateOrbits(Star, CoreMassesSol, PlanetaryDisk, PlanetCount);
+        std::vector<Astro::FOrbit> Orbits = GenerateOrbits(StarIndex, CoreMassesSol, PlanetaryDisk, PlanetCount);
 
         // 计算原行星盘年龄
         float DiskAge = CalculatePlanetaryDiskAgeAndDetermineProtoplanetTypes(Star, Orbits, PlanetCount, CoreMassesSol, Planets);
@@ -521,8 +507,35 @@ namespace Npgs
             EraseUnstablePlanets(System, StarIndex, BinarySemiMajorAxis, PlanetCount, CoreMassesSol, Orbits, Planets);
         }
 
-        std::vector<float> NewCoreMassesSol(PlanetCount); // 吸积核心质量，单位太阳
-        float MigratedOriginSemiMajorAxisAu = 0.0f;       // 原有的半长轴，用于计算内迁行星
+        std::pmr::vector<float> NewCoreMassesSol(PlanetCount, ArenaScope.GetArena()); // 吸积核心质量，单位太阳
+        float MigratedOriginSemiMajorAxisAu = 0.0f; // 原有的半长轴，用于计算内迁行星
+
+        // 行星确定后连同轨道一起加入系统，卫星、环和特洛伊带再直接挂到系统中的行星上
+        std::uint32_t FirstOrbit = static_cast<std::uint32_t>(System.OrbitsData().size());
+        std::vector<std::uint32_t> PlanetOrbits; // 各行星所在轨道的序号
+        PlanetOrbits.reserve(PlanetCount);
+
+        // 小行星带类型的行星在加入时转换为小行星带，此时返回无效序号
+        auto CommitPlanet = [&](std::size_t Index) -> std::uint32_t
+        {
+            std::uint32_t OrbitIndex = System.AddOrbit(Orbits[Index]);
+            System.AddDirectOrbit(ParentStar, OrbitIndex);
+            PlanetOrbits.push_back(OrbitIndex);
+
+            auto PlanetType = Planets[Index]->GetPlanetType();
+            if (PlanetType == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
+                PlanetType == Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
+            {
+                std::uint32_t ClusterIndex = System.AddAsteroidCluster(PlanetToAsteroidCluster(Planets[Index].get()));
+                System.AddOrbitalObject(OrbitIndex, Astro::FOrbit::EObjectType::kAsteroidCluster, ClusterIndex);
+                return Astro::FOrbit::kInvalidIndex;
+            }
+
+            std::uint32_t PlanetIndex = System.AddPlanet(std::move(*Planets[Index]));
+            return System.AddOrbitalObject(OrbitIndex, Astro::FOrbit::EObjectType::kPlanet, PlanetIndex);
+        };
+
+        Astro::FOrbit::FOrbitalObject ParentStarObject(Astro::FOrbit::EObjectType::kStar, static_cast<std::uint32_t>(StarIndex));
 
         if (StellarType != Astro::EStellarType::kNeutronStar && StellarType != Astro::EStellarType::kBlackHole)
         {
@@ -540,7 +553,7 @@ namespace Npgs
             for (std::size_t i = 0; i < PlanetCount; ++i)
             {
                 std::println("Before migration: planet {} semi-major axis: {} AU, initial core mass: {} earth, new core mass: {} earth, core radius: {} earth, type: {}",
-                             i + 1, Orbits[i]->GetSemiMajorAxis() / kAuToMeter, CoreMassesSol[i] * kSolarMassToEarth, NewCoreMassesSol[i] * kSolarMassToEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
+                             i + 1, Orbits[i].GetSemiMajorAxis() / kAuToMeter, CoreMassesSol[i] * kSolarMassToEarth, NewCoreMassesSol[i] * kSolarMassToEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
             }
 
             std::println("");
@@ -562,7 +575,7 @@ namespace Npgs
                         if (ScatteringProbability_(RandomEngine_))
                         {
                             float Random = 4.0f + CommonGenerator_(RandomEngine_) * 16.0f; // 4.0 Rsun 高于洛希极限
-                            Orbits[i]->SetSemiMajorAxis(Random * kSolarRadius);
+                            Orbits[i].SetSemiMajorAxis(Random * kSolarRadius);
                             break;
                         }
                     }
@@ -573,7 +586,7 @@ namespace Npgs
             for (std::size_t i = 0; i < PlanetCount; ++i)
             {
                 std::println("Final orbits: planet {} semi-major axis: {} AU, initial core mass: {} earth, new core mass: {} earth, core radius: {} earth, type: {}",
-                             i + 1, Orbits[i]->GetSemiMajorAxis() / kAuToMeter, CoreMassesSol[i] * kSolarMassToEarth, NewCoreMassesSol[i] * kSolarMassToEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
+                             i + 1, Orbits[i].GetSemiMajorAxis() / kAuToMeter, CoreMassesSol[i] * kSolarMassToEarth, NewCoreMassesSol[i] * kSolarMassToEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
             }
 
             std::println("");
@@ -591,7 +604,7 @@ namespace Npgs
                     kSolarMass * NewCoreMassesSol[Index],
                     Planets[Index]->IsMigrated()
                     ? MigratedOriginSemiMajorAxisAu
-                    : Orbits[Index]->GetSemiMajorAxis() / kAuToMeter,
+                    : Orbits[Index].GetSemiMajorAxis() / kAuToMeter,
                     PlanetaryDisk, Star, Planets[Index].get());
             };
 
@@ -626,16 +639,16 @@ namespace Npgs
 
                 if (System.StarsData().size() > 1)
                 {
-                    const Astro::AStar* Current  = System.StarsData()[StarIndex].get();
-                    const Astro::AStar* TheOther = System.StarsData()[1 - StarIndex].get();
+                    const Astro::AStar* Current  = &System.StarsData()[StarIndex];
+                    const Astro::AStar* TheOther = &System.StarsData()[1 - StarIndex];
                     PoyntingVector =
-                        static_cast<float>(Current->GetLuminosity())  / (4 * Math::kPi * std::pow(Orbits[i]->GetSemiMajorAxis(), 2.0f)) +
+                        static_cast<float>(Current->GetLuminosity())  / (4 * Math::kPi * std::pow(Orbits[i].GetSemiMajorAxis(), 2.0f)) +
                         static_cast<float>(TheOther->GetLuminosity()) / (4 * Math::kPi * std::pow(BinarySemiMajorAxis, 2.0f));
                 }
                 else
                 {
                     PoyntingVector =
-                        static_cast<float>(Star->GetLuminosity()) / (4 * Math::kPi * std::pow(Orbits[i]->GetSemiMajorAxis(), 2.0f));
+                        static_cast<float>(Star->GetLuminosity()) / (4 * Math::kPi * std::pow(Orbits[i].GetSemiMajorAxis(), 2.0f));
                 }
 
 #ifdef DEBUG_OUTPUT
@@ -668,19 +681,18 @@ namespace Npgs
                 }
 
                 if (PlanetType == Astro::APlanet::EPlanetType::kOceanic &&
-                    HabitableZoneAu.second <= Orbits[i]->GetSemiMajorAxis() / kAuToMeter)
+                    HabitableZoneAu.second <= Orbits[i].GetSemiMajorAxis() / kAuToMeter)
                 {
                     Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kIcePlanet);
                 }
 
                 // 计算自转周期和扁率
-                Astro::FOrbit::FOrbitalDetails Parent(Star, Astro::FOrbit::EObjectType::kStar, Orbits[i].get());
-                GenerateSpin(Orbits[i]->GetSemiMajorAxis(), Parent.GetOrbitalObject(), Planets[i].get());
+                GenerateSpin(Orbits[i].GetSemiMajorAxis(), System, ParentStarObject, Planets[i].get());
 
                 // 计算类地行星、次生大气层和地壳矿脉
                 if (Star->GetStellarClass().GetStellarType() == Astro::EStellarType::kNormalStar)
                 {
-                    GenerateTerra(Star, PoyntingVector, HabitableZoneAu, Orbits[i].get(), Planets[i].get());
+                    GenerateTerra(Star, PoyntingVector, HabitableZoneAu, &Orbits[i], Planets[i].get());
                 }
 
                 // 计算平衡温度
@@ -701,34 +713,37 @@ namespace Npgs
                     continue;
                 }
 
+                std::uint32_t PlanetDetails = CommitPlanet(i);
+                if (PlanetDetails == Astro::FOrbit::kInvalidIndex)
+                {
+                    continue;
+                }
+
                 // 生成卫星和行星环
-                Astro::FOrbit::FOrbitalDetails Planet(Planets[i].get(), Astro::FOrbit::EObjectType::kPlanet, Orbits[i].get());
-                GenerateMoons(i, FrostLineAu, Star, PoyntingVector, HabitableZoneAu, Planet, Orbits, Planets);
+                GenerateMoons(i, FrostLineAu, Star, PoyntingVector, HabitableZoneAu, PlanetDetails, Orbits, System);
 
-                if (PlanetType != Astro::APlanet::EPlanetType::kRockyAsteroidCluster    &&
-                    PlanetType != Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster &&
-                    Planets[i]->GetMassDigital<float>() > RingsParentLowerLimit_)
+                // 卫星加入系统后行星数组可能重新分配，之后重新取行星指针
+                Astro::FOrbit::FOrbitalObject PlanetObject = System.OrbitalDetailsData()[PlanetDetails].GetOrbitalObject();
+                if (System.GetObject<Astro::APlanet>(PlanetObject)->GetMassDigital<float>() > RingsParentLowerLimit_)
                 {
-                    GenerateRings(i, std::numeric_limits<float>::infinity(), Star, Planet, Orbits, AsteroidClusters);
+                    GenerateRings(i, std::numeric_limits<float>::infinity(), Star, PlanetDetails, Orbits, System);
                 }
 
                 // 生成生命和文明
-                PlanetType = Planets[i]->GetPlanetType();
-                if (PlanetType == Astro::APlanet::EPlanetType::kTerra)
+                Astro::APlanet* Planet = System.GetObject<Astro::APlanet>(PlanetObject);
+                if (Planet->GetPlanetType() == Astro::APlanet::EPlanetType::kTerra)
                 {
-                    GenerateCivilization(Star, PoyntingVector, HabitableZoneAu, Orbits[i].get(), Planets[i].get());
+                    GenerateCivilization(Star, PoyntingVector, HabitableZoneAu, &Orbits[i], Planet);
                 }
 
                 // 生成特洛伊带
-                GenerateTrojan(Star, FrostLineAu, Orbits[i].get(), Planet, AsteroidClusters);
-
-                Orbits[i]->ObjectsData().push_back(std::move(Planet));
+                GenerateTrojan(Star, FrostLineAu, PlanetDetails, System);
             }
 
             // 生成柯伊伯带
             if (System.StarsData().size() == 1)
             {
-                GenerateKuiperBelt(Star, FrostLineAu, PlanetaryDisk, Orbits, AsteroidClusters);
+                GenerateKuiperBelt(StarIndex, FrostLineAu, PlanetaryDisk, ParentStar, System);
             }
         }
         else
@@ -747,15 +762,14 @@ namespace Npgs
 #ifdef DEBUG_OUTPUT
                 float PlanetMassEarth = Planets[i]->GetMassDigital<float>() / kEarthMass;
                 std::println("Final system: planet {} semi-major axis: {} AU, mass: {} earth, radius: {} earth, type: {}",
-                             i + 1, Orbits[i]->GetSemiMajorAxis() / kAuToMeter, PlanetMassEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
+                             i + 1, Orbits[i].GetSemiMajorAxis() / kAuToMeter, PlanetMassEarth, Planets[i]->GetRadius() / kEarthRadius, std::to_underlying(Planets[i]->GetPlanetType()));
 #endif // DEBUG_OUTPUT
                 CalculatePlanetRadius(CoreMassesSol[i] * kSolarMassToEarth, Planets[i].get());
 
-                Astro::FOrbit::FOrbitalDetails Parent(Star, Astro::FOrbit::EObjectType::kStar, Orbits[i].get());
-                GenerateSpin(Orbits[i]->GetSemiMajorAxis(), Parent.GetOrbitalObject(), Planets[i].get());
+                GenerateSpin(Orbits[i].GetSemiMajorAxis(), System, ParentStarObject, Planets[i].get());
 
                 float PoyntingVector = static_cast<float>(Star->GetLuminosity()) /
-                    (4 * Math::kPi * std::pow(Orbits[i]->GetSemiMajorAxis(), 2.0f));
+                    (4 * Math::kPi * std::pow(Orbits[i].GetSemiMajorAxis(), 2.0f));
                 CalculateTemperature(Astro::FOrbit::EObjectType::kStar, PoyntingVector, Planets[i].get());
                 float BalanceTemperature = Planets[i]->GetBalanceTemperature();
                 // 判断有没有被烧似
@@ -774,62 +788,38 @@ namespace Npgs
                     continue;
                 }
 
-                Astro::FOrbit::FOrbitalDetails Planet(Planets[i].get(), Astro::FOrbit::EObjectType::kPlanet, Orbits[i].get());
-                GenerateMoons(i, std::numeric_limits<float>::infinity(), Star, PoyntingVector, {}, Planet, Orbits, Planets);
-
-                if (PlanetType != Astro::APlanet::EPlanetType::kRockyAsteroidCluster    &&
-                    PlanetType != Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster &&
-                    Planets[i]->GetMassDigital<float>() > RingsParentLowerLimit_)
+                std::uint32_t PlanetDetails = CommitPlanet(i);
+                if (PlanetDetails == Astro::FOrbit::kInvalidIndex)
                 {
-                    GenerateRings(i, std::numeric_limits<float>::infinity(), Star, Planet, Orbits, AsteroidClusters);
+                    continue;
                 }
 
-                // 生成特洛伊带
-                GenerateTrojan(Star, std::numeric_limits<float>::infinity(), Orbits[i].get(), Planet, AsteroidClusters);
-
-                Orbits[i]->ObjectsData().push_back(std::move(Planet));
-            }
-        }
-
-        // 将被开除的行星移动到小行星带数组
-        for (auto& Orbit : Orbits)
-        {
-            auto& OrbitalDetail = Orbit->ObjectsData().front();
-            auto& OrbitalObject = OrbitalDetail.GetOrbitalObject();
-            if (OrbitalObject.GetObjectType() != Astro::FOrbit::EObjectType::kPlanet)
-            {
-                continue;
-            }
+                GenerateMoons(i, std::numeric_limits<float>::infinity(), Star, PoyntingVector, {}, PlanetDetails, Orbits, System);
 
-            auto* PlanetPtr = OrbitalDetail.GetOrbitalObject().GetObject<Astro::APlanet>();
-            if (OrbitalDetail.GetOrbitalObject().GetObjectType() == Astro::FOrbit::EObjectType::kPlanet)
-            {
-                if (PlanetPtr->GetPlanetType() ==
-                    Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
-                    PlanetPtr->GetPlanetType() ==
-                    Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
+                Astro::FOrbit::FOrbitalObject PlanetObject = System.OrbitalDetailsData()[PlanetDetails].GetOrbitalObject();
+                if (System.GetObject<Astro::APlanet>(PlanetObject)->GetMassDigital<float>() > RingsParentLowerLimit_)
                 {
-                    auto AsteroidCluster = PlanetToAsteroidCluster(PlanetPtr);
-                    OrbitalDetail.SetOrbitalObject(AsteroidCluster.get(), Astro::FOrbit::EObjectType::kAsteroidCluster);
-                    AsteroidClusters.push_back(std::move(AsteroidCluster));
-                    // 为了输出调试信息，删除将在输出后进行
-                    // --PlanetCount;
-                    // Planets.erase(std::find_if(Planets.begin(), Planets.end(), [&](const auto& Planet) -> bool
-                    // {
-                    //     return Planet.get() == PlanetPtr;
-                    // }));
+                    GenerateRings(i, std::numeric_limits<float>::infinity(), Star, PlanetDetails, Orbits, System);
                 }
+
+                // 生成特洛伊带
+                GenerateTrojan(Star, std::numeric_limits<float>::infinity(), PlanetDetails, System);
             }
         }
 
-        CalculateOrbitalPeriods(Orbits);
+        CalculateOrbitalPeriods(FirstOrbit, System);
 
 #ifdef DEBUG_OUTPUT
         std::println("");
 
-        for (std::size_t i = 0; i != PlanetCount; ++i)
+        for (std::size_t i = 0; i != PlanetOrbits.size(); ++i)
         {
-            auto& Planet                         = Planets[i];
+            const auto& Orbit  = System.OrbitsData()[PlanetOrbits[i]];
+            const auto& Object = System.OrbitalDetailsData()[Orbit.GetFirstObject()].GetOrbitalObject();
+            // 转换为小行星带的行星没有加入系统，仍从临时数组读取
+            const Astro::APlanet* Planet = Object.GetObjectType() == Astro::FOrbit::EObjectType::kPlanet
+                                         ? System.GetObject<Astro::APlanet>(Object) : Planets[i].get();
+
             auto  PlanetType                     = Planet->GetPlanetType();
             float PlanetMass                     = Planet->GetMassDigital<float>();
             float PlanetMassEarth                = PlanetMass / kEarthMass;
@@ -845,7 +835,7 @@ namespace Npgs
             float OceanMassVolatiles             = Planet->GetOceanMassVolatilesDigital<float>();
             float OceanMassEnergeticNuclide      = Planet->GetOceanMassEnergeticNuclideDigital<float>();
             float CrustMineralMass               = Planet->GetCrustMineralMassDigital<float>();
-            float AtmospherePressure             = (kGravityConstant * PlanetMass * (AtmosphereMassZ + AtmosphereMassVolatiles + AtmosphereMassEnergeticNuclide)) / (4 * Math::kPi * std::pow(Planets[i]->GetRadius(), 4.0f));
+            float AtmospherePressure             = (kGravityConstant * PlanetMass * (AtmosphereMassZ + AtmosphereMassVolatiles + AtmosphereMassEnergeticNuclide)) / (4 * Math::kPi * std::pow(Planet->GetRadius(), 4.0f));
             float Oblateness                     = Planet->GetOblateness();
             float Spin                           = Planet->GetSpin();
             float BalanceTemperature             = Planet->GetBalanceTemperature();
@@ -855,7 +845,7 @@ namespace Npgs
             {
                 std::println("Planet {} details:", i + 1);
                 std::println("semi-major axis: {} AU, period: {} days, mass: {} earth, radius: {} earth, type: {}",
-                             Orbits[i]->GetSemiMajorAxis() / kAuToMeter, Orbits[i]->GetPeriod() / kDayToSecond, PlanetMassEarth, PlanetRadiusEarth, std::to_underlying(PlanetType));
+                             Orbit.GetSemiMajorAxis() / kAuToMeter, Orbit.GetPeriod() / kDayToSecond, PlanetMassEarth, PlanetRadiusEarth, std::to_underlying(PlanetType));
                 std::println("rotation period: {} h, oblateness: {}, balance temperature: {} K",
                              Spin / 3600, Oblateness, BalanceTemperature);
                 std::println("atmo  mass z: {:.2E} kg, atmo  mass vol: {:.2E} kg, atmo  mass nuc: {:.2E} kg",
@@ -871,7 +861,7 @@ namespace Npgs
             {
                 std::println("Asteroid belt (origin planet {}) details:", i + 1);
                 std::println("semi-major axis: {} AU, period: {} days, mass: {} moon, type: {}",
-                             Orbits[i]->GetSemiMajorAxis() / kAuToMeter, Orbits[i]->GetPeriod() / kDayToSecond, PlanetMass / kMoonMass, std::to_underlying(PlanetType));
+                             Orbit.GetSemiMajorAxis() / kAuToMeter, Orbit.GetPeriod() / kDayToSecond, PlanetMass / kMoonMass, std::to_underlying(PlanetType));
                 std::println("mass z: {:.2E} kg, mass vol: {:.2E} kg, mass nuc: {:.2E} kg",
                              CoreMassZ, CoreMassVolatiles, CoreMassEnergeticNuclide);
             }
@@ -879,34 +869,6 @@ namespace Npgs
             std::println("");
         }
 #endif // DEBUG_OUTPUT
-
-        for (std::size_t i = 0; i < PlanetCount; ++i) // 删除被移动到小行星数组的行星
-        {
-            if (Planets[i]->GetPlanetType() == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
-                Planets[i]->GetPlanetType() == Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
-            {
-                Planets.erase(Planets.begin() + i);
-                --i;
-                --PlanetCount;
-            }
-        }
-
-        for (auto& Orbit : Orbits)
-        {
-            if (Orbit->GetParent().GetObjectType() == Astro::FOrbit::EObjectType::kStar)
-            {
-                ParentStar.DirectOrbitsData().push_back(Orbit.get());
-            }
-        }
-
-        System.PlanetsData().reserve(System.PlanetsData().size() + Planets.size());
-        System.PlanetsData().append_range(Planets | std::views::as_rvalue);
-
-        System.OrbitsData().reserve(System.OrbitsData().size() + Orbits.size());
-        System.OrbitsData().append_range(Orbits | std::views::as_rvalue);
-
-        System.AsteroidClustersData().reserve(System.AsteroidClustersData().size() + AsteroidClusters.size());
-        System.AsteroidClustersData().append_range(AsteroidClusters | std::views::as_rvalue);
     }
 
     std::expected<FOrbitalGenerator::FPlanetaryDisk, int> FOrbitalGenerator::GeneratePlanetaryDisk(const Astro::AStar* Star)
@@ -1018,10 +980,11 @@ namespace Npgs
         return PlanetCount;
     }
 
-    std::vector<float> FOrbitalGenerator::GenerateCoreMassesSol(const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount)
+    std::pmr::vector<float> FOrbitalGenerator::GenerateCoreMassesSol(const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount,
+                                                                     std::pmr::memory_resource* MemoryResource)
     {
         // 生成行星初始核心质量
-        std::vector<float> CoreBase(PlanetCount, 0.0f);
+        std::pmr::vector<float> CoreBase(PlanetCount, 0.0f, MemoryResource);
         for (float& Num : CoreBase)
         {
             Num = CommonGenerator_(RandomEngine_) * 3.0f;
@@ -1033,7 +996,7 @@ namespace Npgs
             CoreBaseSum += std::pow(10.0f, Num);
         }
 
-        std::vector<float> CoreMassesSol(PlanetCount); // 初始核心质量，单位太阳
+        std::pmr::vector<float> CoreMassesSol(PlanetCount, MemoryResource); // 初始核心质量，单位太阳
         for (std::size_t i = 0; i < PlanetCount; ++i)
         {
             CoreMassesSol[i] = PlanetaryDisk.DustMassSol * std::pow(10.0f, CoreBase[i]) / CoreBaseSum;
@@ -1047,23 +1010,19 @@ namespace Npgs
         return CoreMassesSol;
     }
 
-    std::vector<std::unique_ptr<Astro::FOrbit>>
-    FOrbitalGenerator::GenerateOrbits(Astro::AStar* Star, const std::vector<float>& CoreMassesSol,
+    std::vector<Astro::FOrbit>
+    FOrbitalGenerator::GenerateOrbits(std::size_t StarIndex, const std::pmr::vector<float>& CoreMassesSol,
                                       const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount)
     {
-        std::vector<std::unique_ptr<Astro::FOrbit>> Orbits;
-        for (std::size_t i = 0; i != PlanetCount; ++i)
-        {
-            Orbits.push_back(std::make_unique<Astro::FOrbit>());
-        }
-
+        std::vector<Astro::FOrbit> Orbits(PlanetCount);
         for (auto& Orbit : Orbits)
         {
-            Orbit->SetParent(Star, Astro::FOrbit::EObjectType::kStar);
+            Orbit.SetParent(Astro::FOrbit::EObjectType::kStar, static_cast<std::uint32_t>(StarIndex));
         }
 
         // 生成初始轨道半长轴
-        std::vector<float> DiskBoundariesAu(PlanetCount + 1);
+        FLinearArenaScope ArenaScope;
+        std::pmr::vector<float> DiskBoundariesAu(PlanetCount + 1, ArenaScope.GetArena());
         DiskBoundariesAu[0] = PlanetaryDisk.InnerRadiusAu;
 
         float CoreMassSum = std::accumulate(CoreMassesSol.begin(), CoreMassesSol.end(), 0.0f,
@@ -1072,7 +1031,7 @@ namespace Npgs
             return Sum + std::pow(Value, 0.1f);
         });
 
-        std::vector<float> PartCoreMassSums(PlanetCount + 1, 0.0f);
+        std::pmr::vector<float> PartCoreMassSums(PlanetCount + 1, 0.0f, ArenaScope.GetArena());
         for (std::size_t i = 1; i <= PlanetCount; ++i)
         {
             PartCoreMassSums[i] = PartCoreMassSums[i - 1] + std::pow(CoreMassesSol[i - 1], 0.1f);
@@ -1085,11 +1044,11 @@ namespace Npgs
                                                        PartCoreMassSums[i + 1] / CoreMassSum);
 
             float SemiMajorAxis = kAuToMeter * (DiskBoundariesAu[i] + DiskBoundariesAu[i + 1]) / 2.0f;
-            Orbits[i]->SetSemiMajorAxis(SemiMajorAxis);
-            GenerateOrbitElements(*Orbits[i].get()); // 生成剩余的根数
+            Orbits[i].SetSemiMajorAxis(SemiMajorAxis);
+            GenerateOrbitElements(Orbits[i]); // 生成剩余的根数
 #ifdef DEBUG_OUTPUT
             std::println("Generate initial semi-major axis: planet {} initial semi-major axis: {} AU\n",
-                         i + 1, Orbits[i]->GetSemiMajorAxis() / kAuToMeter);
+                         i + 1, Orbits[i].GetSemiMajorAxis() / kAuToMeter);
 #endif // DEBUG_OUTPUT
         }
 
@@ -1097,8 +1056,8 @@ namespace Npgs
     }
 
     float FOrbitalGenerator::CalculatePlanetaryDiskAgeAndDetermineProtoplanetTypes(
-        const Astro::AStar* Star, const std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-        std::size_t PlanetCount, std::vector<float>& CoreMassesSol,
+        const Astro::AStar* Star, const std::vector<Astro::FOrbit>& Orbits,
+        std::size_t PlanetCount, std::pmr::vector<float>& CoreMassesSol,
         std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
         float StarInitialMassSol = Star->GetInitialMass() / kSolarMass;
@@ -1122,7 +1081,7 @@ namespace Npgs
                     if (ConstructFailedProbability(RandomEngine_))
                     {
                         float StarAge             = static_cast<float>(Star->GetAge());
-                        float Exponent            = StarAge / (5e9f * (Orbits[i]->GetSemiMajorAxis() / kAuToMeter) / 2.7f);
+                        float Exponent            = StarAge / (5e9f * (Orbits[i].GetSemiMajorAxis() / kAuToMeter) / 2.7f);
                         float DiscountCoefficient = std::max(0.001f, std::pow(0.01f, Exponent));
                         CoreMassesSol[i]         *= DiscountCoefficient;
                     }
@@ -1134,14 +1093,14 @@ namespace Npgs
     }
 
     void FOrbitalGenerator::EraseUnstablePlanets(Astro::FOrbitalSystem& System, std::size_t StarIndex, float BinarySemiMajorAxis,
-                                                 std::size_t PlanetCount, std::vector<float>& CoreMassesSol,
-                                                 std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                                 std::size_t& PlanetCount, std::pmr::vector<float>& CoreMassesSol,
+                                                 std::vector<Astro::FOrbit>& Orbits,
                                                  std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
-        const Astro::AStar* Current  = System.StarsData()[StarIndex].get();
-        const Astro::AStar* TheOther = System.StarsData()[1 - StarIndex].get();
+        const Astro::AStar* Current  = &System.StarsData()[StarIndex];
+        const Astro::AStar* TheOther = &System.StarsData()[1 - StarIndex];
 
-        float Eccentricity = System.OrbitsData()[0]->GetEccentricity();
+        float Eccentricity = System.OrbitsData()[0].GetEccentricity();
         float Mu = static_cast<float>(TheOther->GetMass() / (Current->GetMass() + TheOther->GetMass()));
         float StableBoundaryLimit = BinarySemiMajorAxis *
             (0.464f - 0.38f * Mu - 0.361f * Eccentricity + 0.586f * Mu * Eccentricity +
@@ -1149,7 +1108,7 @@ namespace Npgs
 
         for (std::size_t i = 0; i < PlanetCount; ++i)
         {
-            if (Orbits[i]->GetSemiMajorAxis() > StableBoundaryLimit)
+            if (Orbits[i].GetSemiMajorAxis() > StableBoundaryLimit)
             {
                 Planets.erase(Planets.begin() + i, Planets.end());
                 Orbits.erase(Orbits.begin() + i, Orbits.end());
@@ -1160,13 +1119,13 @@ namespace Npgs
     }
 
     void FOrbitalGenerator::EraseLimitedPlanets(float Limit, std::size_t& PlanetCount,
-                                                std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                                std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                                std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                                std::vector<Astro::FOrbit>& Orbits,
                                                 std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
         for (std::size_t i = 0; i < PlanetCount; ++i)
         {
-            if (Orbits[0]->GetSemiMajorAxis() < Limit)
+            if (Orbits[0].GetSemiMajorAxis() < Limit)
             {
                 Planets.erase(Planets.begin());
                 Orbits.erase(Orbits.begin());
@@ -1185,8 +1144,8 @@ namespace Npgs
 
         if (System.StarsData().size() > 1)
         {
-            const Astro::AStar* Current  = System.StarsData()[StarIndex].get();
-            const Astro::AStar* TheOther = System.StarsData()[1 - StarIndex].get();
+            const Astro::AStar* Current  = &System.StarsData()[StarIndex];
+            const Astro::AStar* TheOther = &System.StarsData()[1 - StarIndex];
 
             float CurrentLuminosity  = static_cast<float>(Current->GetLuminosity());
             float TheOtherLuminoisty = static_cast<float>(TheOther->GetLuminosity());
@@ -1196,7 +1155,7 @@ namespace Npgs
         }
         else
         {
-            const Astro::AStar* Star = System.StarsData()[StarIndex].get();
+            const Astro::AStar* Star = &System.StarsData()[StarIndex];
             float StarLuminosity     = static_cast<float>(Star->GetLuminosity());
             HabitableZoneAu.first    = std::sqrt(StarLuminosity / (4 * Math::kPi * 3000)) / kAuToMeter;
             HabitableZoneAu.second   = std::sqrt(StarLuminosity / (4 * Math::kPi * 600))  / kAuToMeter;
@@ -1216,8 +1175,8 @@ namespace Npgs
         float FrostLineAuSquared = 0.0f;
         if (System.StarsData().size() > 1)
         {
-            const Astro::AStar* Current  = System.StarsData()[StarIndex].get();
-            const Astro::AStar* TheOther = System.StarsData()[1 - StarIndex].get();
+            const Astro::AStar* Current  = &System.StarsData()[StarIndex];
+            const Astro::AStar* TheOther = &System.StarsData()[1 - StarIndex];
 
             float CurrentPrevMainSequenceLuminosity  = CalculatePrevMainSequenceLuminosity(Current->GetInitialMass()  / kSolarMass);
             float TheOtherPrevMainSequenceLuminosity = CalculatePrevMainSequenceLuminosity(TheOther->GetInitialMass() / kSolarMass);
@@ -1243,9 +1202,9 @@ namespace Npgs
     }
 
     void FOrbitalGenerator::MigratePlanets(const Astro::AStar* Star, const FPlanetaryDisk& PlanetaryDisk,
-                                           std::size_t PlanetCount, float MigratedOriginSemiMajorAxisAu,
-                                           std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                           std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                           std::size_t& PlanetCount, float MigratedOriginSemiMajorAxisAu,
+                                           std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                           std::vector<Astro::FOrbit>& Orbits,
                                            std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
         float StarInitialMassSol = Star->GetInitialMass() / kSolarMass;
@@ -1282,7 +1241,7 @@ namespace Npgs
                         float Lower = std::log10(PlanetaryDisk.InnerRadiusAu / Coefficient);
                         float Upper = std::log10(PlanetaryDisk.InnerRadiusAu * 0.67f);
                         float Exponent = Lower + CommonGenerator_(RandomEngine_) * (Upper - Lower);
-                        Orbits[0]->SetSemiMajorAxis(std::pow(10.0f, Exponent) * kAuToMeter);
+                        Orbits[0].SetSemiMajorAxis(std::pow(10.0f, Exponent) * kAuToMeter);
                     }
 
                     // 迁移到指定位置
@@ -1290,7 +1249,7 @@ namespace Npgs
                     Planets[MigrationIndex] = std::move(Planets[i]);
                     CoreMassesSol[MigrationIndex] = CoreMassesSol[i];
                     NewCoreMassesSol[MigrationIndex] = NewCoreMassesSol[i];
-                    MigratedOriginSemiMajorAxisAu = Orbits[i]->GetSemiMajorAxis() / kAuToMeter;
+                    MigratedOriginSemiMajorAxisAu = Orbits[i].GetSemiMajorAxis() / kAuToMeter;
                     // 抹掉内迁途中的经过的其他行星
                     Planets.erase(Planets.begin() + MigrationIndex + 1, Planets.begin() + i + 1);
                     Orbits.erase(Orbits.begin() + MigrationIndex + 1, Orbits.begin() + i + 1);
@@ -1308,9 +1267,9 @@ namespace Npgs
         }
     }
 
-    void FOrbitalGenerator::DevourPlanets(const Astro::AStar* Star, std::size_t PlanetCount,
-                                          std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                          std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+    void FOrbitalGenerator::DevourPlanets(const Astro::AStar* Star, std::size_t& PlanetCount,
+                                          std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                          std::vector<Astro::FOrbit>& Orbits,
                                           std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
         float StarRadiusMaxSol   = 0.0f; // 恒星膨胀过程中达到的最大半径
@@ -1344,7 +1303,7 @@ namespace Npgs
             if ((Planets[i]->GetPlanetType() == Astro::APlanet::EPlanetType::kGasGiant ||
                  Planets[i]->GetPlanetType() == Astro::APlanet::EPlanetType::kIceGiant) &&
                 Star->GetStellarClass().GetStellarType() == Astro::EStellarType::kWhiteDwarf &&
-                Orbits[i]->GetSemiMajorAxis() < 2.0f * StarRadiusMaxSol * kSolarRadius)
+                Orbits[i].GetSemiMajorAxis() < 2.0f * StarRadiusMaxSol * kSolarRadius)
             {
                 Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kChthonian);
                 NewCoreMassesSol[i] = CoreMassesSol[i];
@@ -1381,20 +1340,20 @@ namespace Npgs
         }
     }
 
-    std::size_t FOrbitalGenerator::JudgeLargePlanets(std::size_t StarIndex, const std::vector<std::unique_ptr<Astro::AStar>>& StarData,
+    std::size_t FOrbitalGenerator::JudgeLargePlanets(std::size_t StarIndex, const std::vector<Astro::AStar>& StarData,
                                                      float BinarySemiMajorAxis, float InnerHabitableZoneRadiusAu, float FrostLineAu,
-                                                     std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                                     std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                                     std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                                     std::vector<Astro::FOrbit>& Orbits,
                                                      std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
     {
-        const Astro::AStar* Star        = StarData[StarIndex].get();
+        const Astro::AStar* Star        = &StarData[StarIndex];
         auto                StellarType = Star->GetStellarClass().GetStellarType();
         std::size_t         PlanetCount = CoreMassesSol.size();
 
         for (std::size_t i = 0; i < PlanetCount; ++i)
         {
             if (Planets[i]->GetPlanetType() != Astro::APlanet::EPlanetType::kRockyAsteroidCluster &&
-                Orbits[i]->GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
+                Orbits[i].GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
             {
                 NewCoreMassesSol[i] = CoreMassesSol[i] * 2.35f;
             }
@@ -1411,12 +1370,12 @@ namespace Npgs
             {
                 float PrevMainSequenceLuminosity = CalculatePrevMainSequenceLuminosity(Star->GetInitialMass() / kSolarMass);
                 PlanetBalanceTemperatureWhenStarAtPrevMainSequenceQuadraticed =
-                    PrevMainSequenceLuminosity / (4 * Math::kPi * std::pow(Orbits[i]->GetSemiMajorAxis(), 2.0f)) / kStefanBoltzmann;
+                    PrevMainSequenceLuminosity / (4 * Math::kPi * std::pow(Orbits[i].GetSemiMajorAxis(), 2.0f)) / kStefanBoltzmann;
             }
             else
             {
-                const Astro::AStar* Current  = StarData[StarIndex].get();
-                const Astro::AStar* TheOther = StarData[1 - StarIndex].get();
+                const Astro::AStar* Current  = &StarData[StarIndex];
+                const Astro::AStar* TheOther = &StarData[1 - StarIndex];
 
                 float CurrentPrevMainSequenceLuminosity  =
                     CalculatePrevMainSequenceLuminosity(Current->GetInitialMass() / kSolarMass);
@@ -1424,7 +1383,7 @@ namespace Npgs
                     CalculatePrevMainSequenceLuminosity(TheOther->GetInitialMass() / kSolarMass);
 
                 PlanetBalanceTemperatureWhenStarAtPrevMainSequenceQuadraticed =
-                    (CurrentPrevMainSequenceLuminosity  / (4 * Math::kPi * std::pow(Orbits[i]->GetSemiMajorAxis(), 2.0f)) +
+                    (CurrentPrevMainSequenceLuminosity  / (4 * Math::kPi * std::pow(Orbits[i].GetSemiMajorAxis(), 2.0f)) +
                      TheOtherPrevMainSequenceLuminosity / (4 * Math::kPi * std::pow(BinarySemiMajorAxis, 2.0f))) / kStefanBoltzmann;
             }
 
@@ -1446,7 +1405,7 @@ namespace Npgs
                     continue;
                 }
 
-                if (std::to_underlying(Star->GetEvolutionPhase()) < 1 && Orbits[i]->GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
+                if (std::to_underlying(Star->GetEvolutionPhase()) < 1 && Orbits[i].GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
                 {
                     Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster);
                 }
@@ -1461,7 +1420,7 @@ namespace Npgs
                     Planets[i]->GetPlanetType() != Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster &&
                     CoreMassesSol[i] * kSolarMassToEarth < 0.1f && AsteroidBeltProbability_(RandomEngine_))
                 {
-                    if (std::to_underlying(Star->GetEvolutionPhase()) < 1 && Orbits[i]->GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
+                    if (std::to_underlying(Star->GetEvolutionPhase()) < 1 && Orbits[i].GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
                     {
                         Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster);
                     }
@@ -1478,7 +1437,7 @@ namespace Npgs
                 else
                 {
                     // 计算初始核心半径
-                    if (Orbits[i]->GetSemiMajorAxis() / kAuToMeter < FrostLineAu)
+                    if (Orbits[i].GetSemiMajorAxis() / kAuToMeter < FrostLineAu)
                     {
                         Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kRocky);
                     }
@@ -1507,15 +1466,15 @@ namespace Npgs
                     else
                     {
                         if ((CoreMassesSol[i] * kSolarMass / Planets[i]->GetRadius()) > (CommonCoefficient / 18.0f) &&
-                            Orbits[i]->GetSemiMajorAxis() / kAuToMeter > InnerHabitableZoneRadiusAu &&
-                            Orbits[i]->GetSemiMajorAxis() / kAuToMeter < FrostLineAu &&
+                            Orbits[i].GetSemiMajorAxis() / kAuToMeter > InnerHabitableZoneRadiusAu &&
+                            Orbits[i].GetSemiMajorAxis() / kAuToMeter < FrostLineAu &&
                             std::to_underlying(Star->GetEvolutionPhase()) < 1)
                         {
                             Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kOceanic);
                         }
                         else
                         {
-                            if (Orbits[i]->GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
+                            if (Orbits[i].GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
                             {
                                 Planets[i]->SetPlanetType(Astro::APlanet::EPlanetType::kIcePlanet);
                             }
@@ -1562,9 +1521,9 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             return (CoreMassVolatiles + CoreMassEnergeticNuclide + CoreMassZ) / kEarthMass;
@@ -1591,15 +1550,15 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetOceanMass({
-                boost::multiprecision::uint128_t(OceanMassZ),
-                boost::multiprecision::uint128_t(OceanMassVolatiles),
-                boost::multiprecision::uint128_t(OceanMassEnergeticNuclide)
+                Math::FUint128(OceanMassZ),
+                Math::FUint128(OceanMassVolatiles),
+                Math::FUint128(OceanMassEnergeticNuclide)
             });
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             return (OceanMassVolatiles + OceanMassEnergeticNuclide + OceanMassZ +
@@ -1628,15 +1587,15 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetOceanMass({
-                boost::multiprecision::uint128_t(OceanMassZ),
-                boost::multiprecision::uint128_t(OceanMassVolatiles),
-                boost::multiprecision::uint128_t(OceanMassEnergeticNuclide)
+                Math::FUint128(OceanMassZ),
+                Math::FUint128(OceanMassVolatiles),
+                Math::FUint128(OceanMassEnergeticNuclide)
             });
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             return (OceanMassVolatiles + OceanMassEnergeticNuclide + OceanMassZ +
@@ -1661,15 +1620,15 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetAtmosphereMass({
-                boost::multiprecision::uint128_t(AtmosphereMassZ),
-                boost::multiprecision::uint128_t(AtmosphereMassVolatiles),
-                boost::multiprecision::uint128_t(AtmosphereMassEnergeticNuclide)
+                Math::FUint128(AtmosphereMassZ),
+                Math::FUint128(AtmosphereMassVolatiles),
+                Math::FUint128(AtmosphereMassEnergeticNuclide)
             });
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             Planet->SetPlanetType(Astro::APlanet::EPlanetType::kIceGiant);
@@ -1696,15 +1655,15 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetAtmosphereMass({
-                boost::multiprecision::uint128_t(AtmosphereMassZ),
-                boost::multiprecision::uint128_t(AtmosphereMassVolatiles),
-                boost::multiprecision::uint128_t(AtmosphereMassEnergeticNuclide)
+                Math::FUint128(AtmosphereMassZ),
+                Math::FUint128(AtmosphereMassVolatiles),
+                Math::FUint128(AtmosphereMassEnergeticNuclide)
             });
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             Planet->SetPlanetType(Astro::APlanet::EPlanetType::kGasGiant);
@@ -1722,9 +1681,9 @@ namespace Npgs
             CoreMassZ                = CoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             return (CoreMassVolatiles + CoreMassEnergeticNuclide + CoreMassZ) / kEarthMass;
@@ -1740,9 +1699,9 @@ namespace Npgs
             CoreMassZ                = NewCoreMass - CoreMassVolatiles - CoreMassEnergeticNuclide;
 
             Planet->SetCoreMass({
-                boost::multiprecision::uint128_t(CoreMassZ),
-                boost::multiprecision::uint128_t(CoreMassVolatiles),
-                boost::multiprecision::uint128_t(CoreMassEnergeticNuclide)
+                Math::FUint128(CoreMassZ),
+                Math::FUint128(CoreMassVolatiles),
+                Math::FUint128(CoreMassEnergeticNuclide)
             });
 
             return (CoreMassVolatiles + CoreMassEnergeticNuclide + CoreMassZ) / kEarthMass;
@@ -1827,7 +1786,8 @@ namespace Npgs
         Planet->SetRadius(Radius);
     }
 
-    void FOrbitalGenerator::GenerateSpin(float SemiMajorAxis, const Astro::FOrbit::FOrbitalObject& Parent, Astro::APlanet* Planet)
+    void FOrbitalGenerator::GenerateSpin(float SemiMajorAxis, const Astro::FOrbitalSystem& System,
+                                         const Astro::FOrbit::FOrbitalObject& Parent, Astro::APlanet* Planet)
     {
         auto PlanetType = Planet->GetPlanetType();
         if (PlanetType == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
@@ -1857,12 +1817,12 @@ namespace Npgs
         switch (ParentType)
         {
         case Astro::FOrbit::EObjectType::kStar:
-            ParentAge  = static_cast<float>(Parent.GetObject<Astro::AStar>()->GetAge());
-            ParentMass = static_cast<float>(Parent.GetObject<Astro::AStar>()->GetMass());
+            ParentAge  = static_cast<float>(System.GetObject<Astro::AStar>(Parent)->GetAge());
+            ParentMass = static_cast<float>(System.GetObject<Astro::AStar>(Parent)->GetMass());
             break;
         case Astro::FOrbit::EObjectType::kPlanet:
-            ParentAge  = static_cast<float>(Parent.GetObject<Astro::APlanet>()->GetAge());
-            ParentMass = static_cast<float>(Parent.GetObject<Astro::APlanet>()->GetMass());
+            ParentAge  = static_cast<float>(System.GetObject<Astro::APlanet>(Parent)->GetAge());
+            ParentMass = static_cast<float>(System.GetObject<Astro::APlanet>(Parent)->GetMass());
             break;
         }
 
@@ -2020,10 +1980,12 @@ namespace Npgs
     }
 
     void FOrbitalGenerator::GenerateMoons(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star, float PoyntingVector,
-                                          const std::pair<float, float>& HabitableZoneAu, Astro::FOrbit::FOrbitalDetails& ParentPlanet,
-                                          std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits, std::vector<std::unique_ptr<Astro::APlanet>>& Planets)
+                                          const std::pair<float, float>& HabitableZoneAu, std::uint32_t ParentPlanet,
+                                          const std::vector<Astro::FOrbit>& Orbits, Astro::FOrbitalSystem& System)
     {
-        auto* Planet     = ParentPlanet.GetOrbitalObject().GetObject<Astro::APlanet>();
+        Astro::FOrbit::FOrbitalObject PlanetObject = System.OrbitalDetailsData()[ParentPlanet].GetOrbitalObject();
+
+        auto* Planet     = System.GetObject<Astro::APlanet>(PlanetObject);
         auto  PlanetType = Planet->GetPlanetType();
         if (PlanetType == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
             PlanetType == Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
@@ -2034,7 +1996,7 @@ namespace Npgs
         float PlanetMass        = Planet->GetMassDigital<float>();
         float PlanetMassEarth   = PlanetMass / kEarthMass;
         float LiquidRocheRadius = 2.02373e7f * std::pow(PlanetMassEarth, 1.0f / 3.0f);
-        float HillSphereRadius  = Orbits[PlanetIndex]->GetSemiMajorAxis() * std::pow(3 * PlanetMass / static_cast<float>(Star->GetMass()), 1.0f / 3.0f);
+        float HillSphereRadius  = Orbits[PlanetIndex].GetSemiMajorAxis() * std::pow(3 * PlanetMass / static_cast<float>(Star->GetMass()), 1.0f / 3.0f);
 
         std::size_t MoonCount = 0;
         if (std::to_underlying(Star->GetEvolutionPhase()) < 1)
@@ -2058,7 +2020,7 @@ namespace Npgs
             }
         }
 
-        std::vector<std::unique_ptr<Astro::FOrbit>> MoonOrbits;
+        std::vector<Astro::FOrbit> MoonOrbits;
 
         if (MoonCount == 0)
         {
@@ -2067,7 +2029,7 @@ namespace Npgs
         else if (MoonCount == 1)
         {
             Astro::FOrbit MoonOrbitData;
-            MoonOrbitData.SetParent(Planet, Astro::FOrbit::EObjectType::kPlanet);
+            MoonOrbitData.SetParent(Astro::FOrbit::EObjectType::kPlanet, PlanetObject.GetIndex());
             MoonOrbitData.SetSemiMajorAxis(2 * LiquidRocheRadius + CommonGenerator_(RandomEngine_) *
                                            (std::min(1e9f, HillSphereRadius / 3 - 1e8f) - 2 * LiquidRocheRadius));
             GenerateOrbitElements(MoonOrbitData);
@@ -2097,7 +2059,7 @@ namespace Npgs
 
             MoonOrbitData.SetNormal(MoonNormal);
 
-            MoonOrbits.push_back(std::make_unique<Astro::FOrbit>(MoonOrbitData));
+            MoonOrbits.push_back(MoonOrbitData);
         }
         else if (MoonCount == 2)
         {
@@ -2128,7 +2090,7 @@ namespace Npgs
 
             for (int i = 0; i != 2; ++i)
             {
-                MoonOrbitData[i].SetParent(Planet, Astro::FOrbit::EObjectType::kPlanet);
+                MoonOrbitData[i].SetParent(Astro::FOrbit::EObjectType::kPlanet, PlanetObject.GetIndex());
                 MoonNormals[i] = glm::vec2(Planet->GetNormal() + glm::vec2(
                     -0.09f + CommonGenerator_(RandomEngine_) * 0.18f,
                     -0.09f + CommonGenerator_(RandomEngine_) * 0.18f
@@ -2156,28 +2118,20 @@ namespace Npgs
             MoonOrbitData[0].SetNormal(MoonNormals[0]);
             MoonOrbitData[1].SetNormal(MoonNormals[1]);
 
-            MoonOrbits.push_back(std::make_unique<Astro::FOrbit>(MoonOrbitData[0]));
-            MoonOrbits.push_back(std::make_unique<Astro::FOrbit>(MoonOrbitData[1]));
-        }
-
-        for (std::size_t i = 0; i != MoonCount; ++i)
-        {
-            ParentPlanet.DirectOrbitsData().push_back(MoonOrbits[i].get());
+            MoonOrbits.push_back(MoonOrbitData[0]);
+            MoonOrbits.push_back(MoonOrbitData[1]);
         }
 
         float ParentCoreMass        = Planet->GetCoreMassZDigital<float>();
         float LogCoreMassLowerLimit = std::log10(std::max(AsteroidUpperLimit_, ParentCoreMass / 600));
         float LogCoreMassUpperLimit = std::log10(ParentCoreMass / 30.0f);
 
-        std::vector<std::unique_ptr<Astro::APlanet>> Moons;
-        Moons.reserve(MoonCount);
+        std::vector<Astro::APlanet> Moons(MoonCount);
 
         for (std::size_t i = 0; i != MoonCount; ++i)
         {
-            Moons.push_back(std::make_unique<Astro::APlanet>());
-
             float Exponent = LogCoreMassLowerLimit + CommonGenerator_(RandomEngine_) * (LogCoreMassUpperLimit - LogCoreMassLowerLimit);
-            boost::multiprecision::uint128_t InitialCoreMass(std::pow(10.0f, Exponent));
+            Math::FUint128 InitialCoreMass(std::pow(10.0f, Exponent));
 
             int VolatilesRate        = 9000    + static_cast<int>(CommonGenerator_(RandomEngine_)) + 2000;
             int EnergeticNuclideRate = 4500000 + static_cast<int>(CommonGenerator_(RandomEngine_)) * 1000000;
@@ -2188,44 +2142,50 @@ namespace Npgs
             CoreMass.EnergeticNuclide = InitialCoreMass / EnergeticNuclideRate;
             CoreMass.Z                = InitialCoreMass - CoreMass.Volatiles - CoreMass.EnergeticNuclide;
 
-            Moons[i]->SetCoreMass(CoreMass);
+            Moons[i].SetCoreMass(CoreMass);
 
-            if (MoonOrbits[i]->GetSemiMajorAxis() > 5 * LiquidRocheRadius)
+            if (MoonOrbits[i].GetSemiMajorAxis() > 5 * LiquidRocheRadius)
             {
-                if (Orbits[PlanetIndex]->GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
+                if (Orbits[PlanetIndex].GetSemiMajorAxis() / kAuToMeter > FrostLineAu)
                 {
-                    Moons[i]->SetPlanetType(Astro::APlanet::EPlanetType::kIcePlanet);
-                    CalculatePlanetMass(Moons[i]->GetCoreMassDigital<float>(), 0, 0, {}, Star, Moons[i].get()); // 0, 0, {}: 这些参数只在计算气态行星时有用，此处省略
+                    Moons[i].SetPlanetType(Astro::APlanet::EPlanetType::kIcePlanet);
+                    CalculatePlanetMass(Moons[i].GetCoreMassDigital<float>(), 0, 0, {}, Star, &Moons[i]); // 0, 0, {}: 这些参数只在计算气态行星时有用，此处省略
                 }
                 else
                 {
-                    Moons[i]->SetPlanetType(Astro::APlanet::EPlanetType::kRocky);
+                    Moons[i].SetPlanetType(Astro::APlanet::EPlanetType::kRocky);
                 }
             }
             else
             {
-                Moons[i]->SetPlanetType(Astro::APlanet::EPlanetType::kRocky);
+                Moons[i].SetPlanetType(Astro::APlanet::EPlanetType::kRocky);
             }
 
-            CalculatePlanetRadius(Moons[i]->GetCoreMassDigital<float>() / kEarthMass, Moons[i].get());
+            CalculatePlanetRadius(Moons[i].GetCoreMassDigital<float>() / kEarthMass, &Moons[i]);
 
-            Astro::FOrbit::FOrbitalDetails Parent(Planet, Astro::FOrbit::EObjectType::kPlanet, MoonOrbits[i].get());
-            GenerateSpin(MoonOrbits[i]->GetSemiMajorAxis(), Parent.GetOrbitalObject(), Moons[i].get());
+            GenerateSpin(MoonOrbits[i].GetSemiMajorAxis(), System, PlanetObject, &Moons[i]);
 
-            CalculateTemperature(Astro::FOrbit::EObjectType::kPlanet, PoyntingVector, Moons[i].get());
+            CalculateTemperature(Astro::FOrbit::EObjectType::kPlanet, PoyntingVector, &Moons[i]);
 
             if (Star->GetStellarClass().GetStellarType() == Astro::EStellarType::kNormalStar)
             {
-                GenerateTerra(Star, PoyntingVector, HabitableZoneAu, Orbits[i].get(), Moons[i].get());
+                GenerateTerra(Star, PoyntingVector, HabitableZoneAu, &Orbits[i], &Moons[i]);
             }
 
-            if (Moons[i]->GetPlanetType() == Astro::APlanet::EPlanetType::kTerra)
+            if (Moons[i].GetPlanetType() == Astro::APlanet::EPlanetType::kTerra)
             {
-                GenerateCivilization(Star, PoyntingVector, HabitableZoneAu, Orbits[i].get(), Moons[i].get());
+                GenerateCivilization(Star, PoyntingVector, HabitableZoneAu, &Orbits[i], &Moons[i]);
             }
         }
 
-        CalculateOrbitalPeriods(MoonOrbits);
+        // 卫星轨道先加入系统并计算周期，之后再把卫星放上轨道
+        std::uint32_t FirstMoonOrbit = static_cast<std::uint32_t>(System.OrbitsData().size());
+        for (const auto& MoonOrbit : MoonOrbits)
+        {
+            System.AddDirectOrbit(ParentPlanet, System.AddOrbit(MoonOrbit));
+        }
+
+        CalculateOrbitalPeriods(FirstMoonOrbit, System);
 
 #ifdef DEBUG_OUTPUT
         std::println("");
@@ -2233,31 +2193,31 @@ namespace Npgs
         for (std::size_t i = 0; i != MoonCount; ++i)
         {
             auto& Moon                           = Moons[i];
-            auto  MoonType                       = Moon->GetPlanetType();
-            float MoonMass                       = Moon->GetMassDigital<float>();
+            auto  MoonType                       = Moon.GetPlanetType();
+            float MoonMass                       = Moon.GetMassDigital<float>();
             float MoonMassEarth                  = MoonMass / kEarthMass;
             float MoonMassMoon                   = MoonMass / kMoonMass;
-            float MoonRadius                     = Moons[i]->GetRadius();
+            float MoonRadius                     = Moons[i].GetRadius();
             float MoonRadiusEarth                = MoonRadius / kEarthRadius;
             float MoonRadiusMoon                 = MoonRadius / kMoonRadius;
-            float AtmosphereMassZ                = Moon->GetAtmosphereMassZDigital<float>();
-            float AtmosphereMassVolatiles        = Moon->GetAtmosphereMassVolatilesDigital<float>();
-            float AtmosphereMassEnergeticNuclide = Moon->GetAtmosphereMassEnergeticNuclideDigital<float>();
-            float CoreMassZ                      = Moon->GetCoreMassZDigital<float>();
-            float CoreMassVolatiles              = Moon->GetCoreMassVolatilesDigital<float>();
-            float CoreMassEnergeticNuclide       = Moon->GetCoreMassEnergeticNuclideDigital<float>();
-            float OceanMassZ                     = Moon->GetOceanMassZDigital<float>();;
-            float OceanMassVolatiles             = Moon->GetOceanMassVolatilesDigital<float>();
-            float OceanMassEnergeticNuclide      = Moon->GetOceanMassEnergeticNuclideDigital<float>();
-            float CrustMineralMass               = Moon->GetCrustMineralMassDigital<float>();
-            float AtmospherePressure             = (kGravityConstant * MoonMass * (AtmosphereMassZ + AtmosphereMassVolatiles + AtmosphereMassEnergeticNuclide)) / (4 * Math::kPi * std::pow(Moons[i]->GetRadius(), 4.0f));
-            float Oblateness                     = Moon->GetOblateness();
-            float Spin                           = Moon->GetSpin();
-            float BalanceTemperature             = Moon->GetBalanceTemperature();
+            float AtmosphereMassZ                = Moon.GetAtmosphereMassZDigital<float>();
+            float AtmosphereMassVolatiles        = Moon.GetAtmosphereMassVolatilesDigital<float>();
+            float AtmosphereMassEnergeticNuclide = Moon.GetAtmosphereMassEnergeticNuclideDigital<float>();
+            float CoreMassZ                      = Moon.GetCoreMassZDigital<float>();
+            float CoreMassVolatiles              = Moon.GetCoreMassVolatilesDigital<float>();
+            float CoreMassEnergeticNuclide       = Moon.GetCoreMassEnergeticNuclideDigital<float>();
+            float OceanMassZ                     = Moon.GetOceanMassZDigital<float>();;
+            float OceanMassVolatiles             = Moon.GetOceanMassVolatilesDigital<float>();
+            float OceanMassEnergeticNuclide      = Moon.GetOceanMassEnergeticNuclideDigital<float>();
+            float CrustMineralMass               = Moon.GetCrustMineralMassDigital<float>();
+            float AtmospherePressure             = (kGravityConstant * MoonMass * (AtmosphereMassZ + AtmosphereMassVolatiles + AtmosphereMassEnergeticNuclide)) / (4 * Math::kPi * std::pow(Moons[i].GetRadius(), 4.0f));
+            float Oblateness                     = Moon.GetOblateness();
+            float Spin                           = Moon.GetSpin();
+            float BalanceTemperature             = Moon.GetBalanceTemperature();
             std::println("Moon generated, details:");
             std::println("parent planet: {}", PlanetIndex + 1);
             std::println("semi-major axis: {} km, period: {} days, mass: {} earth ({} moon), radius: {} earth ({} moon), type: {}",
-                         MoonOrbits[i]->GetSemiMajorAxis() / 1000, MoonOrbits[i]->GetPeriod() / kDayToSecond, MoonMassEarth, MoonMassMoon, MoonRadiusEarth, MoonRadiusMoon, std::to_underlying(MoonType));
+                         MoonOrbits[i].GetSemiMajorAxis() / 1000, System.OrbitsData()[FirstMoonOrbit + i].GetPeriod() / kDayToSecond, MoonMassEarth, MoonMassMoon, MoonRadiusEarth, MoonRadiusMoon, std::to_underlying(MoonType));
             std::println("rotation period: {} h, oblateness: {}, balance temperature: {} K",
                          Spin / 3600, Oblateness, BalanceTemperature);
             std::println("atmo  mass z: {:.2E} kg, atmo  mass vol: {:.2E} kg, atmo  mass nuc: {:.2E} kg",
@@ -2274,24 +2234,18 @@ namespace Npgs
 
         for (std::size_t i = 0; i != MoonCount; ++i)
         {
-            Astro::FOrbit::FOrbitalDetails Moon(Moons[i].get(), Astro::FOrbit::EObjectType::kPlanet,
-                                                MoonOrbits[i].get(), CommonGenerator_(RandomEngine_) * 2 * Math::kPi);
-            MoonOrbits[i]->ObjectsData().push_back(std::move(Moon));
+            std::uint32_t MoonIndex = System.AddPlanet(std::move(Moons[i]));
+            System.AddOrbitalObject(FirstMoonOrbit + static_cast<std::uint32_t>(i), Astro::FOrbit::EObjectType::kPlanet,
+                                    MoonIndex, CommonGenerator_(RandomEngine_) * 2 * Math::kPi);
         }
-
-        Orbits.reserve(Orbits.size() + MoonOrbits.size());
-        Orbits.append_range(MoonOrbits | std::views::as_rvalue);
-
-        Planets.reserve(Planets.size() + Moons.size());
-        Planets.append_range(Moons | std::views::as_rvalue);
     }
 
-    void FOrbitalGenerator::GenerateRings(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star,
-                                          Astro::FOrbit::FOrbitalDetails& ParentPlanet,
-                                          std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-                                          std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters)
+    void FOrbitalGenerator::GenerateRings(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star, std::uint32_t ParentPlanet,
+                                          const std::vector<Astro::FOrbit>& Orbits, Astro::FOrbitalSystem& System)
     {
-        auto* Planet     = ParentPlanet.GetOrbitalObject().GetObject<Astro::APlanet>();
+        Astro::FOrbit::FOrbitalObject PlanetObject = System.OrbitalDetailsData()[ParentPlanet].GetOrbitalObject();
+
+        auto* Planet     = System.GetObject<Astro::APlanet>(PlanetObject);
         auto  PlanetType = Planet->GetPlanetType();
         if (PlanetType == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
             PlanetType == Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
@@ -2302,7 +2256,7 @@ namespace Npgs
         float PlanetMass        = Planet->GetMassDigital<float>();
         float PlanetMassEarth   = PlanetMass / kEarthMass;
         float LiquidRocheRadius = 2.02373e7f * std::pow(PlanetMassEarth, 1.0f / 3.0f);
-        float HillSphereRadius  = Orbits[PlanetIndex]->GetSemiMajorAxis() * std::pow(3.0f * PlanetMass / static_cast<float>(Star->GetMass()), 1.0f / 3.0f);
+        float HillSphereRadius  = Orbits[PlanetIndex].GetSemiMajorAxis() * std::pow(3.0f * PlanetMass / static_cast<float>(Star->GetMass()), 1.0f / 3.0f);
 
         Math::TDistribution<double>* RingsProbability = nullptr;
         if (LiquidRocheRadius < HillSphereRadius / 3.0f && LiquidRocheRadius > Planet->GetRadius())
@@ -2331,7 +2285,7 @@ namespace Npgs
         float RingsMassVolatiles        = 0.0f;
         float RingsMassEnergeticNuclide = 0.0f;
 
-        if (Orbits[PlanetIndex]->GetSemiMajorAxis() / kAuToMeter >= FrostLineAu && std::to_underlying(Star->GetEvolutionPhase()) < 1)
+        if (Orbits[PlanetIndex].GetSemiMajorAxis() / kAuToMeter >= FrostLineAu && std::to_underlying(Star->GetEvolutionPhase()) < 1)
         {
             RingsMassEnergeticNuclide = RingsMass * 5e-6f * 0.064f;
             RingsMassVolatiles        = RingsMass * 0.064f;
@@ -2345,32 +2299,31 @@ namespace Npgs
             AsteroidType              = Astro::AAsteroidCluster::EAsteroidType::kRocky;
         }
 
-        auto RingsOrbit = std::make_unique<Astro::FOrbit>();
+        Astro::FOrbit RingsOrbit;
 
-        Astro::AAsteroidCluster* RingsPtr = AsteroidClusters.emplace_back(std::make_unique<Astro::AAsteroidCluster>()).get();
-        RingsPtr->SetMassEnergeticNuclide(RingsMassEnergeticNuclide);
-        RingsPtr->SetMassVolatiles(RingsMassVolatiles);
-        RingsPtr->SetMassZ(RingsMassZ);
+        Astro::AAsteroidCluster Rings;
+        Rings.SetMassEnergeticNuclide(RingsMassEnergeticNuclide);
+        Rings.SetMassVolatiles(RingsMassVolatiles);
+        Rings.SetMassZ(RingsMassZ);
 
-        Astro::FOrbit::FOrbitalDetails Rings(RingsPtr, Astro::FOrbit::EObjectType::kAsteroidCluster, RingsOrbit.get());
-
-        GenerateOrbitElements(*RingsOrbit);
+        GenerateOrbitElements(RingsOrbit);
         float Inaccuracy    = -0.1f + CommonGenerator_(RandomEngine_) * 0.2f;
         float SemiMajorAxis =  0.6f * LiquidRocheRadius * (1.0f + Inaccuracy);
 
-        RingsOrbit->SetParent(Planet, Astro::FOrbit::EObjectType::kPlanet);
-        RingsOrbit->SetSemiMajorAxis(SemiMajorAxis);
-        RingsOrbit->ObjectsData().push_back(std::move(Rings));
+        RingsOrbit.SetParent(Astro::FOrbit::EObjectType::kPlanet, PlanetObject.GetIndex());
+        RingsOrbit.SetSemiMajorAxis(SemiMajorAxis);
 
-        ParentPlanet.DirectOrbitsData().push_back(RingsOrbit.get());
-        Orbits.push_back(std::move(RingsOrbit));
+        std::uint32_t RingsOrbitIndex = System.AddOrbit(RingsOrbit);
+        System.AddOrbitalObject(RingsOrbitIndex, Astro::FOrbit::EObjectType::kAsteroidCluster,
+                                System.AddAsteroidCluster(std::move(Rings)));
+        System.AddDirectOrbit(ParentPlanet, RingsOrbitIndex);
 
 #ifdef DEBUG_OUTPUT
         std::println("");
         std::println("Rings generated, details:");
         std::println("parent planet: {}", PlanetIndex + 1);
         std::println("semi-major axis: {} km, mass: {} kg, type: {}",
-                     SemiMajorAxis / 1000, RingsMass, std::to_underlying(RingsPtr->GetAsteroidType()));
+                     SemiMajorAxis / 1000, RingsMass, std::to_underlying(System.AsteroidClustersData().back().GetAsteroidType()));
         std::println("mass z: {:.2E} kg, mass vol: {:.2E} kg, mass nuc: {:.2E} kg",
                      RingsMassZ, RingsMassVolatiles, RingsMassEnergeticNuclide);
         std::println("");
@@ -2412,9 +2365,9 @@ namespace Npgs
             float NewOceanMassZ                = NewOceanMass - NewOceanMassVolatiles - NewOceanMassEnergeticNuclide;
 
             Planet->SetOceanMass({
-                boost::multiprecision::uint128_t(NewOceanMassZ),
-                boost::multiprecision::uint128_t(NewOceanMassVolatiles),
-                boost::multiprecision::uint128_t(NewOceanMassEnergeticNuclide)
+                Math::FUint128(NewOceanMassZ),
+                Math::FUint128(NewOceanMassVolatiles),
+                Math::FUint128(NewOceanMassEnergeticNuclide)
             });
         }
 
@@ -2486,11 +2439,12 @@ namespace Npgs
         }
     }
 
-    void FOrbitalGenerator::GenerateTrojan(const Astro::AStar* Star, float FrostLineAu, Astro::FOrbit* Orbit,
-                                           Astro::FOrbit::FOrbitalDetails& ParentPlanet,
-                                           std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters)
+    void FOrbitalGenerator::GenerateTrojan(const Astro::AStar* Star, float FrostLineAu, std::uint32_t ParentPlanet, Astro::FOrbitalSystem& System)
     {
-        auto* Planet     = ParentPlanet.GetOrbitalObject().GetObject<Astro::APlanet>();
+        const auto& PlanetDetails = System.OrbitalDetailsData()[ParentPlanet];
+        const auto* Orbit         = &System.OrbitsData()[PlanetDetails.GetHostOrbit()];
+
+        auto* Planet     = System.GetObject<Astro::APlanet>(PlanetDetails.GetOrbitalObject());
         auto  PlanetType = Planet->GetPlanetType();
         if (PlanetType == Astro::APlanet::EPlanetType::kRockyAsteroidCluster ||
             PlanetType == Astro::APlanet::EPlanetType::kRockyIceAsteroidCluster)
@@ -2513,28 +2467,29 @@ namespace Npgs
         }
 
         bool bDerivedFromRings = false;
-        auto TrojanBelt        = std::make_unique<Astro::AAsteroidCluster>();
+        Astro::AAsteroidCluster TrojanBelt;
 
-        for (auto* NextOrbit : ParentPlanet.DirectOrbitsData()) // 检查是否有合适的环
+        System.ForEachDirectOrbit(ParentPlanet, [&](std::uint32_t NextOrbit) -> void // 检查是否有合适的环
         {
-            auto& OrbitalObject = NextOrbit->ObjectsData().front().GetOrbitalObject();
+            const auto& OrbitalObject =
+                System.OrbitalDetailsData()[System.OrbitsData()[NextOrbit].GetFirstObject()].GetOrbitalObject();
             if (OrbitalObject.GetObjectType() == Astro::FOrbit::EObjectType::kAsteroidCluster)
             {
                 // 从环中获取数据，让特洛伊带的成分与环相同
-                auto* PlanetRings           = OrbitalObject.GetObject<Astro::AAsteroidCluster>();
+                const auto* PlanetRings     = System.GetObject<Astro::AAsteroidCluster>(OrbitalObject);
                 auto  PlanetRingsType       = PlanetRings->GetAsteroidType();
                 float RingsMass             = PlanetRings->GetMassDigital<float>();
                 float RingsVolatiles        = PlanetRings->GetMassVolatilesDigital<float>();
                 float RingsEnergeticNuclide = PlanetRings->GetMassEnergeticNuclideDigital<float>();
                 float RingsZ                = PlanetRings->GetMassZDigital<float>();
 
-                TrojanBelt->SetAsteroidType(PlanetRingsType);
-                TrojanBelt->SetMassEnergeticNuclide(RingsEnergeticNuclide / RingsMass * TrojanMass);
-                TrojanBelt->SetMassVolatiles(RingsVolatiles / RingsMass * TrojanMass);
-                TrojanBelt->SetMassZ(RingsZ / RingsMass * TrojanMass);
+                TrojanBelt.SetAsteroidType(PlanetRingsType);
+                TrojanBelt.SetMassEnergeticNuclide(RingsEnergeticNuclide / RingsMass * TrojanMass);
+                TrojanBelt.SetMassVolatiles(RingsVolatiles / RingsMass * TrojanMass);
+                TrojanBelt.SetMassZ(RingsZ / RingsMass * TrojanMass);
                 bDerivedFromRings = true;
             }
-        }
+        });
 
         if (!bDerivedFromRings)
         {
@@ -2557,33 +2512,33 @@ namespace Npgs
                 AsteroidType               = Astro::AAsteroidCluster::EAsteroidType::kRocky;
             }
 
-            TrojanBelt->SetAsteroidType(AsteroidType);
-            TrojanBelt->SetMassEnergeticNuclide(TrojanMassEnergeticNuclide);
-            TrojanBelt->SetMassVolatiles(TrojanMassVolatiles);
-            TrojanBelt->SetMassZ(TrojanMassZ);
+            TrojanBelt.SetAsteroidType(AsteroidType);
+            TrojanBelt.SetMassEnergeticNuclide(TrojanMassEnergeticNuclide);
+            TrojanBelt.SetMassVolatiles(TrojanMassVolatiles);
+            TrojanBelt.SetMassZ(TrojanMassZ);
         }
 
 #ifdef DEBUG_OUTPUT
         std::println("");
         std::println("Trojan belt details:");
         std::println("semi-major axis: {} AU, mass: {} moon, type: {}",
-                     Orbit->GetSemiMajorAxis() / kAuToMeter, TrojanMass / kMoonMass, std::to_underlying(TrojanBelt->GetAsteroidType()));
+                     Orbit->GetSemiMajorAxis() / kAuToMeter, TrojanMass / kMoonMass, std::to_underlying(TrojanBelt.GetAsteroidType()));
         std::println("mass z: {:.2E} kg, mass vol: {:.2E} kg, mass nuc: {:.2E} kg",
-                     TrojanBelt->GetMassZDigital<float>(), TrojanBelt->GetMassVolatilesDigital<float>(), TrojanBelt->GetMassEnergeticNuclideDigital<float>());
+                     TrojanBelt.GetMassZDigital<float>(), TrojanBelt.GetMassVolatilesDigital<float>(), TrojanBelt.GetMassEnergeticNuclideDigital<float>());
         std::println("");
 #endif // DEBUG_OUTPUT
 
-        Astro::FOrbit::FOrbitalDetails MyBelt(TrojanBelt.get(), Astro::FOrbit::EObjectType::kAsteroidCluster, Orbit);
-        Orbit->ObjectsData().push_back(std::move(MyBelt));
-
-        AsteroidClusters.push_back(std::move(TrojanBelt));
+        std::uint32_t HostOrbit = PlanetDetails.GetHostOrbit();
+        System.AddOrbitalObject(HostOrbit, Astro::FOrbit::EObjectType::kAsteroidCluster,
+                                System.AddAsteroidCluster(std::move(TrojanBelt)));
     }
 
-    void FOrbitalGenerator::GenerateKuiperBelt(Astro::AStar* Star, float FrostLineAu, const FPlanetaryDisk& PlanetaryDisk,
-                                               std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-                                               std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters)
+    void FOrbitalGenerator::GenerateKuiperBelt(std::size_t StarIndex, float FrostLineAu, const FPlanetaryDisk& PlanetaryDisk,
+                                               std::uint32_t ParentStar, Astro::FOrbitalSystem& System)
     {
-        AsteroidClusters.push_back(std::make_unique<Astro::AAsteroidCluster>());
+        const Astro::AStar* Star = &System.StarsData()[StarIndex];
+
+        Astro::AAsteroidCluster KuiperBelt;
         float Exponent                       = 1.0f + CommonGenerator_(RandomEngine_);
         float KuiperBeltMass                 = PlanetaryDisk.DustMassSol * std::pow(10.0f, Exponent) * 1e-4f * kSolarMass;
         float KuiperBeltRadiusAu             = PlanetaryDisk.OuterRadiusAu * (1.0f + CommonGenerator_(RandomEngine_) * 0.5f);
@@ -2593,39 +2548,38 @@ namespace Npgs
 
         if (std::to_underlying(Star->GetEvolutionPhase()) < 1 && KuiperBeltRadiusAu > FrostLineAu)
         {
-            AsteroidClusters.back()->SetAsteroidType(Astro::AAsteroidCluster::EAsteroidType::kRockyIce);
+            KuiperBelt.SetAsteroidType(Astro::AAsteroidCluster::EAsteroidType::kRockyIce);
             KuiperBeltMassVolatiles = KuiperBeltMass * 0.064f;
             KuiperBeltMassEnergeticNuclide = KuiperBeltMass * 0.064f * 5e-6f;
             KuiperBeltMassZ = KuiperBeltMass - KuiperBeltMassVolatiles - KuiperBeltMassEnergeticNuclide;
         }
         else
         {
-            AsteroidClusters.back()->SetAsteroidType(Astro::AAsteroidCluster::EAsteroidType::kRocky);
+            KuiperBelt.SetAsteroidType(Astro::AAsteroidCluster::EAsteroidType::kRocky);
             KuiperBeltMassEnergeticNuclide = KuiperBeltMass * 5e-6f;
             KuiperBeltMassZ = KuiperBeltMass - KuiperBeltMassEnergeticNuclide;
         }
 
-        auto KuiperBeltOrbit = std::make_unique<Astro::FOrbit>();
-        Astro::FOrbit::FOrbitalDetails KuiperBelt(
-            AsteroidClusters.back().get(), Astro::FOrbit::EObjectType::kAsteroidCluster, KuiperBeltOrbit.get());
-
-        KuiperBeltOrbit->ObjectsData().push_back(std::move(KuiperBelt));
-        KuiperBeltOrbit->SetParent(Star, Astro::FOrbit::EObjectType::kStar);
-        KuiperBeltOrbit->SetSemiMajorAxis(KuiperBeltRadiusAu * kAuToMeter);
+        Astro::FOrbit KuiperBeltOrbit;
+        KuiperBeltOrbit.SetParent(Astro::FOrbit::EObjectType::kStar, static_cast<std::uint32_t>(StarIndex));
+        KuiperBeltOrbit.SetSemiMajorAxis(KuiperBeltRadiusAu * kAuToMeter);
 
-        GenerateOrbitElements(*KuiperBeltOrbit);
+        GenerateOrbitElements(KuiperBeltOrbit);
 
 #ifdef DEBUG_OUTPUT
         std::println("");
         std::println("Kuiper belt details:");
         std::println("semi-major axis: {} AU, mass: {} moon, type: {}",
-                     KuiperBeltOrbit->GetSemiMajorAxis() / kAuToMeter, KuiperBeltMass / kMoonMass, std::to_underlying(AsteroidClusters.back()->GetAsteroidType()));
+                     KuiperBeltOrbit.GetSemiMajorAxis() / kAuToMeter, KuiperBeltMass / kMoonMass, std::to_underlying(KuiperBelt.GetAsteroidType()));
         std::println("mass z: {:.2E} kg, mass vol: {:.2E} kg, mass nuc: {:.2E} kg",
                      KuiperBeltMassZ, KuiperBeltMassVolatiles, KuiperBeltMassEnergeticNuclide);
         std::println("");
 #endif // DEBUG_OUTPUT
 
-        Orbits.push_back(std::move(KuiperBeltOrbit));
+        std::uint32_t OrbitIndex = System.AddOrbit(KuiperBeltOrbit);
+        System.AddOrbitalObject(OrbitIndex, Astro::FOrbit::EObjectType::kAsteroidCluster,
+                                System.AddAsteroidCluster(std::move(KuiperBelt)));
+        System.AddDirectOrbit(ParentStar, OrbitIndex);
     }
 
     void FOrbitalGenerator::GenerateCivilization(const Astro::AStar* Star, float PoyntingVector,
@@ -2659,40 +2613,42 @@ namespace Npgs
         }
     }
 
-    void FOrbitalGenerator::CalculateOrbitalPeriods(std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits)
+    void FOrbitalGenerator::CalculateOrbitalPeriods(std::uint32_t FirstOrbit, Astro::FOrbitalSystem& System)
     {
-        for (auto& Orbit : Orbits)
+        for (std::uint32_t i = FirstOrbit; i != System.OrbitsData().size(); ++i)
         {
-            if (Orbit->GetPeriod())
+            auto& Orbit = System.OrbitsData()[i];
+            if (Orbit.GetPeriod())
             {
                 continue;
             }
 
-            float SemiMajorAxis = Orbit->GetSemiMajorAxis();
+            float SemiMajorAxis = Orbit.GetSemiMajorAxis();
             float CenterMass    = 0.0f;
-            if (Orbit->GetParent().GetObjectType() == Astro::FOrbit::EObjectType::kStar)
+            if (Orbit.GetParent().GetObjectType() == Astro::FOrbit::EObjectType::kStar)
             {
-                CenterMass = static_cast<float>(Orbit->GetParent().GetObject<Astro::AStar>()->GetMass());
+                CenterMass = static_cast<float>(System.GetObject<Astro::AStar>(Orbit.GetParent())->GetMass());
             }
-            else if (Orbit->GetParent().GetObjectType() == Astro::FOrbit::EObjectType::kPlanet)
+            else if (Orbit.GetParent().GetObjectType() == Astro::FOrbit::EObjectType::kPlanet)
             {
-                CenterMass = Orbit->GetParent().GetObject<Astro::APlanet>()->GetMassDigital<float>();
+                CenterMass = System.GetObject<Astro::APlanet>(Orbit.GetParent())->GetMassDigital<float>();
             }
 
             float Period =
                 static_cast<float>(std::sqrt(4.0 * std::pow(Math::kPi, 2.0) * std::pow(SemiMajorAxis, 3.0) / (kGravityConstant * CenterMass)));
-            Orbit->SetPeriod(Period);
+            Orbit.SetPeriod(Period);
 
-            for (auto& Object : Orbit->ObjectsData())
+            System.ForEachOrbitalObject(i, [&](std::uint32_t DetailsIndex) -> void
             {
-                if (Object.GetOrbitalObject().GetObjectType() == Astro::FOrbit::EObjectType::kPlanet)
+                const auto& Object = System.OrbitalDetailsData()[DetailsIndex].GetOrbitalObject();
+                if (Object.GetObjectType() == Astro::FOrbit::EObjectType::kPlanet)
                 {
-                    if (Object.GetOrbitalObject().GetObject<Astro::APlanet>()->GetSpin() <= 0)
+                    if (System.GetObject<Astro::APlanet>(Object)->GetSpin() <= 0)
                     {
-                        Object.GetOrbitalObject().GetObject<Astro::APlanet>()->SetSpin(Orbit->GetPeriod());
+                        System.GetObject<Astro::APlanet>(Object)->SetSpin(Orbit.GetPeriod());
                     }
                 }
-            }
+            });
         }
     }
 } // namespace Npgs
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <array>
 #include <expected>
 #include <memory>
+#include <memory_resource>
 #include <random>
 #include <vector>
 
@@ -52,82 +54,80 @@ namespace Npgs
 
     private:
         void GenerateBinaryOrbit(Astro::FOrbitalSystem& System);
-        void GeneratePlanets(std::size_t StarIndex, Astro::FOrbit::FOrbitalDetails& ParentStar, Astro::FOrbitalSystem& System);
+        void GeneratePlanets(std::size_t StarIndex, std::uint32_t ParentStar, Astro::FOrbitalSystem& System);
         std::expected<FPlanetaryDisk, int> GeneratePlanetaryDisk(const Astro::AStar* Star);
         std::size_t GeneratePlanetCount(const Astro::AStar* Star);
-        std::vector<float> GenerateCoreMassesSol(const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount);
+        std::pmr::vector<float> GenerateCoreMassesSol(const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount,
+                                                      std::pmr::memory_resource* MemoryResource);
 
-        std::vector<std::unique_ptr<Astro::FOrbit>>
-        GenerateOrbits(Astro::AStar* Star, const std::vector<float>& CoreMassesSol,
+        std::vector<Astro::FOrbit>
+        GenerateOrbits(std::size_t StarIndex, const std::pmr::vector<float>& CoreMassesSol,
                        const FPlanetaryDisk& PlanetaryDisk, std::size_t PlanetCount);
 
         float CalculatePlanetaryDiskAgeAndDetermineProtoplanetTypes(
-            const Astro::AStar* Star, const std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-            std::size_t PlanetCount, std::vector<float>& CoreMassesSol,
+            const Astro::AStar* Star, const std::vector<Astro::FOrbit>& Orbits,
+            std::size_t PlanetCount, std::pmr::vector<float>& CoreMassesSol,
             std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
 
         void EraseUnstablePlanets(Astro::FOrbitalSystem& System, std::size_t StarIndex, float BinarySemiMajorAxis,
-                                  std::size_t PlanetCount, std::vector<float>& CoreMassesSol, 
-                                  std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                  std::size_t& PlanetCount, std::pmr::vector<float>& CoreMassesSol, 
+                                  std::vector<Astro::FOrbit>& Orbits,
                                   std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
 
         void EraseLimitedPlanets(float Limit, std::size_t& PlanetCount,
-                                 std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                 std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                 std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                 std::vector<Astro::FOrbit>& Orbits,
                                  std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
 
         std::pair<float, float> CalculateHabitableZone(Astro::FOrbitalSystem& System, std::size_t StarIndex, float BinarySemiMajorAxis);
         float CalculateFrostLine(Astro::FOrbitalSystem& System, std::size_t StarIndex, float StarInitialMassSol, float BinarySemiMajorAxis);
         
         void MigratePlanets(const Astro::AStar* Star, const FPlanetaryDisk& PlanetaryDisk,
-                            std::size_t PlanetCount, float MigratedOriginSemiMajorAxisAu,
-                            std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                            std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                            std::size_t& PlanetCount, float MigratedOriginSemiMajorAxisAu,
+                            std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                            std::vector<Astro::FOrbit>& Orbits,
                             std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
 
-        void DevourPlanets(const Astro::AStar* Star, std::size_t PlanetCount,
-                           std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                           std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+        void DevourPlanets(const Astro::AStar* Star, std::size_t& PlanetCount,
+                           std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                           std::vector<Astro::FOrbit>& Orbits,
                            std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
         
         void GenerateOrbitElements(Astro::FOrbit& Orbit);
 
-        std::size_t JudgeLargePlanets(std::size_t StarIndex, const std::vector<std::unique_ptr<Astro::AStar>>& StarData,
+        std::size_t JudgeLargePlanets(std::size_t StarIndex, const std::vector<Astro::AStar>& StarData,
                                       float BinarySemiMajorAxis, float InnerHabitableZoneRadiusAu, float FrostLineAu,
-                                      std::vector<float>& CoreMassesSol, std::vector<float>& NewCoreMassesSol,
-                                      std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
+                                      std::pmr::vector<float>& CoreMassesSol, std::pmr::vector<float>& NewCoreMassesSol,
+                                      std::vector<Astro::FOrbit>& Orbits,
                                       std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
 
         float CalculatePlanetMass(float CoreMass, float NewCoreMass, float SemiMajorAxisAu,
                                   const FPlanetaryDisk& PlanetaryDiskTempData, const Astro::AStar* Star, Astro::APlanet* Planet);
 
         void CalculatePlanetRadius(float MassEarth, Astro::APlanet* Planet);
-        void GenerateSpin(float SemiMajorAxis, const Astro::FOrbit::FOrbitalObject& Parent, Astro::APlanet* Planet);
+        void GenerateSpin(float SemiMajorAxis, const Astro::FOrbitalSystem& System,
+                          const Astro::FOrbit::FOrbitalObject& Parent, Astro::APlanet* Planet);
         void CalculateTemperature(const Astro::FOrbit::EObjectType ParentType, float PoyntingVector, Astro::APlanet* Planet);
 
         void GenerateMoons(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star, float PoyntingVector,
-                           const std::pair<float, float>& HabitableZoneAu, Astro::FOrbit::FOrbitalDetails& ParentPlanet,
-                           std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits, std::vector<std::unique_ptr<Astro::APlanet>>& Planets);
+                           const std::pair<float, float>& HabitableZoneAu, std::uint32_t ParentPlanet,
+                           const std::vector<Astro::FOrbit>& Orbits, Astro::FOrbitalSystem& System);
 
-        void GenerateRings(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star,
-                           Astro::FOrbit::FOrbitalDetails& ParentPlanet, std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-                           std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters);
+        void GenerateRings(std::size_t PlanetIndex, float FrostLineAu, const Astro::AStar* Star, std::uint32_t ParentPlanet,
+                           const std::vector<Astro::FOrbit>& Orbits, Astro::FOrbitalSystem& System);
 
         void GenerateTerra(const Astro::AStar* Star, float PoyntingVector, const std::pair<float, float>& HabitableZoneAu,
                            const Astro::FOrbit* Orbit, Astro::APlanet* Planet);
 
-        void GenerateTrojan(const Astro::AStar* Star, float FrostLineAu, Astro::FOrbit* Orbit,
-                            Astro::FOrbit::FOrbitalDetails& ParentPlanet,
-                            std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters);
+        void GenerateTrojan(const Astro::AStar* Star, float FrostLineAu, std::uint32_t ParentPlanet, Astro::FOrbitalSystem& System);
 
-        void GenerateKuiperBelt(Astro::AStar* Star, float FrostLineAu, const FPlanetaryDisk& PlanetaryDisk,
-                                std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits,
-                                std::vector<std::unique_ptr<Astro::AAsteroidCluster>>& AsteroidClusters);
+        void GenerateKuiperBelt(std::size_t StarIndex, float FrostLineAu, const FPlanetaryDisk& PlanetaryDisk,
+                                std::uint32_t ParentStar, Astro::FOrbitalSystem& System);
 
         void GenerateCivilization(const Astro::AStar* Star, float PoyntingVector, const std::pair<float, float>& HabitableZoneAu,
                                   const Astro::FOrbit* Orbit, Astro::APlanet* Planet);
 
-        void CalculateOrbitalPeriods(std::vector<std::unique_ptr<Astro::FOrbit>>& Orbits);
+        void CalculateOrbitalPeriods(std::uint32_t FirstOrbit, Astro::FOrbitalSystem& System);
 
     private:
         std::mt19937                                  RandomEngine_;
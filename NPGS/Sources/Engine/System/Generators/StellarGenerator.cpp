@@ -19,6 +19,7 @@
 #include "Engine/Core/Logger.hpp"
 #include "Engine/Runtime/AssetLoaders/CommaSeparatedValues.hpp"
 #include "Engine/Runtime/Managers/AssetManager.hpp"
+#include "Engine/Runtime/Pools/ThreadPool.hpp"
 #include "Engine/System/Services/EngineServices.hpp"
 
 namespace Npgs
@@ -250,6 +251,7 @@ namespace Npgs
         , MassDistribution_(std::exchange(Other.MassDistribution_, {}))
         , StellarTypeOption_(std::exchange(Other.StellarTypeOption_, {}))
         , MultiplicityOption_(std::exchange(Other.MultiplicityOption_, {}))
+        , MistReplicaCache_(std::move(Other.MistReplicaCache_))
     {
     }
 
@@ -337,6 +339,7 @@ namespace Npgs
             MassDistribution_                    = std::exchange(Other.MassDistribution_, {});
             StellarTypeOption_                   = std::exchange(Other.StellarTypeOption_, {});
             MultiplicityOption_                  = std::exchange(Other.MultiplicityOption_, {});
+            MistReplicaCache_                    = std::move(Other.MistReplicaCache_);
         }
 
         return *this;
@@ -523,15 +526,44 @@ namespace Npgs
     requires std::is_class_v<CsvType>
     TAssetHandle<CsvType> FStellarGenerator::LoadCsvAsset(const std::string& Filename, std::span<const std::string> Headers) const
     {
+        // 开启复制时每个 NUMA 节点使用各自的 MIST 数据副本，插值查表不再跨节点访问
+        // 解析到的句柄按节点缓存在生成器中，同一张表只向资产管理器查询一次
+        auto NumaNode = FThreadPool::GetCurrentNumaNode();
+        if (MistReplicaCache_.NumaNode != NumaNode)
+        {
+            MistReplicaCache_.MistData.clear();
+            MistReplicaCache_.WdMistData.clear();
+            MistReplicaCache_.NumaNode = NumaNode;
+        }
+
+        auto& Cache = [this]() -> auto&
+        {
+            if constexpr (std::is_same_v<CsvType, FWdMistData>)
+            {
+                return MistReplicaCache_.WdMistData;
+            }
+            else
+            {
+                return MistReplicaCache_.MistData;
+            }
+        }();
+
+        auto it = Cache.find(Filename);
+        if (it != Cache.end())
+        {
+            return it->second;
+        }
+
         auto* AssetManager = EngineCoreServices->GetAssetManager();
-        auto  Asset = AssetManager->AcquireAsset<CsvType>(Filename);
-        if (Asset)
+        auto  Asset        = AssetManager->AcquireNodeReplica<CsvType>(Filename, NumaNode);
+        if (!Asset)
         {
-            return Asset;
+            AssetManager->AddAsset<CsvType>(Filename, CsvType(Filename, Headers));
+            Asset = AssetManager->AcquireNodeReplica<CsvType>(Filename, NumaNode);
         }
 
-        AssetManager->AddAsset<CsvType>(Filename, CsvType(Filename, Headers));
-        return AssetManager->AcquireAsset<CsvType>(Filename);
+        Cache.emplace(Filename, Asset);
+        return Asset;
     }
 
     void FStellarGenerator::InitializeMistData() const
@@ -9,6 +9,7 @@
 #include <random>
 #include <shared_mutex>
 #include <span>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -207,6 +208,15 @@ namespace Npgs
             float Gamma;
         };
 
+        // 每个生成器缓存当前 NUMA 节点上的 MIST 表句柄，插值热路径不再逐颗恒星查询资产管理器
+        // 生成器只在单个线程上使用，线程迁移到其他节点时整体失效重建
+        struct FMistReplicaCache
+        {
+            ankerl::unordered_dense::map<std::string, TAssetHandle<FMistData>>   MistData;
+            ankerl::unordered_dense::map<std::string, TAssetHandle<FWdMistData>> WdMistData;
+            std::uint32_t NumaNode{ std::numeric_limits<std::uint32_t>::max() };
+        };
+
     private:
         template <typename CsvType>
         requires std::is_class_v<CsvType>
@@ -312,6 +322,8 @@ namespace Npgs
         EStellarTypeGenerationOption  StellarTypeOption_;
         EMultiplicityGenerationOption MultiplicityOption_;
 
+        mutable FMistReplicaCache MistReplicaCache_;
+
         static const std::array<std::string, 12> kMistHeaders_;
         static const std::array<std::string, 5>  kWdMistHeaders_;
 
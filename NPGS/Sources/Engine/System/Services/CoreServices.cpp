@@ -7,7 +7,8 @@ namespace Npgs
         : VulkanContext_(std::make_unique<FVulkanContext>())
         , AssetManager_(std::make_unique<FAssetManager>(VulkanContext_.get()))
         , ThreadPool_(std::make_unique<FThreadPool>(
-            EnableInfo.ThreadPoolCreateInfo->MaxThreadCount, EnableInfo.ThreadPoolCreateInfo->bEnableHyperThread))
+            EnableInfo.ThreadPoolCreateInfo->MaxThreadCount, EnableInfo.ThreadPoolCreateInfo->bEnableHyperThread,
+            EnableInfo.ThreadPoolCreateInfo->AffinityPolicy))
     {
     }
 } // namespace Npgs
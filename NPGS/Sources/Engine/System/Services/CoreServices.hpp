@@ -15,6 +15,7 @@ namespace Npgs
         {
             int MaxThreadCount{};
             bool bEnableHyperThread{ false };
+            EThreadAffinityPolicy AffinityPolicy{ EThreadAffinityPolicy::kOnePerCore };
         };
 
         struct FCoreServicesEnableInfo
@@ -5,19 +5,29 @@
 #include <array>
 #include <atomic>
 #include <concepts>
+#include <cstdint>
 #include <functional>
-#include <future>
+#include <limits>
 #include <mutex>
+#include <span>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 
+#include "Engine/Core/Base/Assert.hpp"
 #include "Engine/Runtime/Pools/MemoryPool.hpp"
+#include "Engine/Runtime/Pools/Task.hpp"
 #include "Engine/Runtime/Pools/ThreadPool.hpp"
 #include "Engine/System/Services/EngineServices.hpp"
 
+// Octree memory pool
+// ------------------
+// 子节点从地址稳定的 TMemoryPool 分配，并行构建空树时各线程直接分配节点，不经过全局堆
+// 注释掉此定义时改用 std::unique_ptr 逐个分配
+#define OCTREE_USE_MEMORY_POOL
+
 #ifdef OCTREE_USE_MEMORY_POOL
 #define GetNextNode(Node, i) Node->GetNext(i).Get()
 #else
@@ -26,6 +36,12 @@
 
 namespace Npgs
 {
+    using FOctreeObjectId = std::uint32_t;
+
+    // 节点链接到外部数据的稳定序号，由使用者解释（例如 FUniverse 中的星系序号），外部容器重新分配不会使链接失效
+    using FOctreeLinkId = std::uint32_t;
+    constexpr FOctreeLinkId kOctreeInvalidLink = std::numeric_limits<FOctreeLinkId>::max();
+
     namespace
     {
         std::size_t CalculateMemoryPoolCapacity(int MaxDepth)
@@ -40,7 +56,15 @@ namespace Npgs
         }
     }
 
-    template <typename LinkTargetType>
+    // 不需要节点聚合数据时使用的空类型
+    struct FOctreeEmptyAggregate
+    {
+        void Merge(const FOctreeEmptyAggregate&)
+        {
+        }
+    };
+
+    template <typename AggregateType = FOctreeEmptyAggregate>
     class TOctreeNode
     {
     public:
@@ -56,6 +80,14 @@ namespace Npgs
                     Point.z >= Center_.z - Radius_ && Point.z <= Center_.z + Radius_);
         }
 
+        // 松散边界，半径放大为 Radius * LooseFactor，用于判断移动对象是否需要换节点
+        bool LooseContains(glm::vec3 Point, float LooseFactor) const
+        {
+            glm::vec3 Distance = glm::abs(Point - Center_);
+            float     Extent   = Radius_ * LooseFactor;
+            return Distance.x <= Extent && Distance.y <= Extent && Distance.z <= Extent;
+        }
+
         int CalculateOctant(glm::vec3 Point) const
         {
             int Octant = 0;
@@ -91,10 +123,10 @@ namespace Npgs
             return Octant;
         }
 
-        bool IntersectSphere(glm::vec3 Point, float Radius) const
+        bool IntersectSphere(glm::vec3 Point, float Radius, float LooseFactor = 1.0f) const
         {
-            glm::vec3 MinBound = Center_ - glm::vec3(Radius_);
-            glm::vec3 MaxBound = Center_ + glm::vec3(Radius_);
+            glm::vec3 MinBound = Center_ - glm::vec3(Radius_ * LooseFactor);
+            glm::vec3 MaxBound = Center_ + glm::vec3(Radius_ * LooseFactor);
 
             glm::vec3 ClosestPoint = glm::clamp(Point, MinBound, MaxBound);
             float Distance = glm::distance(Point, ClosestPoint);
@@ -168,24 +200,45 @@ namespace Npgs
             Points_.clear();
         }
 
-        void AddLink(LinkTargetType* Target)
+        std::uint32_t AddObject(FOctreeObjectId Id)
+        {
+            Objects_.push_back(Id);
+            return static_cast<std::uint32_t>(Objects_.size() - 1);
+        }
+
+        // 与末尾元素交换后删除，返回被换到 Slot 位置的对象 Id，没有发生交换时返回 Id 本身
+        FOctreeObjectId RemoveObject(std::uint32_t Slot)
+        {
+            FOctreeObjectId Moved = Objects_.back();
+            Objects_[Slot] = Moved;
+            Objects_.pop_back();
+            return Moved;
+        }
+
+        const std::vector<FOctreeObjectId>& GetObjects() const
+        {
+            return Objects_;
+        }
+
+        void AddLink(FOctreeLinkId Link)
         {
-            DataLink_.push_back(Target);
+            DataLink_.push_back(Link);
         }
 
+        // 返回第一个满足 Pred 的链接，没有时返回 kOctreeInvalidLink
         template <typename Func>
-        requires std::predicate<Func, const LinkTargetType*> || std::predicate<Func, LinkTargetType*> || std::predicate<Func, void*>
-        LinkTargetType* GetLink(Func&& Pred) const
+        requires std::predicate<Func, FOctreeLinkId>
+        FOctreeLinkId GetLink(Func&& Pred) const
         {
-            for (LinkTargetType* Target : DataLink_)
+            for (FOctreeLinkId Link : DataLink_)
             {
-                if (Pred(Target))
+                if (Pred(Link))
                 {
-                    return Target;
+                    return Link;
                 }
             }
 
-            return nullptr;
+            return kOctreeInvalidLink;
         }
 
         void RemoveLinks()
@@ -193,6 +246,21 @@ namespace Npgs
             DataLink_.clear();
         }
 
+        const std::vector<FOctreeLinkId>& GetLinks() const
+        {
+            return DataLink_;
+        }
+
+        AggregateType& GetAggregate()
+        {
+            return Aggregate_;
+        }
+
+        const AggregateType& GetAggregate() const
+        {
+            return Aggregate_;
+        }
+
         std::vector<glm::vec3>& GetPoints()
         {
             return Points_;
@@ -237,20 +305,32 @@ namespace Npgs
         std::array<std::unique_ptr<TOctreeNode>, 8> Next_;
 #endif // OCTREE_USE_MEMORY_POOL
         std::vector<glm::vec3>       Points_;
-        std::vector<LinkTargetType*> DataLink_;
+        std::vector<FOctreeObjectId> Objects_;
+        std::vector<FOctreeLinkId>   DataLink_;
+        AggregateType                Aggregate_{};
     };
 
-    template <typename LinkTargetType>
+    template <typename AggregateType = FOctreeEmptyAggregate>
     class TOctree
     {
     public:
-        using FNodeType = TOctreeNode<LinkTargetType>;
+        using FNodeType = TOctreeNode<AggregateType>;
+        using FObjectId = FOctreeObjectId;
+
+        struct FObjectMove
+        {
+            FObjectId Id;
+            glm::vec3 Position;
+        };
+
+        static constexpr float       kLooseFactor           = 2.0f;
+        static constexpr std::size_t kParallelMoveBatchSize = 4096;
 
     public:
         TOctree(glm::vec3 Center, float Radius, int MaxDepth = 8)
             : ThreadPool_(EngineCoreServices->GetThreadPool())
 #ifdef OCTREE_USE_MEMORY_POOL
-            , MemoryPool_(CalculateMemoryPoolCapacity(MaxDepth))
+            , MemoryPool_(0)
 #endif // OCTREE_USE_MEMORY_POOL
             , Root_(std::make_unique<FNodeType>(Center, Radius, nullptr))
             , MaxDepth_(MaxDepth)
@@ -260,7 +340,11 @@ namespace Npgs
         void BuildEmptyTree(float LeafRadius)
         {
             int Depth = static_cast<int>(std::ceil(std::log2(Root_->GetRadius() / LeafRadius)));
-            BuildEmptyTreeImpl(Root_.get(), LeafRadius, Depth);
+#ifdef OCTREE_USE_MEMORY_POOL
+            // 按实际构建的深度一次预留全部子节点，而不是按 MaxDepth 预留整棵满树，并行构建期间不再扩容
+            MemoryPool_.Reserve(CalculateMemoryPoolCapacity(Depth));
+#endif // OCTREE_USE_MEMORY_POOL
+            SyncWait(*ThreadPool_, BuildEmptyTreeAsync(Root_.get(), LeafRadius, Depth));
         }
 
         void Insert(glm::vec3 Point)
@@ -278,6 +362,101 @@ namespace Npgs
             QueryImpl(Root_.get(), Point, Radius, Results);
         }
 
+        // 可移动对象，Id 在对象存活期间保持不变，删除后会被回收复用
+        // 对象存储在包含其位置的最深节点中，移动时只要仍在节点的松散边界内就不换节点
+        FObjectId InsertObject(glm::vec3 Position)
+        {
+            FObjectId Id = 0;
+            if (!FreeObjectIds_.empty())
+            {
+                Id = FreeObjectIds_.back();
+                FreeObjectIds_.pop_back();
+            }
+            else
+            {
+                Id = static_cast<FObjectId>(Objects_.size());
+                Objects_.emplace_back();
+            }
+
+            auto& Record    = Objects_[Id];
+            Record.Position = Position;
+            Record.Node     = LocateObjectNode(Root_.get(), Position);
+            Record.Slot     = Record.Node->AddObject(Id);
+            return Id;
+        }
+
+        // 重复删除或传入已回收的 Id 时断言，发布版本中忽略
+        void RemoveObject(FObjectId Id)
+        {
+            bool bAlive = Id < Objects_.size() && Objects_[Id].Node != nullptr;
+            NpgsAssert(bAlive, "Octree object removed twice or never inserted.");
+            if (!bAlive)
+            {
+                return;
+            }
+
+            DetachObject(Id);
+            Objects_[Id].Node = nullptr;
+            FreeObjectIds_.push_back(Id);
+        }
+
+        void MoveObject(FObjectId Id, glm::vec3 Position)
+        {
+            NpgsAssert(Id < Objects_.size() && Objects_[Id].Node != nullptr, "Octree object moved after being removed.");
+            auto& Record    = Objects_[Id];
+            Record.Position = Position;
+            if (!Record.Node->LooseContains(Position, kLooseFactor))
+            {
+                RelocateObject(Id, LocateObjectNode(Record.Node, Position));
+            }
+        }
+
+        // 批量移动，每帧调用一次。先并行更新位置并计算目标节点（只读访问树结构），
+        // 再串行处理少量越过松散边界的对象。同一批次中 Id 不能重复
+        void ApplyMoves(std::span<const FObjectMove> Moves)
+        {
+            std::vector<FNodeType*> Targets(Moves.size(), nullptr);
+
+            auto UpdateRange = [this, Moves, &Targets](std::size_t Begin, std::size_t End) -> void
+            {
+                for (std::size_t i = Begin; i != End; ++i)
+                {
+                    auto& Record    = Objects_[Moves[i].Id];
+                    Record.Position = Moves[i].Position;
+                    if (!Record.Node->LooseContains(Record.Position, kLooseFactor))
+                    {
+                        Targets[i] = LocateObjectNode(Record.Node, Record.Position);
+                    }
+                }
+            };
+
+            ThreadPool_->ParallelFor(0, Moves.size(), kParallelMoveBatchSize, UpdateRange);
+
+            for (std::size_t i = 0; i != Moves.size(); ++i)
+            {
+                if (Targets[i] != nullptr)
+                {
+                    RelocateObject(Moves[i].Id, Targets[i]);
+                }
+            }
+        }
+
+        // 查询位置落在球内的对象。对象可以越出所在节点的严格边界，子节点按松散边界剪枝
+        void QueryObjects(glm::vec3 Point, float Radius, std::vector<FObjectId>& Results) const
+        {
+            QueryObjectsImpl(Root_.get(), Point, Radius, Results);
+        }
+
+        glm::vec3 GetObjectPosition(FObjectId Id) const
+        {
+            return Objects_[Id].Position;
+        }
+
+        const FNodeType* GetObjectNode(FObjectId Id) const
+        {
+            return Objects_[Id].Node;
+        }
+
         template <typename Func = std::function<bool(const FNodeType&)>>
         requires std::predicate<Func, const FNodeType&> || std::predicate<Func, FNodeType&>
         FNodeType* Find(glm::vec3 Point, Func&& Pred = [](const FNodeType&) -> bool { return true; }) const
@@ -290,8 +469,43 @@ namespace Npgs
         void Traverse(Func&& Pred) const
         {
             std::mutex Mutex;
-            bool bParallel = MaxDepth_ >= 10 ? true : false;
-            TraverseImpl(Root_.get(), Mutex, bParallel, std::forward<Func>(Pred));
+            if (MaxDepth_ >= 10)
+            {
+                SyncWait(*ThreadPool_, TraverseAsync(Root_.get(), Mutex, Pred));
+            }
+            else
+            {
+                TraverseImpl(Root_.get(), Mutex, Pred);
+            }
+        }
+
+        // 自底向上构建所有节点的聚合数据，叶子节点由 LeafAggregator 生成，内部节点合并 8 个子节点
+        // 根节点的子树并行构建，LeafAggregator 会被多个线程同时调用
+        template <typename Func>
+        requires std::is_invocable_r_v<AggregateType, Func, const FNodeType&>
+        void BuildAggregates(Func&& LeafAggregator)
+        {
+            BuildAggregatesImpl(Root_.get(), LeafAggregator, true);
+        }
+
+        // 叶子节点内容变化后，重新生成该叶子的聚合数据并沿父节点链更新到根
+        template <typename Func>
+        requires std::is_invocable_r_v<AggregateType, Func, const FNodeType&>
+        void UpdateAggregates(FNodeType* Leaf, Func&& LeafAggregator)
+        {
+            Leaf->GetAggregate() = LeafAggregator(*Leaf);
+            for (FNodeType* Node = Leaf->GetPrevious(); Node != nullptr; Node = Node->GetPrevious())
+            {
+                Node->GetAggregate() = MergeChildAggregates(Node);
+            }
+        }
+
+        // 按细节层次遍历，Pred 返回 true 时继续访问子节点，返回 false 时以当前节点的聚合数据代替整棵子树
+        template <typename Func>
+        requires std::predicate<Func, const FNodeType&>
+        void TraverseLod(Func&& Pred) const
+        {
+            TraverseLodImpl(Root_.get(), Pred);
         }
 
         std::size_t GetCapacity() const
@@ -311,6 +525,83 @@ namespace Npgs
         }
 
     private:
+        struct FObjectRecord
+        {
+            FNodeType*    Node{ nullptr };
+            glm::vec3     Position{};
+            std::uint32_t Slot{};
+        };
+
+    private:
+        // 从 Node 开始向上找到严格包含 Position 的节点，再沿已有子节点向下找到最深的包含节点
+        // 位置在根节点之外时返回根节点
+        FNodeType* LocateObjectNode(FNodeType* Node, glm::vec3 Position) const
+        {
+            while (Node->GetPrevious() != nullptr && !Node->Contains(Position))
+            {
+                Node = Node->GetPrevious();
+            }
+
+            while (!Node->IsLeafNode())
+            {
+                FNodeType* NextNode = GetNextNode(Node, Node->CalculateOctant(Position));
+                if (NextNode == nullptr || !NextNode->Contains(Position))
+                {
+                    break;
+                }
+
+                Node = NextNode;
+            }
+
+            return Node;
+        }
+
+        void DetachObject(FObjectId Id)
+        {
+            auto& Record = Objects_[Id];
+            FObjectId Moved = Record.Node->RemoveObject(Record.Slot);
+            if (Moved != Id)
+            {
+                Objects_[Moved].Slot = Record.Slot;
+            }
+        }
+
+        void RelocateObject(FObjectId Id, FNodeType* Target)
+        {
+            auto& Record = Objects_[Id];
+            if (Record.Node == Target)
+            {
+                return;
+            }
+
+            DetachObject(Id);
+            Record.Node = Target;
+            Record.Slot = Target->AddObject(Id);
+        }
+
+        // 根节点的 8 棵子树作为协程并行构建，等待期间不阻塞工作线程
+        TTask<void> BuildEmptyTreeAsync(FNodeType* Node, float LeafRadius, int Depth)
+        {
+            if (Node->GetRadius() <= LeafRadius || Depth == 0)
+            {
+                co_return;
+            }
+
+            CreateChildren(Node);
+
+            std::vector<TTask<void>> Tasks;
+            Tasks.reserve(8);
+            for (int i = 0; i != 8; ++i)
+            {
+                Tasks.push_back(RunAsync(*ThreadPool_, [this, NextNode = GetNextNode(Node, i), LeafRadius, Depth]() -> void
+                {
+                    BuildEmptyTreeImpl(NextNode, LeafRadius, Depth - 1);
+                }));
+            }
+
+            co_await WhenAll(std::move(Tasks));
+        }
+
         void BuildEmptyTreeImpl(FNodeType* Node, float LeafRadius, int Depth)
         {
             if (Node->GetRadius() <= LeafRadius || Depth == 0)
@@ -318,7 +609,15 @@ namespace Npgs
                 return;
             }
 
-            std::vector<std::future<void>> Futures;
+            CreateChildren(Node);
+            for (int i = 0; i != 8; ++i)
+            {
+                BuildEmptyTreeImpl(GetNextNode(Node, i), LeafRadius, Depth - 1);
+            }
+        }
+
+        void CreateChildren(FNodeType* Node)
+        {
             float NextRadius = Node->GetRadius() * 0.5f;
             for (int i = 0; i != 8; ++i)
             {
@@ -349,19 +648,6 @@ namespace Npgs
 #else
                 Node->GetNext(i) = std::make_unique<FNodeType>(Node->GetCenter() + Offset, NextRadius, Node);
 #endif // OCTREE_USE_MEMORY_POOL
-                if (Depth == static_cast<int>(std::ceil(std::log2(Root_->GetRadius() / LeafRadius))))
-                {
-                    Futures.push_back(ThreadPool_->Submit(&TOctree::BuildEmptyTreeImpl, this, GetNextNode(Node, i), LeafRadius, Depth - 1));
-                }
-                else
-                {
-                    BuildEmptyTreeImpl(GetNextNode(Node, i), LeafRadius, Depth - 1);
-                }
-            }
-
-            for (auto& Future : Futures)
-            {
-                Future.get();
             }
         }
 
@@ -447,17 +733,36 @@ namespace Npgs
                 {
                     for (int i = 0; i != 8; ++i)
                     {
-                        auto& Next = Node->GetNext(i);
 #ifdef OCTREE_USE_MEMORY_POOL
-                        Next.~FMemoryGuard();
+                        Node->GetNext(i).Reset();
 #else
-                        Next.reset();
+                        Node->GetNext(i).reset();
 #endif // OCTREE_USE_MEMORY_POOL
                     }
                 }
             }
         }
 
+        void QueryObjectsImpl(const FNodeType* Node, glm::vec3 Point, float Radius, std::vector<FObjectId>& Results) const
+        {
+            for (FObjectId Id : Node->GetObjects())
+            {
+                if (glm::distance(Objects_[Id].Position, Point) <= Radius)
+                {
+                    Results.push_back(Id);
+                }
+            }
+
+            for (int i = 0; i != 8; ++i)
+            {
+                const FNodeType* NextNode = GetNextNode(Node, i);
+                if (NextNode != nullptr && NextNode->IntersectSphere(Point, Radius, kLooseFactor))
+                {
+                    QueryObjectsImpl(NextNode, Point, Radius, Results);
+                }
+            }
+        }
+
         void QueryImpl(FNodeType* Node, glm::vec3 Point, float Radius, std::vector<glm::vec3>& Results) const
         {
             if (Node == nullptr || Node->GetNext(0) == nullptr)
@@ -486,17 +791,15 @@ namespace Npgs
         template <typename Func>
         FNodeType* FindImpl(FNodeType* Node, glm::vec3 Point, Func&& Pred) const
         {
-            if (Node == nullptr)
+            // 子节点都在父节点的边界内，不包含 Point 的子树整体跳过，只沿包含 Point 的路径下降
+            if (Node == nullptr || !Node->Contains(Point))
             {
                 return nullptr;
             }
 
-            if (Node->Contains(Point))
+            if (Pred(*Node))
             {
-                if (Pred(*Node))
-                {
-                    return Node;
-                }
+                return Node;
             }
 
             for (int i = 0; i != 8; ++i)
@@ -512,7 +815,28 @@ namespace Npgs
         }
 
         template <typename Func>
-        void TraverseImpl(FNodeType* Node, std::mutex& Mutex, bool bParallel, Func&& Pred) const
+        TTask<void> TraverseAsync(FNodeType* Node, std::mutex& Mutex, Func& Pred) const
+        {
+            {
+                std::lock_guard Lock(Mutex);
+                Pred(*Node);
+            }
+
+            std::vector<TTask<void>> Tasks;
+            Tasks.reserve(8);
+            for (int i = 0; i != 8; ++i)
+            {
+                Tasks.push_back(RunAsync(*ThreadPool_, [this, NextNode = GetNextNode(Node, i), &Mutex, &Pred]() -> void
+                {
+                    TraverseImpl(NextNode, Mutex, Pred);
+                }));
+            }
+
+            co_await WhenAll(std::move(Tasks));
+        }
+
+        template <typename Func>
+        void TraverseImpl(FNodeType* Node, std::mutex& Mutex, Func& Pred) const
         {
             if (Node == nullptr)
             {
@@ -524,30 +848,9 @@ namespace Npgs
                 Pred(*Node);
             }
 
-            if (bParallel)
-            {
-                bParallel = false;
-                std::vector<std::future<void>> Futures;
-                for (int i = 0; i != 8; ++i)
-                {
-                    auto* NextNode = GetNextNode(Node, i);
-                    Futures.push_back(ThreadPool_->Submit([this, NextNode, &Mutex, bParallel, Pred]() -> void
-                    {
-                        this->TraverseImpl(NextNode, Mutex, bParallel, Pred);
-                    }));
-                }
-
-                for (auto& Future : Futures)
-                {
-                    Future.get();
-                }
-            }
-            else
+            for (int i = 0; i != 8; ++i)
             {
-                for (int i = 0; i != 8; ++i)
-                {
-                    TraverseImpl(GetNextNode(Node, i), Mutex, bParallel, Pred);
-                }
+                TraverseImpl(GetNextNode(Node, i), Mutex, Pred);
             }
         }
 
@@ -563,30 +866,91 @@ namespace Npgs
                 return Node->IsValid() ? 1 : 0;
             }
 
-            std::atomic<std::size_t> Capacity = 0;
             if (bParallel)
             {
-                bParallel = false;
-                std::vector<std::future<std::size_t>> Futures;
-                for (int i = 0; i != 8; ++i)
+                return ThreadPool_->ParallelReduce(0, 8, 1, std::size_t{ 0 },
+                [this, Node](std::size_t Begin, std::size_t End, std::size_t Capacity) -> std::size_t
                 {
-                    Futures.push_back(ThreadPool_->Submit(&TOctree::GetCapacityImpl, this, GetNextNode(Node, i), bParallel));
-                }
+                    for (std::size_t i = Begin; i != End; ++i)
+                    {
+                        Capacity += GetCapacityImpl(GetNextNode(Node, static_cast<int>(i)), false);
+                    }
+
+                    return Capacity;
+                }, std::plus<>{});
+            }
+
+            std::size_t Capacity = 0;
+            for (int i = 0; i != 8; ++i)
+            {
+                Capacity += GetCapacityImpl(GetNextNode(Node, i), false);
+            }
+
+            return Capacity;
+        }
+
+        template <typename Func>
+        void BuildAggregatesImpl(FNodeType* Node, Func& LeafAggregator, bool bParallel)
+        {
+            if (Node->IsLeafNode())
+            {
+                Node->GetAggregate() = LeafAggregator(static_cast<const FNodeType&>(*Node));
+                return;
+            }
 
-                for (auto& Future : Futures)
+            if (bParallel)
+            {
+                ThreadPool_->ParallelFor(0, 8, 1, [this, Node, &LeafAggregator](std::size_t i) -> void
                 {
-                    Capacity += Future.get();
-                }
+                    FNodeType* NextNode = GetNextNode(Node, static_cast<int>(i));
+                    if (NextNode != nullptr)
+                    {
+                        BuildAggregatesImpl(NextNode, LeafAggregator, false);
+                    }
+                });
             }
             else
             {
                 for (int i = 0; i != 8; ++i)
                 {
-                    Capacity += GetCapacityImpl(GetNextNode(Node, i), bParallel);
+                    FNodeType* NextNode = GetNextNode(Node, i);
+                    if (NextNode != nullptr)
+                    {
+                        BuildAggregatesImpl(NextNode, LeafAggregator, false);
+                    }
                 }
             }
 
-            return Capacity;
+            Node->GetAggregate() = MergeChildAggregates(Node);
+        }
+
+        AggregateType MergeChildAggregates(const FNodeType* Node) const
+        {
+            AggregateType Aggregate{};
+            for (int i = 0; i != 8; ++i)
+            {
+                const FNodeType* NextNode = GetNextNode(Node, i);
+                if (NextNode != nullptr)
+                {
+                    Aggregate.Merge(NextNode->GetAggregate());
+                }
+            }
+
+            return Aggregate;
+        }
+
+        template <typename Func>
+        void TraverseLodImpl(const FNodeType* Node, Func& Pred) const
+        {
+            if (Node == nullptr || !Pred(*Node))
+            {
+                return;
+            }
+
+            for (int i = 0; i != 8; ++i)
+            {
+                TraverseLodImpl(GetNextNode(Node, i), Pred);
+            }
         }
 
         std::size_t GetSizeImpl(const FNodeType* Node) const
@@ -611,6 +975,8 @@ namespace Npgs
 #endif // OCTREE_USE_MEMORY_POOL
         FThreadPool*               ThreadPool_;
         std::unique_ptr<FNodeType> Root_;
+        std::vector<FObjectRecord> Objects_;
+        std::vector<FObjectId>     FreeObjectIds_;
         int                        MaxDepth_;
     };
 } // namespace Npgs
@@ -0,0 +1,230 @@
+#include "stdafx.h"
+#include "PoissonDiskSampler.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+#include "Engine/Core/Base/Assert.hpp"
+#include "Engine/Core/Math/Random.hpp"
+#include "Engine/System/Services/EngineServices.hpp"
+
+namespace Npgs
+{
+    namespace
+    {
+        constexpr std::uint32_t kInvalidSlot          = std::numeric_limits<std::uint32_t>::max();
+        constexpr std::uint64_t kEmptyKey             = std::numeric_limits<std::uint64_t>::max();
+        constexpr int           kCoordBits            = 21;
+        constexpr std::size_t   kMinCellCountPerChunk = 4096;
+    }
+
+    // 格子坐标到采样序号的开放寻址哈希表，内存只与采样格子数量成正比，与网格体积无关
+    class FPoissonDiskSampler::FCellTable
+    {
+    public:
+        explicit FCellTable(std::size_t Count)
+            : Mask_(std::bit_ceil(std::max<std::size_t>(Count * 2, 16)) - 1)
+            , Keys_(Mask_ + 1, kEmptyKey)
+            , Slots_(Mask_ + 1, kInvalidSlot)
+        {
+        }
+
+        bool Insert(std::uint64_t Key, std::uint32_t Slot)
+        {
+            for (std::size_t i = Hash(Key); ; i = (i + 1) & Mask_)
+            {
+                if (Keys_[i] == kEmptyKey)
+                {
+                    Keys_[i]  = Key;
+                    Slots_[i] = Slot;
+                    return true;
+                }
+
+                if (Keys_[i] == Key)
+                {
+                    return false;
+                }
+            }
+        }
+
+        std::uint32_t Find(std::uint64_t Key) const
+        {
+            for (std::size_t i = Hash(Key); ; i = (i + 1) & Mask_)
+            {
+                if (Keys_[i] == Key)
+                {
+                    return Slots_[i];
+                }
+
+                if (Keys_[i] == kEmptyKey)
+                {
+                    return kInvalidSlot;
+                }
+            }
+        }
+
+    private:
+        std::size_t Hash(std::uint64_t Key) const
+        {
+            return static_cast<std::size_t>(Math::SplitMix64(Key)) & Mask_;
+        }
+
+    private:
+        std::size_t                Mask_;
+        std::vector<std::uint64_t> Keys_;
+        std::vector<std::uint32_t> Slots_;
+    };
+
+    FPoissonDiskSampler::FPoissonDiskSampler(const FCreateInfo& CreateInfo)
+        : CreateInfo_(CreateInfo)
+        , ThreadPool_(EngineCoreServices->GetThreadPool())
+    {
+        NpgsAssert(CreateInfo_.CellSize > 0.0f, "Cell size must be positive.");
+        NpgsAssert(CreateInfo_.GridDim > 0 && CreateInfo_.GridDim <= (1 << kCoordBits), "Grid dimension out of range.");
+        // 间距不超过半个格子时，格子中心到相邻格子内任意点的距离都不小于 MinDistance，退化路径依然满足约束
+        NpgsAssert(CreateInfo_.MinDistance >= 0.0f && CreateInfo_.MinDistance <= CreateInfo_.CellSize * 0.5f,
+                   "MinDistance must not exceed half of the cell size.");
+        CreateInfo_.MaxAttempts = std::max(CreateInfo_.MaxAttempts, 1);
+    }
+
+    std::vector<glm::vec3> FPoissonDiskSampler::Sample(std::span<const glm::ivec3> Cells, std::span<const glm::vec3> FixedPoints) const
+    {
+        NpgsAssert(FixedPoints.size() <= Cells.size(), "More fixed points than cells.");
+        NpgsAssert(Cells.size() < kInvalidSlot, "Too many cells.");
+
+        std::size_t CellCount = Cells.size();
+        std::vector<glm::vec3>    Points(CellCount);
+        std::vector<std::uint8_t> Placed(CellCount, 0);
+
+        FCellTable Table(CellCount);
+        std::array<std::size_t, 9> PhaseOffsets{};
+        for (std::size_t i = 0; i != CellCount; ++i)
+        {
+            glm::ivec3 Cell = Cells[i];
+            if (glm::any(glm::lessThan(Cell, glm::ivec3(0))) || glm::any(glm::greaterThanEqual(Cell, glm::ivec3(CreateInfo_.GridDim))))
+            {
+                throw std::out_of_range("Cell coordinate out of grid.");
+            }
+
+            if (!Table.Insert(PackCell(Cell), static_cast<std::uint32_t>(i)))
+            {
+                throw std::invalid_argument("Duplicate cell in sample list.");
+            }
+
+            if (i >= FixedPoints.size())
+            {
+                ++PhaseOffsets[((Cell.x & 1) | (Cell.y & 1) << 1 | (Cell.z & 1) << 2) + 1];
+            }
+        }
+
+        for (std::size_t i = 0; i != FixedPoints.size(); ++i)
+        {
+            Points[i] = FixedPoints[i];
+            Placed[i] = 1;
+        }
+
+        // 按奇偶性计数排序，同组格子在数组中连续，便于切分为连续区块
+        for (std::size_t Phase = 1; Phase != PhaseOffsets.size(); ++Phase)
+        {
+            PhaseOffsets[Phase] += PhaseOffsets[Phase - 1];
+        }
+
+        std::vector<std::uint32_t> Order(CellCount - FixedPoints.size());
+        std::array<std::size_t, 8> Cursors{};
+        std::copy_n(PhaseOffsets.begin(), 8, Cursors.begin());
+        for (std::size_t i = FixedPoints.size(); i != CellCount; ++i)
+        {
+            glm::ivec3 Cell = Cells[i];
+            Order[Cursors[(Cell.x & 1) | (Cell.y & 1) << 1 | (Cell.z & 1) << 2]++] = static_cast<std::uint32_t>(i);
+        }
+
+        float MinDistanceSquared = CreateInfo_.MinDistance * CreateInfo_.MinDistance;
+
+        auto IsFarEnough = [&](glm::ivec3 Cell, glm::vec3 Candidate) -> bool
+        {
+            for (int z = -1; z <= 1; ++z)
+            {
+                for (int y = -1; y <= 1; ++y)
+                {
+                    for (int x = -1; x <= 1; ++x)
+                    {
+                        glm::ivec3 Neighbor = Cell + glm::ivec3(x, y, z);
+                        if (glm::any(glm::lessThan(Neighbor, glm::ivec3(0))) ||
+                            glm::any(glm::greaterThanEqual(Neighbor, glm::ivec3(CreateInfo_.GridDim))))
+                        {
+                            continue;
+                        }
+
+                        std::uint32_t Slot = Table.Find(PackCell(Neighbor));
+                        if (Slot == kInvalidSlot || !Placed[Slot])
+                        {
+                            continue;
+                        }
+
+                        glm::vec3 Delta = Points[Slot] - Candidate;
+                        if (glm::dot(Delta, Delta) < MinDistanceSquared)
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        // 同组格子互不相邻，区块内只写入自身格子，只读取其他组已经完成的格子，不存在数据竞争
+        auto SampleRange = [&](std::size_t Begin, std::size_t End) -> void
+        {
+            for (std::size_t i = Begin; i != End; ++i)
+            {
+                std::uint32_t Slot    = Order[i];
+                glm::ivec3    Cell    = Cells[Slot];
+                std::uint64_t Key     = PackCell(Cell);
+                glm::vec3     CellMin = CreateInfo_.GridMin + glm::vec3(Cell) * CreateInfo_.CellSize;
+                glm::vec3     Result  = CellMin + glm::vec3(CreateInfo_.CellSize * 0.5f);
+
+                for (int Attempt = 0; Attempt != CreateInfo_.MaxAttempts; ++Attempt)
+                {
+                    std::uint64_t Counter = static_cast<std::uint64_t>(Attempt) * 3;
+                    glm::vec3 Candidate(CellMin.x + static_cast<float>(Math::HashToUnitDouble(HashCell(Key, Counter + 0))) * CreateInfo_.CellSize,
+                                        CellMin.y + static_cast<float>(Math::HashToUnitDouble(HashCell(Key, Counter + 1))) * CreateInfo_.CellSize,
+                                        CellMin.z + static_cast<float>(Math::HashToUnitDouble(HashCell(Key, Counter + 2))) * CreateInfo_.CellSize);
+
+                    if (IsFarEnough(Cell, Candidate))
+                    {
+                        Result = Candidate;
+                        break;
+                    }
+                }
+
+                Points[Slot] = Result;
+                Placed[Slot] = 1;
+            }
+        };
+
+        // 下一组格子会读取本组的结果，ParallelFor 返回时本组已全部完成
+        for (std::size_t Phase = 0; Phase != 8; ++Phase)
+        {
+            ThreadPool_->ParallelFor(PhaseOffsets[Phase], PhaseOffsets[Phase + 1], kMinCellCountPerChunk, SampleRange);
+        }
+
+        return Points;
+    }
+
+    std::uint64_t FPoissonDiskSampler::PackCell(glm::ivec3 Cell) const
+    {
+        return static_cast<std::uint64_t>(Cell.x) |
+               static_cast<std::uint64_t>(Cell.y) << kCoordBits |
+               static_cast<std::uint64_t>(Cell.z) << (kCoordBits * 2);
+    }
+
+    std::uint64_t FPoissonDiskSampler::HashCell(std::uint64_t Key, std::uint64_t Counter) const
+    {
+        return Math::SplitMix64(Math::SplitMix64(CreateInfo_.Seed ^ Key) + Counter);
+    }
+} // namespace Npgs
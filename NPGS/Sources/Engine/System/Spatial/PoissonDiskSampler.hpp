@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Engine/Runtime/Pools/ThreadPool.hpp"
+
+namespace Npgs
+{
+    // 基于栅格的并行泊松盘采样，每个被选中的格子中放置一个点，任意两点间距不小于 MinDistance
+    // 格子按坐标奇偶性分为 8 组，同组格子互不相邻，因此同组格子可以并行采样而无需加锁
+    // 每个格子的随机数只由种子和格子坐标决定，结果与线程数量和调度顺序无关
+    class FPoissonDiskSampler
+    {
+    public:
+        struct FCreateInfo
+        {
+            glm::vec3     GridMin{};          // 网格最小角坐标
+            float         CellSize{};         // 格子边长
+            int           GridDim{};          // 每个轴上的格子数量，不超过 2^21
+            float         MinDistance{};      // 最小间距，不能超过 CellSize / 2
+            std::uint64_t Seed{};
+            int           MaxAttempts{ 16 };  // 每个格子的最大投点次数，全部失败时退化为格子中心
+        };
+
+    public:
+        explicit FPoissonDiskSampler(const FCreateInfo& CreateInfo);
+        ~FPoissonDiskSampler() = default;
+
+        // 为 Cells 中的每个格子生成一个点，返回值与 Cells 一一对应
+        // Cells 的前 FixedPoints.size() 个格子直接使用 FixedPoints 中的位置，不参与随机采样
+        std::vector<glm::vec3> Sample(std::span<const glm::ivec3> Cells, std::span<const glm::vec3> FixedPoints = {}) const;
+
+    private:
+        class FCellTable;
+
+    private:
+        std::uint64_t PackCell(glm::ivec3 Cell) const;
+        std::uint64_t HashCell(std::uint64_t Key, std::uint64_t Counter) const;
+
+    private:
+        FCreateInfo  CreateInfo_;
+        FThreadPool* ThreadPool_;
+    };
+} // namespace Npgs
@@ -1,7 +1,19 @@
 #include "stdafx.h"
 #include "UniversalCoordinate.hpp"
 
+#include "Engine/Core/Math/NumericConstants.hpp"
+
 namespace Npgs
 {
+    FUniversalCoordinate FUniversalCoordinate::FromLightYears(glm::dvec3 Position)
+    {
+        return FromMeters(Position * static_cast<double>(kLightYearToMeter));
+    }
 
-} // namespace Npgs;
+    glm::dvec3 FUniversalCoordinate::ToLightYears() const
+    {
+        // 先分别换算扇区和偏移，避免 ToMeters 中的大数与小数相加后再整体缩放
+        constexpr double kSectorSizeInLightYears = kSectorSize / static_cast<double>(kLightYearToMeter);
+        return glm::dvec3(Sector_) * kSectorSizeInLightYears + glm::dvec3(Offset_) / static_cast<double>(kLightYearToMeter);
+    }
+} // namespace Npgs
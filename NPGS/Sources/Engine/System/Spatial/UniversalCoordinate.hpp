@@ -1,8 +1,49 @@
 #pragma once
 
-#include <boost/multiprecision/cpp_int.hpp>
+#include <cstdint>
+#include <glm/glm.hpp>
 
 namespace Npgs
 {
+    // 宇宙坐标，使用 64 位整数扇区索引 + 扇区内 float 偏移表示
+    // 扇区边长为 2^32 m（约 0.029 AU），偏移以扇区中心为原点，范围 [-kSectorSize / 2, kSectorSize / 2)
+    // 扇区内精度优于 128 m，64 位扇区索引可覆盖的范围远超星系尺度
+    class FUniversalCoordinate
+    {
+    public:
+        static constexpr int    kSectorSizeExponent = 32;
+        static constexpr double kSectorSize         = static_cast<double>(1ull << kSectorSizeExponent); // 单位 m
+        static constexpr double kInverseSectorSize  = 1.0 / kSectorSize;
 
-} // namespace Npgs;
+    public:
+        FUniversalCoordinate() = default;
+        FUniversalCoordinate(glm::i64vec3 Sector, glm::vec3 Offset);
+
+        static FUniversalCoordinate FromMeters(glm::dvec3 Position);
+        static FUniversalCoordinate FromLightYears(glm::dvec3 Position);
+
+        glm::dvec3 ToMeters() const;
+        glm::dvec3 ToLightYears() const;
+
+        // 相对于 Origin 的位置，单位 m，乘以 Scale 后转换为目标单位（如渲染空间单位）
+        // 扇区差先在整数域相减，只有相对量进入浮点运算，因此远离原点时也不会丢失精度
+        glm::dvec3 GetRelativePosition(const FUniversalCoordinate& Origin, double Scale = 1.0) const;
+        glm::vec3  GetRelativePositionFloat(const FUniversalCoordinate& Origin, double Scale = 1.0) const;
+
+        FUniversalCoordinate& Translate(glm::dvec3 Delta);
+        FUniversalCoordinate& Normalize();
+
+        glm::i64vec3          GetSector() const;
+        FUniversalCoordinate& SetSector(glm::i64vec3 Sector);
+        glm::vec3             GetOffset() const;
+        FUniversalCoordinate& SetOffset(glm::vec3 Offset);
+
+        bool operator==(const FUniversalCoordinate& Other) const = default;
+
+    private:
+        glm::i64vec3 Sector_{};
+        glm::vec3    Offset_{};
+    };
+} // namespace Npgs
+
+#include "UniversalCoordinate.inl"
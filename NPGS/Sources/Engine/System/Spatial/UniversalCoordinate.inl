@@ -0,0 +1,74 @@
+#include "UniversalCoordinate.hpp"
+
+#include <cmath>
+#include "Engine/Core/Base/Base.hpp"
+
+namespace Npgs
+{
+    NPGS_INLINE FUniversalCoordinate::FUniversalCoordinate(glm::i64vec3 Sector, glm::vec3 Offset)
+        : Sector_(Sector), Offset_(Offset)
+    {
+        Normalize();
+    }
+
+    NPGS_INLINE FUniversalCoordinate FUniversalCoordinate::FromMeters(glm::dvec3 Position)
+    {
+        FUniversalCoordinate Coordinate;
+        Coordinate.Translate(Position);
+        return Coordinate;
+    }
+
+    NPGS_INLINE glm::dvec3 FUniversalCoordinate::ToMeters() const
+    {
+        return glm::dvec3(Sector_) * kSectorSize + glm::dvec3(Offset_);
+    }
+
+    NPGS_INLINE glm::dvec3 FUniversalCoordinate::GetRelativePosition(const FUniversalCoordinate& Origin, double Scale) const
+    {
+        glm::dvec3 SectorDelta(Sector_ - Origin.Sector_);
+        glm::dvec3 OffsetDelta = glm::dvec3(Offset_) - glm::dvec3(Origin.Offset_);
+        return (SectorDelta * kSectorSize + OffsetDelta) * Scale;
+    }
+
+    NPGS_INLINE glm::vec3 FUniversalCoordinate::GetRelativePositionFloat(const FUniversalCoordinate& Origin, double Scale) const
+    {
+        return glm::vec3(GetRelativePosition(Origin, Scale));
+    }
+
+    NPGS_INLINE FUniversalCoordinate& FUniversalCoordinate::Translate(glm::dvec3 Delta)
+    {
+        glm::dvec3 Local = glm::dvec3(Offset_) + Delta;
+        glm::dvec3 Carry = glm::floor(Local * kInverseSectorSize + 0.5);
+
+        Sector_ += glm::i64vec3(Carry);
+        Offset_  = glm::vec3(Local - Carry * kSectorSize);
+        return *this;
+    }
+
+    NPGS_INLINE FUniversalCoordinate& FUniversalCoordinate::Normalize()
+    {
+        return Translate(glm::dvec3(0.0));
+    }
+
+    NPGS_INLINE glm::i64vec3 FUniversalCoordinate::GetSector() const
+    {
+        return Sector_;
+    }
+
+    NPGS_INLINE FUniversalCoordinate& FUniversalCoordinate::SetSector(glm::i64vec3 Sector)
+    {
+        Sector_ = Sector;
+        return *this;
+    }
+
+    NPGS_INLINE glm::vec3 FUniversalCoordinate::GetOffset() const
+    {
+        return Offset_;
+    }
+
+    NPGS_INLINE FUniversalCoordinate& FUniversalCoordinate::SetOffset(glm::vec3 Offset)
+    {
+        Offset_ = Offset;
+        return Normalize();
+    }
+} // namespace Npgs
@@ -33,6 +33,7 @@
 #include "Engine/Runtime/Managers/AssetManager.hpp"
 #include "Engine/Runtime/Managers/ShaderBufferManager.hpp"
 #include "Engine/Runtime/Managers/ShaderManager.hpp"
+#include "Engine/Runtime/Pools/LinearArena.hpp"
 #include "Engine/System/Services/EngineServices.hpp"
 
 namespace Npgs
@@ -770,6 +771,9 @@ namespace Npgs
                 glfwWaitEvents();
             }
 
+            // 回收上一帧在主线程 arena 上的临时分配
+            FLinearArena::GetThreadArena().Reset();
+
             vk::Extent2D SupersamplingExtent(WindowSize_.width * 2, WindowSize_.height * 2);
 
             vk::Viewport CommonViewport(0.0f, 0.0f, static_cast<float>(SupersamplingExtent.width),
@@ -8,8 +8,9 @@
 
 namespace Npgs
 {
-    std::vector<FVulkanCommandBuffer>
-    FGbufferScene::RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor)
+    std::pmr::vector<FVulkanCommandBuffer>
+    FGbufferScene::RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor,
+                                  std::pmr::memory_resource* MemoryResource)
     {
         //vk::CommandBufferInheritanceRenderingInfo InheritanceRenderingInfo = vk::CommandBufferInheritanceRenderingInfo()
         //    .setColorAttachmentCount(4)
@@ -20,7 +21,7 @@ namespace Npgs
         //vk::CommandBufferInheritanceInfo InheritanceInfo = vk::CommandBufferInheritanceInfo()
         //    .setPNext(&InheritanceRenderingInfo);
 
-        //std::vector<FVulkanCommandBuffer> CommandBuffers(Config::Graphics::kMaxFrameInFlight);
+        //std::pmr::vector<FVulkanCommandBuffer> CommandBuffers(Config::Graphics::kMaxFrameInFlight, MemoryResource);
         //CommandPool->AllocateBuffers(vk::CommandBufferLevel::eSecondary, "GbufferSceneCommandBuffer", CommandBuffers);
 
         //for (std::size_t i = 0; i != CommandBuffers.size(); ++i)
@@ -35,7 +36,7 @@ namespace Npgs
         //    CommandBuffer->setScissor(0, Scissor);
         //}
 
-        return {};
+        return std::pmr::vector<FVulkanCommandBuffer>(MemoryResource);
     }
 
     void FGbufferScene::BindDescriptors()
@@ -13,8 +13,9 @@ namespace Npgs
     class FGbufferScene : public IRenderPass
     {
     public:
-        std::vector<FVulkanCommandBuffer>
-        RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor) override;
+        std::pmr::vector<FVulkanCommandBuffer>
+        RecordCommands(const FCommandPoolPool::FPoolGuard& CommandPool, vk::Viewport Viewport, vk::Rect2D Scissor,
+                       std::pmr::memory_resource* MemoryResource) override;
 
     private:
         void BindDescriptors() override;
@@ -1,26 +1,103 @@
 #include "stdafx.h"
 #include "Universe.hpp"
 
+#include <cmath>
 #include <cstdlib>
 #include <algorithm>
 #include <array>
 #include <format>
-#include <iomanip>
 #include <limits>
 #include <print>
 #include <ranges>
-#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
 #include "Engine/Core/Base/Base.hpp"
 #include "Engine/Core/Math/NumericConstants.hpp"
 #include "Engine/Core/Logger.hpp"
+#include "Engine/Runtime/Pools/TaskGraph.hpp"
+#include "Engine/Runtime/Pools/TaskTrace.hpp"
 #include "Engine/System/Generators/OrbitalGenerator.hpp"
 #include "Engine/System/Services/EngineServices.hpp"
+#include "Engine/System/Spatial/PoissonDiskSampler.hpp"
 
 namespace Npgs
 {
+    namespace
+    {
+#ifdef NPGS_ENABLE_TASK_TRACE
+        constexpr const char* kFillUniverseTraceFile = "FillUniverse.trace.json";
+#endif // NPGS_ENABLE_TASK_TRACE
+    }
+
+    void FStellarAggregate::AddStar(glm::vec3 Position, double Luminosity, float Teff)
+    {
+        FStellarAggregate Star
+        {
+            .BoundCenter            = Position,
+            .BoundRadius            = 0.0f,
+            .TotalLuminosity        = Luminosity,
+            .LuminosityWeightedTeff = Luminosity * Teff,
+            .StarCount              = 1
+        };
+
+        Merge(Star);
+    }
+
+    void FStellarAggregate::Merge(const FStellarAggregate& Other)
+    {
+        if (Other.BoundRadius < 0.0f)
+        {
+            return;
+        }
+
+        TotalLuminosity        += Other.TotalLuminosity;
+        LuminosityWeightedTeff += Other.LuminosityWeightedTeff;
+        StarCount              += Other.StarCount;
+
+        if (BoundRadius < 0.0f)
+        {
+            BoundCenter = Other.BoundCenter;
+            BoundRadius = Other.BoundRadius;
+            return;
+        }
+
+        // 合并两个包围球
+        float Distance = glm::distance(BoundCenter, Other.BoundCenter);
+        if (Distance + Other.BoundRadius <= BoundRadius)
+        {
+            return;
+        }
+
+        if (Distance + BoundRadius <= Other.BoundRadius)
+        {
+            BoundCenter = Other.BoundCenter;
+            BoundRadius = Other.BoundRadius;
+            return;
+        }
+
+        float NewRadius = (Distance + BoundRadius + Other.BoundRadius) * 0.5f;
+        BoundCenter += (Other.BoundCenter - BoundCenter) * ((NewRadius - BoundRadius) / Distance);
+        BoundRadius  = NewRadius;
+    }
+
+    float FStellarAggregate::GetMeanTeff() const
+    {
+        return TotalLuminosity > 0.0 ? static_cast<float>(LuminosityWeightedTeff / TotalLuminosity) : 0.0f;
+    }
+
+    float FGalacticDensityProfile::operator()(glm::vec3 NormalizedPosition) const
+    {
+        float CylindricalRadius = std::sqrt(NormalizedPosition.x * NormalizedPosition.x + NormalizedPosition.y * NormalizedPosition.y);
+        float SphericalRadius   = glm::length(NormalizedPosition);
+
+        float Disk  = std::exp(-CylindricalRadius / DiskScaleLength - std::abs(NormalizedPosition.z) / DiskScaleHeight);
+        float Bulge = BulgeWeight * std::exp(-(SphericalRadius * SphericalRadius) / (BulgeRadius * BulgeRadius));
+
+        return (Disk + Bulge + HaloWeight) / (1.0f + BulgeWeight + HaloWeight);
+    }
+
     FUniverse::FUniverse(std::uint32_t Seed, std::size_t StarCount, std::size_t ExtraGiantCount, std::size_t ExtraMassiveStarCount,
                          std::size_t ExtraNeutronStarCount, std::size_t ExtraBlackHoleCount, std::size_t ExtraMergeStarCount, float UniverseAge)
         : RandomEngine_(Seed)
@@ -46,20 +123,125 @@ namespace Npgs
         RandomEngine_.seed(SeedSequence);
     }
 
-    void FUniverse::FillUniverse()
+    void FUniverse::FillUniverse(const FCancellationToken& CancellationToken)
     {
         int MaxThread = ThreadPool_->GetMaxThreadCount();
 
-        GenerateStars(MaxThread);
-        FillStellarSystem(MaxThread);
+        // 多 NUMA 节点时各节点使用自己的 MIST 数据副本，恒星插值查表不跨节点访问
+        if (ThreadPool_->GetNumaNodeCount() > 1)
+        {
+            EngineCoreServices->GetAssetManager()->SetNumaReplicationEnabled(true);
+        }
+
+        std::vector<FStellarGenerator>       Generators;
+        std::vector<FStellarBasicProperties> BasicProperties;
+        std::vector<Astro::AStar>            Stars;
+        std::vector<glm::vec3>               Slots;
+
+        // 生成流程的依赖图。RandomEngine_ 只在一条依赖链上使用（基础属性 -> 格子 -> 链接 -> 双星 -> 行星系），
+        // 因此结果与调度顺序无关。插值与格子生成互不依赖，可以重叠执行
+        // 生成以后台优先级运行，与渲染共用线程池时不会挤占帧内任务
+        FTaskGraph Graph(ThreadPool_, ETaskPriority::kBackground);
 
-        // ThreadPool_->Terminate();
+#ifdef NPGS_ENABLE_TASK_TRACE
+        // 开启追踪时记录整个生成过程，结束后导出到工作目录下的 kFillUniverseTraceFile，
+        // 用 chrome://tracing 或 ui.perfetto.dev 打开
+        FTaskTracer::Start();
+#endif // NPGS_ENABLE_TASK_TRACE
+
+        auto BasicPropertiesNode = Graph.AddNode("GenerateBasicProperties", [&]() -> void
+        {
+            NpgsCoreInfo("Initializating and generating basic properties...");
+            GenerateBasicProperties(MaxThread, Generators, BasicProperties);
+        });
+
+        auto InterpolateNode = Graph.AddNode("InterpolateStars", [&]() -> void
+        {
+            NpgsCoreInfo("Interpolating stellar data as {} threads...", MaxThread);
+            Stars = InterpolateStars(MaxThread, Generators, BasicProperties);
+        }, { BasicPropertiesNode });
+
+        auto SlotsNode = Graph.AddNode("GenerateSlots", [&]() -> void
+        {
+            NpgsCoreInfo("Generating stellar slots...");
+            GenerateSlots(0.1f, StarCount_, 0.004f);
+        }, { BasicPropertiesNode });
+
+        auto LinkNode = Graph.AddNode("OctreeLinkToStellarSystems", [&]() -> void
+        {
+            NpgsCoreInfo("Linking positions in octree to stellar systems...");
+            OrbitalSystems_.reserve(StarCount_);
+            std::ranges::shuffle(Stars, RandomEngine_);
+            OctreeLinkToStellarSystems(Stars, Slots);
+        }, { InterpolateNode, SlotsNode });
+
+        auto BinaryNode = Graph.AddNode("GenerateBinaryStars", [&]() -> void
+        {
+            NpgsCoreInfo("Generating binary stars...");
+            GenerateBinaryStars(MaxThread);
+        }, { LinkNode });
+
+        auto SortNode = Graph.AddNode("SortSlots", [&]() -> void
+        {
+            NpgsCoreInfo("Sorting...");
+            std::ranges::sort(Slots, [](glm::vec3 Point1, glm::vec3 Point2)
+            {
+                return glm::length(Point1) < glm::length(Point2);
+            });
+        }, { LinkNode });
+
+        auto NameNode = Graph.AddNode("AssignNames", [&]() -> void
+        {
+            NpgsCoreInfo("Assigning name...");
+            AssignNames(Slots);
+        }, { BinaryNode, SortNode });
+
+        auto HomeNode = Graph.AddNode("ResetHomeStellarSystem", [&]() -> void
+        {
+            NpgsCoreInfo("Reset home stellar system...");
+            ResetHomeStellarSystem();
+        }, { NameNode });
+
+        Graph.AddNode("BuildStellarAggregates", [&]() -> void
+        {
+            NpgsCoreInfo("Building octree stellar aggregates...");
+            BuildStellarAggregates();
+        }, { HomeNode });
+
+        Graph.AddNode("BuildStarCatalog", [&]() -> void
+        {
+            NpgsCoreInfo("Building star catalog...");
+            BuildStarCatalog();
+        }, { HomeNode });
+
+        Graph.AddNode("FillStellarSystem", [&]() -> void
+        {
+            FillStellarSystem(MaxThread);
+        }, { NameNode });
+
+        Graph.Execute(CancellationToken);
+
+#ifdef NPGS_ENABLE_TASK_TRACE
+        FTaskTracer::Stop();
+        if (FTaskTracer::ExportChromeTrace(kFillUniverseTraceFile))
+        {
+            NpgsCoreInfo("Task trace written to {}.", kFillUniverseTraceFile);
+        }
+#endif // NPGS_ENABLE_TASK_TRACE
+
+        NpgsCoreInfo("Stellar generation completed.");
+        Graph.LogTimings();
+        ThreadPool_->LogStatistics();
+
+        // 等待生成过程中提交的零散任务全部结束，线程池由引擎服务统一关闭
+        ThreadPool_->WaitIdle();
     }
 
     void FUniverse::ReplaceStar(std::size_t DistanceRank, const Astro::AStar& StarData)
     {
-        for (auto& System : OrbitalSystems_)
+        for (std::size_t SystemIndex = 0; SystemIndex != OrbitalSystems_.size(); ++SystemIndex)
         {
+            auto& System = OrbitalSystems_[SystemIndex];
             if (DistanceRank == System.GetBaryDistanceRank())
             {
                 auto& Stars = System.StarsData();
@@ -69,11 +251,69 @@ namespace Npgs
                 }
 
                 Stars.clear();
-                Stars.push_back(std::make_unique<Astro::AStar>(StarData));
+                System.AddStar(Astro::AStar(StarData));
+
+                if (SystemIndex < StarCatalog_.GetSystemCount())
+                {
+                    StarCatalog_.UpdateStar(StarCatalog_.GetSystemFirstRow(SystemIndex), Stars.front());
+                }
+
+                FOctreeLinkId SystemLink = static_cast<FOctreeLinkId>(SystemIndex);
+                FNodeType* LeafNode = Octree_->Find(System.GetBaryPosition(), [SystemLink](const FNodeType& Node) -> bool
+                {
+                    return Node.IsLeafNode() && Node.GetLink([SystemLink](FOctreeLinkId Link) -> bool
+                    {
+                        return Link == SystemLink;
+                    }) != kOctreeInvalidLink;
+                });
+
+                if (LeafNode != nullptr)
+                {
+                    Octree_->UpdateAggregates(LeafNode, [this](const FNodeType& Node) -> FStellarAggregate
+                    {
+                        return MakeLeafAggregate(Node);
+                    });
+                }
+
+                return;
             }
         }
     }
 
+    const Astro::FStarCatalog& FUniverse::GetStarCatalog() const
+    {
+        return StarCatalog_;
+    }
+
+    const Astro::AStar* FUniverse::GetCatalogStar(std::size_t Row) const
+    {
+        return &OrbitalSystems_[StarCatalog_.GetSystemIndex(Row)].StarsData()[StarCatalog_.GetStarIndex(Row)];
+    }
+
+    std::vector<FStellarAggregate> FUniverse::CollectLodAggregates(glm::vec3 ViewPosition, float ErrorThreshold) const
+    {
+        std::vector<FStellarAggregate> Aggregates;
+        Octree_->TraverseLod([&](const FNodeType& Node) -> bool
+        {
+            const FStellarAggregate& Aggregate = Node.GetAggregate();
+            if (Aggregate.StarCount == 0)
+            {
+                return false;
+            }
+
+            float Distance = glm::distance(ViewPosition, Aggregate.BoundCenter);
+            if (!Node.IsLeafNode() && (Distance <= Aggregate.BoundRadius || Aggregate.BoundRadius > ErrorThreshold * Distance))
+            {
+                return true;
+            }
+
+            Aggregates.push_back(Aggregate);
+            return false;
+        });
+
+        return Aggregates;
+    }
+
     // 通用统计结构体，替代原本分散的定义
     template <typename Ty>
     struct StatEntry
@@ -82,6 +322,11 @@ namespace Npgs
         const Astro::AStar* Star = nullptr;
     };
 
+    void FUniverse::SetDensityProfile(const FGalacticDensityProfile& Profile)
+    {
+        DensityProfile_ = Profile;
+    }
+
     void FUniverse::CountStars()
     {
         constexpr int kTypeOIndex = 0;
@@ -92,6 +337,8 @@ namespace Npgs
         constexpr int kTypeKIndex = 5;
         constexpr int kTypeMIndex = 6;
 
+        const Astro::FStarCatalog& Catalog = StarCatalog_;
+
         std::array<std::size_t, 7> MainSequences{};
         std::array<std::size_t, 7> Subgiants{};
         std::array<std::size_t, 7> Giants{};
@@ -182,83 +429,83 @@ namespace Npgs
             }
         };
 
-        auto CountMostLuminous = [](const std::unique_ptr<Astro::AStar>& Star, MostLuminous& StartStat)
+        auto CountMostLuminous = [this, &Catalog](std::size_t Row, MostLuminous& StartStat)
         {
-            double Value = Star->GetLuminosity() / kSolarLuminosity;
+            double Value = Catalog.GetLuminosity(Row) / kSolarLuminosity;
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountMostMassive = [](const std::unique_ptr<Astro::AStar>& Star, MostMassive& StartStat)
+        auto CountMostMassive = [this, &Catalog](std::size_t Row, MostMassive& StartStat)
         {
-            double Value = Star->GetMass() / kSolarMass;
+            double Value = Catalog.GetMass(Row) / kSolarMass;
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountLargest = [](const std::unique_ptr<Astro::AStar>& Star, Largest& StartStat)
+        auto CountLargest = [this, &Catalog](std::size_t Row, Largest& StartStat)
         {
-            float Value = Star->GetRadius() / kSolarRadius;
+            float Value = Catalog.GetRadius(Row) / kSolarRadius;
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountHottest = [](const std::unique_ptr<Astro::AStar>& Star, Hottest& StartStat)
+        auto CountHottest = [this, &Catalog](std::size_t Row, Hottest& StartStat)
         {
-            float Value = Star->GetTeff();
+            float Value = Catalog.GetTeff(Row);
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountOldest = [](const std::unique_ptr<Astro::AStar>& Star, Oldest& StartStat)
+        auto CountOldest = [this](std::size_t Row, Oldest& StartStat)
         {
-            double Value = Star->GetAge();
+            double Value = GetCatalogStar(Row)->GetAge();
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountMostOblateness = [](const std::unique_ptr<Astro::AStar>& Star, MostOblateness& StartStat)
+        auto CountMostOblateness = [this](std::size_t Row, MostOblateness& StartStat)
         {
-            float Value = Star->GetOblateness();
+            float Value = GetCatalogStar(Row)->GetOblateness();
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountMostMagnetic = [](const std::unique_ptr<Astro::AStar>& Star, MostMagnetic& StartStat)
+        auto CountMostMagnetic = [this](std::size_t Row, MostMagnetic& StartStat)
         {
-            float Value = Star->GetMagneticField() * 10000;
+            float Value = GetCatalogStar(Row)->GetMagneticField() * 10000;
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
-        auto CountMostMdot = [](const std::unique_ptr<Astro::AStar>& Star, MostMdot& StartStat)
+        auto CountMostMdot = [this](std::size_t Row, MostMdot& StartStat)
         {
-            double Value = Star->GetStellarWindMassLossRate() * kYearToSecond / kSolarMass;
+            double Value = GetCatalogStar(Row)->GetStellarWindMassLossRate() * kYearToSecond / kSolarMass;
             if (StartStat.Value < Value)
             {
                 StartStat.Value = Value;
-                StartStat.Star = Star.get();
+                StartStat.Star = GetCatalogStar(Row);
             }
         };
 
@@ -292,147 +539,142 @@ namespace Npgs
         std::println("{}", FormatTitle());
         std::println("");
 
-        for (auto& System : OrbitalSystems_)
+        for (std::size_t SystemIndex = 0; SystemIndex != Catalog.GetSystemCount(); ++SystemIndex)
         {
-            for (auto& Star : System.StarsData())
-            {
-                ++TotalStars;
+            std::size_t SystemStarCount = Catalog.GetSystemStarCount(SystemIndex);
+            (SystemStarCount > 1 ? TotalBinarys : TotalSingles) += SystemStarCount;
+        }
 
-                if (Star->IsSingleStar())
-                {
-                    ++TotalSingles;
-                }
-                else
-                {
-                    ++TotalBinarys;
-                }
+        // 分类只读取目录中的光谱型编码列，只有更新极值时才会访问恒星的冷数据
+        const auto& ClassCodes = Catalog.GetClassCodes();
+        TotalStars += ClassCodes.size();
 
-                const auto& Class = Star->GetStellarClass();
-                Astro::EStellarType StellarType = Class.GetStellarType();
-                if (StellarType != Astro::EStellarType::kNormalStar)
+        for (std::size_t Row = 0; Row != ClassCodes.size(); ++Row)
+        {
+            Astro::EStellarType StellarType = Astro::FStarCatalog::GetStellarType(ClassCodes[Row]);
+            if (StellarType != Astro::EStellarType::kNormalStar)
+            {
+                switch (StellarType)
                 {
-                    switch (StellarType)
-                    {
-                    case Astro::EStellarType::kBlackHole:
-                        ++BlackHoles;
-                        break;
-                    case Astro::EStellarType::kNeutronStar:
-                        ++NeutronStars;
-                        break;
-                    case Astro::EStellarType::kWhiteDwarf:
-                        ++WhiteDwarfs;
-                        break;
-                    default:
-                        break;
-                    }
-
-                    continue;
+                case Astro::EStellarType::kBlackHole:
+                    ++BlackHoles;
+                    break;
+                case Astro::EStellarType::kNeutronStar:
+                    ++NeutronStars;
+                    break;
+                case Astro::EStellarType::kWhiteDwarf:
+                    ++WhiteDwarfs;
+                    break;
+                default:
+                    break;
                 }
 
-                Astro::FSpectralType SpectralType = Class.GetSpectralType();
-
-                // 定义统计更新宏，简化调用
-#define UPDATE_ALL_STATS(Suffix)                                       \
-                    CountMostLuminous(Star, MostLuminous##Suffix);     \
-                    CountMostMassive(Star, MostMassive##Suffix);       \
-                    CountLargest(Star, Largest##Suffix);               \
-                    CountHottest(Star, Hottest##Suffix);               \
-                    CountOldest(Star, Oldest##Suffix);                 \
-                    CountMostOblateness(Star, MostOblateness##Suffix); \
-                    CountMostMagnetic(Star, MostMagnetic##Suffix);     \
-                    CountMostMdot(Star, MostMdot##Suffix);
-
-                // O Type Stars Special Handling (Note: These are only reached if not caught by above checks)
-                if (SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_O)
-                {
-                    bool bIsF = SpectralType.SpecialMarked(Astro::ESpecialMark::kCode_f);
+                continue;
+            }
 
-                    if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_V && !bIsF)
-                    {
-                        CountClass(SpectralType, MainSequences);
-                        UPDATE_ALL_STATS(OMainSequence)
-                    }
-                    else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III && !bIsF)
-                    {
-                        CountClass(SpectralType, Giants);
-                        UPDATE_ALL_STATS(OGiant)
-                    }
-                    else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_I && !bIsF)
-                    {
-                        CountClass(SpectralType, Supergiants);
-                        UPDATE_ALL_STATS(OSupergiant)
-                    }
-                    else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III && bIsF)
-                    {
-                        CountClass(SpectralType, Giants);
-                        UPDATE_ALL_STATS(OfGiant)
-                    }
-                    else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_I && bIsF)
-                    {
-                        CountClass(SpectralType, Hypergiants); // Assuming mapping based on original logic logic
-                        UPDATE_ALL_STATS(OfSupergiant)
-                    }
-                }
+            Astro::FSpectralType SpectralType = Astro::FStarCatalog::UnpackClass(ClassCodes[Row]).GetSpectralType();
+
+            // 定义统计更新宏，简化调用
+#define UPDATE_ALL_STATS(Suffix)                                  \
+                CountMostLuminous(Row, MostLuminous##Suffix);     \
+                CountMostMassive(Row, MostMassive##Suffix);       \
+                CountLargest(Row, Largest##Suffix);               \
+                CountHottest(Row, Hottest##Suffix);               \
+                CountOldest(Row, Oldest##Suffix);                 \
+                CountMostOblateness(Row, MostOblateness##Suffix); \
+                CountMostMagnetic(Row, MostMagnetic##Suffix);     \
+                CountMostMdot(Row, MostMdot##Suffix);
+
+            // O Type Stars Special Handling (Note: These are only reached if not caught by above checks)
+            if (SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_O)
+            {
+                bool bIsF = SpectralType.SpecialMarked(Astro::ESpecialMark::kCode_f);
 
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Unknown)
+                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_V && !bIsF)
                 {
-                    if (SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WC ||
-                        SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WN ||
-                        SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WO)
-                    {
-                        ++WolfRayet;
-                        UPDATE_ALL_STATS(WolfRayet)
-                        continue;
-                    }
+                    CountClass(SpectralType, MainSequences);
+                    UPDATE_ALL_STATS(OMainSequence)
                 }
-
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_0 ||
-                    SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_IaPlus)
+                else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III && !bIsF)
                 {
-                    CountClass(SpectralType, Hypergiants);
-                    UPDATE_ALL_STATS(Hypergiant)
-                    continue;
+                    CountClass(SpectralType, Giants);
+                    UPDATE_ALL_STATS(OGiant)
                 }
-
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Ia ||
-                    SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Iab ||
-                    SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Ib)
+                else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_I && !bIsF)
                 {
                     CountClass(SpectralType, Supergiants);
-                    UPDATE_ALL_STATS(Supergiant)
-                    continue;
+                    UPDATE_ALL_STATS(OSupergiant)
                 }
-
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_II)
-                {
-                    CountClass(SpectralType, BrightGiants);
-                    UPDATE_ALL_STATS(BrightGiant)
-                    continue;
-                }
-
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III)
+                else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III && bIsF)
                 {
                     CountClass(SpectralType, Giants);
-                    UPDATE_ALL_STATS(Giant)
-                    continue;
+                    UPDATE_ALL_STATS(OfGiant)
                 }
-
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_IV)
+                else if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_I && bIsF)
                 {
-                    CountClass(SpectralType, Subgiants);
-                    UPDATE_ALL_STATS(Subgiant)
-                    continue;
+                    CountClass(SpectralType, Hypergiants); // Assuming mapping based on original logic logic
+                    UPDATE_ALL_STATS(OfSupergiant)
                 }
+            }
 
-                if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_V)
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Unknown)
+            {
+                if (SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WC ||
+                    SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WN ||
+                    SpectralType.SpectralClass == Astro::ESpectralClass::kSpectral_WO)
                 {
-                    CountClass(SpectralType, MainSequences);
-                    UPDATE_ALL_STATS(MainSequence)
+                    ++WolfRayet;
+                    UPDATE_ALL_STATS(WolfRayet)
                     continue;
                 }
+            }
 
-#undef UPDATE_ALL_STATS
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_0 ||
+                SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_IaPlus)
+            {
+                CountClass(SpectralType, Hypergiants);
+                UPDATE_ALL_STATS(Hypergiant)
+                continue;
+            }
+
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Ia ||
+                SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Iab ||
+                SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_Ib)
+            {
+                CountClass(SpectralType, Supergiants);
+                UPDATE_ALL_STATS(Supergiant)
+                continue;
+            }
+
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_II)
+            {
+                CountClass(SpectralType, BrightGiants);
+                UPDATE_ALL_STATS(BrightGiant)
+                continue;
+            }
+
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_III)
+            {
+                CountClass(SpectralType, Giants);
+                UPDATE_ALL_STATS(Giant)
+                continue;
+            }
+
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_IV)
+            {
+                CountClass(SpectralType, Subgiants);
+                UPDATE_ALL_STATS(Subgiant)
+                continue;
+            }
+
+            if (SpectralType.LuminosityClass == Astro::ELuminosityClass::kLuminosity_V)
+            {
+                CountClass(SpectralType, MainSequences);
+                UPDATE_ALL_STATS(MainSequence)
+                continue;
             }
+
+#undef UPDATE_ALL_STATS
         }
 
         // 打印结果辅助函数
@@ -514,12 +756,9 @@ namespace Npgs
         std::println("");
     }
 
-    void FUniverse::GenerateStars(int MaxThread)
+    void FUniverse::GenerateBasicProperties(int MaxThread, std::vector<FStellarGenerator>& Generators,
+                                            std::vector<FStellarBasicProperties>& BasicProperties)
     {
-        NpgsCoreInfo("Initializating and generating basic properties...");
-        std::vector<FStellarGenerator> Generators;
-        std::vector<FStellarBasicProperties> BasicProperties;
-
         auto CreateGenerators =
         [&, this](EStellarTypeGenerationOption StellarTypeOption = EStellarTypeGenerationOption::kRandom,
                   float MassLowerLimit = 0.1f, float MassUpperLimit = 300.0f,
@@ -562,7 +801,7 @@ namespace Npgs
         };
 
         // 生成基础属性
-        auto GenerateBasicProperties = [&](std::size_t NumStars) -> void
+        auto AppendBasicProperties = [&](std::size_t NumStars) -> void
         {
             for (std::size_t i = 0; i != NumStars; ++i)
             {
@@ -576,7 +815,7 @@ namespace Npgs
         {
             Generators.clear();
             CreateGenerators(EStellarTypeGenerationOption::kGiant, 1.0f, 35.0f);
-            GenerateBasicProperties(ExtraGiantCount_);
+            AppendBasicProperties(ExtraGiantCount_);
         }
 
         if (ExtraMassiveStarCount_ != 0)
@@ -585,7 +824,7 @@ namespace Npgs
             CreateGenerators(EStellarTypeGenerationOption::kRandom,
                              20.0f, 300.0f, EGenerationDistribution::kUniform,
                              0.0f,  3.5e6f, EGenerationDistribution::kUniform);
-            GenerateBasicProperties(ExtraMassiveStarCount_);
+            AppendBasicProperties(ExtraMassiveStarCount_);
         }
 
         if (ExtraNeutronStarCount_ != 0)
@@ -594,7 +833,7 @@ namespace Npgs
             CreateGenerators(EStellarTypeGenerationOption::kDeathStar,
                              10.0f, 20.0f, EGenerationDistribution::kUniform,
                              1e7f,   1e8f, EGenerationDistribution::kUniformByExponent);
-            GenerateBasicProperties(ExtraNeutronStarCount_);
+            AppendBasicProperties(ExtraNeutronStarCount_);
         }
 
         if (ExtraBlackHoleCount_ != 0)
@@ -603,7 +842,7 @@ namespace Npgs
             CreateGenerators(EStellarTypeGenerationOption::kRandom,
                              35.0f,  300.0f, EGenerationDistribution::kUniform,
                              1e7f, 1.26e10f, EGenerationDistribution::kFromPdf, -2.0, 0.5);
-            GenerateBasicProperties(ExtraBlackHoleCount_);
+            AppendBasicProperties(ExtraBlackHoleCount_);
         }
 
         if (ExtraMergeStarCount_ != 0)
@@ -612,7 +851,7 @@ namespace Npgs
             CreateGenerators(EStellarTypeGenerationOption::kMergeStar,
                              0.0f, 0.0f, EGenerationDistribution::kUniform,
                              1e6f, 1e8f, EGenerationDistribution::kUniformByExponent);
-            GenerateBasicProperties(ExtraMergeStarCount_);
+            AppendBasicProperties(ExtraMergeStarCount_);
         }
 
         std::size_t CommonStarsCount =
@@ -620,76 +859,54 @@ namespace Npgs
 
         Generators.clear();
         CreateGenerators(EStellarTypeGenerationOption::kRandom, 0.075f);
-        GenerateBasicProperties(CommonStarsCount);
-
-        NpgsCoreInfo("Interpolating stellar data as {} threads...", MaxThread);
-
-        std::vector<Astro::AStar> Stars = InterpolateStars(MaxThread, Generators, BasicProperties);
-
-        NpgsCoreInfo("Generating stellar slots...");
-        GenerateSlots(0.1f, StarCount_, 0.004f);
-
-        NpgsCoreInfo("Linking positions in octree to stellar systems...");
-        OrbitalSystems_.reserve(StarCount_);
-        std::ranges::shuffle(Stars, RandomEngine_);
-        std::vector<glm::vec3> Slots;
-        OctreeLinkToStellarSystems(Stars, Slots);
-
-        NpgsCoreInfo("Generating binary stars...");
-        GenerateBinaryStars(MaxThread);
-
-        NpgsCoreInfo("Sorting...");
-        std::ranges::sort(Slots, [](glm::vec3 Point1, glm::vec3 Point2)
-        {
-            return glm::length(Point1) < glm::length(Point2);
-        });
+        AppendBasicProperties(CommonStarsCount);
+    }
 
-        NpgsCoreInfo("Assigning name...");
-        std::string Name;
-        std::ostringstream Stream;
-        for (auto& System : OrbitalSystems_)
+    void FUniverse::AssignNames(const std::vector<glm::vec3>& SortedSlots)
+    {
+        // 各系统互不相关，按链接时的分片并行，名称字符串由系统所在节点的线程分配
+        ThreadPool_->ParallelForShards(SystemShards_, 0, [&](std::size_t i) -> void
         {
+            auto& System = OrbitalSystems_[i];
             glm::vec3 Position = System.GetBaryPosition();
-            auto it = std::ranges::lower_bound(Slots, Position, [](glm::vec3 Point1, glm::vec3 Point2) -> bool
+            auto it = std::ranges::lower_bound(SortedSlots, Position, [](glm::vec3 Point1, glm::vec3 Point2) -> bool
             {
                 return glm::length(Point1) < glm::length(Point2);
             });
-            std::ptrdiff_t Offset = it - Slots.begin();
-            Stream << std::setfill('0') << std::setw(8) << std::to_string(Offset);
-            Name = "SYSTEM-" + Stream.str();
-            System.SetBaryName(Name).SetBaryDistanceRank(Offset);
+            std::ptrdiff_t Offset = it - SortedSlots.begin();
+            std::string    Number = std::format("{:08}", Offset);
+            System.SetBaryName("SYSTEM-" + Number).SetBaryDistanceRank(Offset);
 
             auto& Stars = System.StarsData();
             if (Stars.size() > 1)
             {
-                std::ranges::sort(Stars, [](const std::unique_ptr<Astro::AStar>& Star1, std::unique_ptr<Astro::AStar>& Star2) -> bool
+                std::ranges::sort(Stars, [](const Astro::AStar& Star1, const Astro::AStar& Star2) -> bool
                 {
-                    return Star1->GetMass() > Star2->GetMass();
+                    return Star1.GetMass() > Star2.GetMass();
                 });
 
                 char Rank = 'A';
                 for (auto& Star : Stars)
                 {
-                    Star->SetName("STAR-" + Stream.str() + " " + Rank);
+                    Star.SetName("STAR-" + Number + " " + Rank);
                     ++Rank;
                 }
             }
             else
             {
-                Stars.front()->SetName("STAR-" + Stream.str());
+                Stars.front().SetName("STAR-" + Number);
             }
+        });
+    }
 
-            Stream.str("");
-            Stream.clear();
-        }
-
-        NpgsCoreInfo("Reset home stellar system...");
+    void FUniverse::ResetHomeStellarSystem()
+    {
         FNodeType* HomeNode = Octree_->Find(glm::vec3(0.0f), [](const FNodeType& Node) -> bool
         {
             if (Node.IsLeafNode())
             {
                 auto& Points = Node.GetPoints();
-                return Node.GetLink([](void*) -> bool { return true; }) != nullptr &&
+                return !Node.GetLinks().empty() &&
                     std::ranges::find(Points, glm::vec3(0.0f)) != Points.end();
             }
             else
@@ -699,20 +916,20 @@ namespace Npgs
         });
 
         // TODO: Fix when home star not at home grid
-        auto* HomeSystem = HomeNode->GetLink([](Astro::FOrbitalSystem* System) -> bool
+        FOctreeLinkId HomeLink = HomeNode->GetLink([this](FOctreeLinkId Link) -> bool
         {
-            return System->GetBaryPosition() == glm::vec3(0.0f);
+            return OrbitalSystems_[Link].GetBaryPosition() == glm::vec3(0.0f);
         });
         HomeNode->RemoveStorage();
         HomeNode->AddPoint(glm::vec3(0.0f));
-        HomeSystem->SetBaryNormal(glm::vec2(0.0f));
 
-        for (auto& Star : HomeSystem->StarsData())
+        auto& HomeSystem = OrbitalSystems_[HomeLink];
+        HomeSystem.SetBaryNormal(glm::vec2(0.0f));
+
+        for (auto& Star : HomeSystem.StarsData())
         {
-            Star->SetNormal(glm::vec3(0.0f));
+            Star.SetNormal(glm::vec3(0.0f));
         }
-
-        NpgsCoreInfo("Stellar generation completed.");
     }
 
     void FUniverse::FillStellarSystem(int MaxThread)
@@ -742,139 +959,148 @@ namespace Npgs
     FUniverse::InterpolateStars(int MaxThread, std::vector<FStellarGenerator>& Generators,
                                 std::vector<FStellarBasicProperties>& BasicProperties)
     {
-        std::vector<std::vector<FStellarBasicProperties>> PropertyLists(MaxThread);
-        std::vector<std::promise<std::vector<Astro::AStar>>> Promises(MaxThread);
-        std::vector<std::future<std::vector<Astro::AStar>>> ChunkFutures;
-
-        MakeChunks(MaxThread, BasicProperties, PropertyLists, Promises, ChunkFutures);
-
-        for (int i = 0; i != MaxThread; ++i)
+        // 每个块独占一个生成器，块与生成器一一对应，结果与调度顺序无关
+        std::vector<Astro::AStar> Stars(BasicProperties.size());
+        ThreadPool_->ParallelForChunks(BasicProperties.size(), MaxThread,
+                                       [&](std::size_t Chunk, std::size_t Begin, std::size_t End) -> void
         {
-            ThreadPool_->Submit([&, i]() -> void
+            for (std::size_t i = Begin; i != End; ++i)
             {
-                std::vector<Astro::AStar> Stars;
-                for (auto& Properties : PropertyLists[i])
-                {
-                    Stars.push_back(Generators[i].GenerateStar(Properties));
-                }
-                Promises[i].set_value(std::move(Stars));
-            });
-        }
+                Stars[i] = Generators[Chunk].GenerateStar(BasicProperties[i]);
+            }
+        });
 
         BasicProperties.clear();
 
-        std::vector<Astro::AStar> Stars;
-        for (auto& Future : ChunkFutures)
-        {
-            auto Chunk = Future.get();
-            Stars.append_range(Chunk | std::views::as_rvalue);
-        }
-
         return Stars;
     }
 
-    void FUniverse::GenerateSlots(float MinDistance, std::size_t SampleCount, float Density)
+    void FUniverse::GenerateSlots(float MinDistance, std::size_t SampleCount, float PeakDensity)
     {
-        float Radius     = std::pow((3.0f * SampleCount / (4 * Math::kPi * Density)), (1.0f / 3.0f));
-        float LeafSize   = std::pow((1.0f / Density), (1.0f / 3.0f));
-        int   Exponent   = static_cast<int>(std::ceil(std::log2(Radius / LeafSize)));
-        float LeafRadius = LeafSize * 0.5f;
-        float RootRadius = LeafSize * static_cast<float>(std::pow(2, Exponent));
-
-        NpgsCoreInfo("Initializing octree...");
-        Octree_ = std::make_unique<TOctree<Astro::FOrbitalSystem>>(glm::vec3(0.0), RootRadius);
-        NpgsCoreInfo("Building empty octree...");
-        Octree_->BuildEmptyTree(LeafRadius); // 快速构建一个空树，每个叶子节点作为一个格子，用于生成恒星
+        // 原点所在的格子总要被选中，至少需要一个样本；为 0 时半径与八叉树深度也无从计算
+        if (SampleCount == 0)
+        {
+            throw std::invalid_argument("Slot sample count must be greater than zero.");
+        }
 
-        // 遍历八叉树，将距离原点大于半径的叶子节点标记为无效，保证恒星只会在范围内生成
-        NpgsCoreInfo("Traversing octree to generate slots...");
-        Octree_->Traverse([Radius](FNodeType& Node) -> void
+        // 在单位球内的规则网格上求密度分布的平均值，用于由峰值密度和恒星数量反推星系半径
+        constexpr int kProfileGridDim = 64;
+        double ProfileSum   = 0.0;
+        std::size_t InsideCount = 0;
+        for (int z = 0; z != kProfileGridDim; ++z)
         {
-            if (Node.IsLeafNode() && glm::length(Node.GetCenter()) > Radius)
+            for (int y = 0; y != kProfileGridDim; ++y)
             {
-                Node.SetValidation(false);
+                for (int x = 0; x != kProfileGridDim; ++x)
+                {
+                    glm::vec3 Position = (glm::vec3(x, y, z) + 0.5f) * (2.0f / kProfileGridDim) - 1.0f;
+                    if (glm::length(Position) <= 1.0f)
+                    {
+                        ProfileSum += DensityProfile_(Position);
+                        ++InsideCount;
+                    }
+                }
             }
-        });
+        }
 
-        NpgsCoreInfo("Get valid leafs");
-        std::size_t ValidLeafCount = Octree_->GetCapacity();
-        std::vector<FNodeType*> LeafNodes;
+        float MeanProfile = static_cast<float>(ProfileSum / static_cast<double>(InsideCount));
+        float Radius      = std::pow((3.0f * SampleCount / (4 * Math::kPi * PeakDensity * MeanProfile)), (1.0f / 3.0f));
+        float LeafSize    = std::pow((1.0f / PeakDensity), (1.0f / 3.0f));
+        int   Exponent    = static_cast<int>(std::ceil(std::log2(Radius / LeafSize)));
+        float LeafRadius  = LeafSize * 0.5f;
+        float RootRadius  = LeafSize * static_cast<float>(std::pow(2, Exponent));
+
+        NpgsCoreInfo("Initializing octree...");
+        Octree_ = std::make_unique<FOctreeType>(glm::vec3(0.0), RootRadius);
+        NpgsCoreInfo("Building empty octree...");
+        Octree_->BuildEmptyTree(LeafRadius); // 快速构建一个空树，每个叶子节点作为一个格子，用于生成恒星
 
-        auto CollectLeafNodes = [&LeafNodes](FNodeType& Node) -> void
+        std::vector<FNodeType*> LeafNodes;
+        Octree_->Traverse([&LeafNodes](FNodeType& Node) -> void
         {
             if (Node.IsLeafNode())
             {
                 LeafNodes.push_back(&Node);
             }
-        };
+        });
 
-        // 使用栅格采样，八叉树的每个叶子节点作为一个格子，在这个格子中生成一个恒星
-        NpgsCoreInfo("Sampling slots...");
-        while (ValidLeafCount != SampleCount)
+        // 原点所在的格子（包含 (LeafRadius, LeafRadius, LeafRadius) 的叶子节点）用于存储初始恒星系统，必须被选中
+        FNodeType* HomeNode = Octree_->Find(glm::vec3(LeafRadius), [](const FNodeType& Node) -> bool
+        {
+            return Node.IsLeafNode();
+        });
+
+        // 按密度加权无放回抽样选出 SampleCount 个格子：每个格子的键为 log(u) / w，取键最大的格子（Efraimidis-Spirakis）
+        // 半径以外的格子只在半径内格子不足时按距离由近到远补充。权重下限取 kMinWeight，
+        // 密度为 0 的格子（例如 HaloWeight 为 0）键值仍是有限值，排在半径内其他格子之后、半径外格子之前
+        constexpr double kMinWeight = 1e-12;
+        NpgsCoreInfo("Selecting {} slots from {} cells...", SampleCount, LeafNodes.size());
+        std::uint64_t SelectionSeed = (static_cast<std::uint64_t>(SeedGenerator_(RandomEngine_)) << 32) | SeedGenerator_(RandomEngine_);
+        std::vector<std::pair<double, FNodeType*>> Keys(LeafNodes.size());
+
+        ThreadPool_->ParallelFor(0, LeafNodes.size(), 0, [&](std::size_t i) -> void
         {
-            LeafNodes.clear();
-            Octree_->Traverse(CollectLeafNodes);
-            std::ranges::shuffle(LeafNodes, RandomEngine_); // 打乱叶子节点，保证随机性
+            FNodeType* Node     = LeafNodes[i];
+            glm::vec3  Center   = Node->GetCenter();
+            float      Distance = glm::length(Center);
+            double     Key      = 0.0;
 
-            // 删除或收回叶子节点，直到格子数量等于目标数量
-            if (ValidLeafCount < SampleCount)
+            if (Node == HomeNode)
             {
-                for (auto* Node : LeafNodes)
-                {
-                    glm::vec3 Center = Node->GetCenter();
-                    float Distance = glm::length(Center);
-                    if (!Node->IsValid() && Distance >= Radius && Distance <= Radius + LeafRadius)
-                    {
-                        Node->SetValidation(true);
-                        if (++ValidLeafCount == SampleCount)
-                        {
-                            break;
-                        }
-                    }
-                }
+                Key = std::numeric_limits<double>::infinity();
+            }
+            else if (Distance > Radius)
+            {
+                Key = -1e30 - Distance;
             }
             else
             {
-                for (auto* Node : LeafNodes)
-                {
-                    glm::vec3 Center = Node->GetCenter();
-                    float Distance = glm::length(Center);
-                    if (Node->IsValid() && Distance >= Radius - LeafRadius && Distance <= Radius)
-                    {
-                        Node->SetValidation(false);
-                        if (--ValidLeafCount == SampleCount)
-                        {
-                            break;
-                        }
-                    }
-                }
+                double Weight  = std::max(static_cast<double>(DensityProfile_(Center / Radius)), kMinWeight);
+                double Uniform = Math::HashToUnitDouble(Math::SplitMix64(SelectionSeed ^ i)) + 0x1.0p-54;
+                Key = std::log(Uniform) / Weight;
             }
+
+            Keys[i] = { Key, Node };
+        });
+
+        SampleCount = std::min(SampleCount, Keys.size());
+        std::ranges::nth_element(Keys, Keys.begin() + SampleCount, std::ranges::greater{},
+                                 &std::pair<double, FNodeType*>::first);
+
+        for (std::size_t i = 0; i != Keys.size(); ++i)
+        {
+            Keys[i].second->SetValidation(i < SampleCount);
         }
 
-        Math::TUniformRealDistribution Offset(-LeafRadius, LeafRadius - MinDistance); // 用于随机生成恒星位置相对于叶子节点中心点的偏移量
-        // 遍历八叉树，为每个有效的叶子节点生成一个恒星
-        Octree_->Traverse([&Offset, this](FNodeType& Node) -> void
+        Keys.resize(SampleCount);
+        std::iter_swap(Keys.begin(), std::ranges::find(Keys, HomeNode, &std::pair<double, FNodeType*>::second));
+
+        // 在选中的格子上做泊松盘采样，保证任意两颗恒星间距不小于 MinDistance
+        NpgsCoreInfo("Sampling slots...");
+        std::vector<glm::ivec3> Cells;
+        Cells.reserve(SampleCount);
+        for (const auto& [Key, Node] : Keys)
         {
-            if (Node.IsLeafNode() && Node.IsValid())
-            {
-                glm::vec3 Center(Node.GetCenter());
-                glm::vec3 StellarSlot(Center.x + Offset(RandomEngine_),
-                                      Center.y + Offset(RandomEngine_),
-                                      Center.z + Offset(RandomEngine_));
-                Node.AddPoint(StellarSlot);
-            }
-        });
+            Cells.emplace_back(glm::floor((Node->GetCenter() + RootRadius) / LeafSize));
+        }
 
-        // 为了保证恒星系统的唯一性，将原点附近所在的叶子节点作为存储初始恒星系统的结点
-        // 寻找包含了 (LeafRadius, LeafRadius, LeafRadius) 的叶子节点，将这个格子存储的位置修改为原点
-        FNodeType* HomeNode = Octree_->Find(glm::vec3(LeafRadius), [](const FNodeType& Node) -> bool
+        FPoissonDiskSampler::FCreateInfo SamplerCreateInfo
         {
-            return Node.IsLeafNode();
-        });
+            .GridMin     = glm::vec3(-RootRadius),
+            .CellSize    = LeafSize,
+            .GridDim     = static_cast<int>(std::round(2.0f * RootRadius / LeafSize)),
+            .MinDistance = MinDistance,
+            .Seed        = Math::SplitMix64(SelectionSeed)
+        };
 
-        // 把最靠近原点的格子存储旧的位置点删除，加入初始恒星系统
-        HomeNode->RemoveStorage();
-        HomeNode->AddPoint(glm::vec3(0.0f));
+        FPoissonDiskSampler Sampler(SamplerCreateInfo);
+        std::array<glm::vec3, 1> HomePoint{ glm::vec3(0.0f) };
+        std::vector<glm::vec3> Points = Sampler.Sample(Cells, HomePoint);
+
+        for (std::size_t i = 0; i != Keys.size(); ++i)
+        {
+            Keys[i].second->AddPoint(Points[i]);
+        }
     }
 
     void FUniverse::OctreeLinkToStellarSystems(std::vector<Astro::AStar>& Stars, std::vector<glm::vec3>& Slots)
@@ -887,20 +1113,69 @@ namespace Npgs
             {
                 for (const auto& Point : Node.GetPoints())
                 {
+                    // 链接保存星系序号而不是地址，OrbitalSystems_ 扩容不会使八叉树链接失效
                     Astro::FBaryCenter NewBary(Point, glm::vec2(0.0f), 0, "");
-                    Astro::FOrbitalSystem NewSystem(NewBary);
-                    NewSystem.StarsData().push_back(std::make_unique<Astro::AStar>(Stars.back()));
-                    NewSystem.SetBaryNormal(NewSystem.StarsData().front()->GetNormal());
-                    Stars.pop_back();
-
-                    OrbitalSystems_.push_back(std::move(NewSystem));
+                    OrbitalSystems_.emplace_back(NewBary);
 
-                    Node.AddLink(&OrbitalSystems_[Index]);
+                    Node.AddLink(static_cast<FOctreeLinkId>(Index));
                     Slots.push_back(Point);
                     ++Index;
                 }
             }
         });
+
+        // 第 i 个系统取 Stars 末尾倒数第 i 颗恒星。恒星对象按 NUMA 分片在各节点上首次写入，
+        // 之后的命名、双星生成与统计都按同样的分片访问
+        std::size_t StarCount = Stars.size();
+        SystemShards_ = ThreadPool_->MakeNumaShards(Index);
+        ThreadPool_->ParallelForShards(SystemShards_, 0, [&](std::size_t i) -> void
+        {
+            auto& System = OrbitalSystems_[i];
+            System.AddStar(std::move(Stars[StarCount - 1 - i]));
+            System.SetBaryNormal(System.StarsData().front().GetNormal());
+        });
+
+        Stars.resize(StarCount - Index);
+    }
+
+    void FUniverse::BuildStellarAggregates()
+    {
+        Octree_->BuildAggregates([this](const FNodeType& Node) -> FStellarAggregate
+        {
+            return MakeLeafAggregate(Node);
+        });
+    }
+
+    void FUniverse::BuildStarCatalog()
+    {
+        std::size_t TotalStarCount = 0;
+        for (const auto& System : OrbitalSystems_)
+        {
+            TotalStarCount += System.StarsData().size();
+        }
+
+        StarCatalog_.Clear();
+        StarCatalog_.Reserve(TotalStarCount, OrbitalSystems_.size());
+        for (const auto& System : OrbitalSystems_)
+        {
+            StarCatalog_.AddSystem(System.GetBaryPosition(), System.StarsData());
+        }
+    }
+
+    FStellarAggregate FUniverse::MakeLeafAggregate(const FNodeType& Node) const
+    {
+        FStellarAggregate Aggregate;
+        for (FOctreeLinkId Link : Node.GetLinks())
+        {
+            const auto& System   = OrbitalSystems_[Link];
+            glm::vec3   Position = System.GetBaryPosition();
+            for (const auto& Star : System.StarsData())
+            {
+                Aggregate.AddStar(Position, Star.GetLuminosity(), Star.GetTeff());
+            }
+        }
+
+        return Aggregate;
     }
 
     void FUniverse::GenerateBinaryStars(int MaxThread)
@@ -931,7 +1206,7 @@ namespace Npgs
         for (auto& System : OrbitalSystems_)
         {
             const auto& Star = System.StarsData().front();
-            if (!Star->IsSingleStar())
+            if (!Star.IsSingleStar())
             {
                 BinarySystems.push_back(&System);
             }
@@ -944,7 +1219,7 @@ namespace Npgs
             auto& SelectedGenerator = Generators[ThreadId];
 
             const auto& Star = BinarySystems[i]->StarsData().front();
-            float FirstStarInitialMassSol = Star->GetInitialMass() / kSolarMass;
+            float FirstStarInitialMassSol = Star.GetInitialMass() / kSolarMass;
             float MassLowerLimit = std::max(0.075f, 0.1f * FirstStarInitialMassSol);
             float MassUpperLimit = std::min(10 * FirstStarInitialMassSol, 300.0f);
 
@@ -953,12 +1228,12 @@ namespace Npgs
             SelectedGenerator.SetLogMassSuggestDistribution(
                 std::make_unique<Math::TNormalDistribution<>>(std::log10(FirstStarInitialMassSol), 0.25f));
 
-            double Age = Star->GetAge();
-            float  FeH = Star->GetFeH();
+            double Age = Star.GetAge();
+            float  FeH = Star.GetFeH();
 
-            if (std::to_underlying(Star->GetEvolutionPhase()) > 10)
+            if (std::to_underlying(Star.GetEvolutionPhase()) > 10)
             {
-                Age -= Star->GetLifetime();
+                Age -= Star.GetLifetime();
             }
 
             BasicProperties.push_back(SelectedGenerator.GenerateBasicProperties(static_cast<float>(Age), FeH));
@@ -966,9 +1241,24 @@ namespace Npgs
 
         std::vector<Astro::AStar> Stars = InterpolateStars(MaxThread, Generators, BasicProperties);
 
-        for (std::size_t i = 0; i != BinarySystems.size(); ++i)
+        // BinarySystems 按系统顺序排列，按系统分片切分后，伴星在其所属系统的节点上分配
+        std::vector<FThreadPool::FNumaShard> BinaryShards;
+        std::size_t BinaryIndex = 0;
+        for (const auto& Shard : SystemShards_)
         {
-            BinarySystems[i]->StarsData().push_back(std::make_unique<Astro::AStar>(Stars[i]));
+            std::size_t Begin = BinaryIndex;
+            while (BinaryIndex != BinarySystems.size() &&
+                   static_cast<std::size_t>(BinarySystems[BinaryIndex] - OrbitalSystems_.data()) < Shard.End)
+            {
+                ++BinaryIndex;
+            }
+
+            BinaryShards.push_back({ .NumaNode = Shard.NumaNode, .Begin = Begin, .End = BinaryIndex });
         }
+
+        ThreadPool_->ParallelForShards(BinaryShards, 0, [&](std::size_t i) -> void
+        {
+            BinarySystems[i]->AddStar(std::move(Stars[i]));
+        });
     }
 } // namespace Npgs
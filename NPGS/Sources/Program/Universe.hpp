@@ -10,12 +10,40 @@
 #include "Engine/Core/Math/Random.hpp"
 #include "Engine/Core/Types/Entries/Astro/Star.hpp"
 #include "Engine/Core/Types/Entries/Astro/OrbitalSystem.hpp"
+#include "Engine/Core/Types/Entries/Astro/StarCatalog.hpp"
 #include "Engine/Runtime/Pools/ThreadPool.hpp"
 #include "Engine/System/Generators/StellarGenerator.hpp"
 #include "Engine/System/Spatial/Octree.hpp"
 
 namespace Npgs
 {
+    // 八叉树节点的恒星聚合数据，用于远距离渲染与统计时代替逐个访问恒星
+    struct FStellarAggregate
+    {
+        glm::vec3   BoundCenter{};
+        float       BoundRadius{ -1.0f };      // 小于 0 表示节点内没有恒星
+        double      TotalLuminosity{};         // 总光度，单位 W
+        double      LuminosityWeightedTeff{};  // 光度加权的有效温度之和，除以总光度得到平均值
+        std::size_t StarCount{};
+
+        void  AddStar(glm::vec3 Position, double Luminosity, float Teff);
+        void  Merge(const FStellarAggregate& Other);
+        float GetMeanTeff() const;
+    };
+
+    // 星系恒星数密度分布，指数盘 + 高斯核球 + 均匀晕，坐标以星系半径归一化，盘面法线为 z 轴
+    // 返回值为相对于中心峰值的密度比例，范围 (0, 1]
+    struct FGalacticDensityProfile
+    {
+        float DiskScaleLength{ 0.4f };
+        float DiskScaleHeight{ 0.1f };
+        float BulgeRadius{ 0.15f };
+        float BulgeWeight{ 1.0f };
+        float HaloWeight{ 0.1f };
+
+        float operator()(glm::vec3 NormalizedPosition) const;
+    };
+
     class FUniverse
     {
     public:
@@ -26,30 +54,54 @@ namespace Npgs
 
         ~FUniverse() = default;
 
-        void FillUniverse();
+        // 取消时在当前阶段结束后抛出 FOperationCanceledError
+        void FillUniverse(const FCancellationToken& CancellationToken = {});
         void ReplaceStar(std::size_t DistanceRank, const Astro::AStar& StarData);
         void CountStars();
 
+        // 按列存储的恒星热数据，FillUniverse 完成后可用
+        const Astro::FStarCatalog& GetStarCatalog() const;
+        // 目录中某一行对应的恒星，经 OrbitalSystems_ 查找
+        const Astro::AStar* GetCatalogStar(std::size_t Row) const;
+
+        // 需要在 FillUniverse 之前设置
+        void SetDensityProfile(const FGalacticDensityProfile& Profile);
+
+        // 收集视点处满足屏幕空间误差阈值的聚合数据，节点半径与距离之比小于 ErrorThreshold 时不再细分
+        std::vector<FStellarAggregate> CollectLodAggregates(glm::vec3 ViewPosition, float ErrorThreshold) const;
+
     private:
-        void GenerateStars(int MaxThread);
+        void GenerateBasicProperties(int MaxThread, std::vector<FStellarGenerator>& Generators,
+                                     std::vector<FStellarBasicProperties>& BasicProperties);
         void FillStellarSystem(int MaxThread);
 
         std::vector<Astro::AStar> InterpolateStars(int MaxThread, std::vector<FStellarGenerator>& Generators,
                                                    std::vector<FStellarBasicProperties>& BasicProperties);
 
-        void GenerateSlots(float MinDistance, std::size_t SampleCount, float Density);
+        void GenerateSlots(float MinDistance, std::size_t SampleCount, float PeakDensity);
         void OctreeLinkToStellarSystems(std::vector<Astro::AStar>& Stars, std::vector<glm::vec3>& Slots);
         void GenerateBinaryStars(int MaxThread);
+        void AssignNames(const std::vector<glm::vec3>& SortedSlots);
+        void ResetHomeStellarSystem();
+        void BuildStellarAggregates();
+        void BuildStarCatalog();
 
     private:
-        using FNodeType = TOctree<Astro::FOrbitalSystem>::FNodeType;
+        // 八叉树叶子链接的是 OrbitalSystems_ 中的星系序号
+        using FOctreeType = TOctree<FStellarAggregate>;
+        using FNodeType   = FOctreeType::FNodeType;
+
+        FStellarAggregate MakeLeafAggregate(const FNodeType& Node) const;
 
     private:
         std::mt19937                                    RandomEngine_;
         std::vector<Astro::FOrbitalSystem>              OrbitalSystems_;
+        std::vector<FThreadPool::FNumaShard>            SystemShards_;   // OrbitalSystems_ 的 NUMA 分片，恒星数据按分片首次写入
+        Astro::FStarCatalog                             StarCatalog_;    // 系统序号与 OrbitalSystems_ 一致
         Math::TUniformIntDistribution<std::uint32_t>    SeedGenerator_;
         Math::TUniformRealDistribution<>                CommonGenerator_;
-        std::unique_ptr<TOctree<Astro::FOrbitalSystem>> Octree_;
+        std::unique_ptr<FOctreeType>                    Octree_;
+        FGalacticDensityProfile                         DensityProfile_;
         FThreadPool*                                    ThreadPool_;
 
         std::size_t StarCount_;